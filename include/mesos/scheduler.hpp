@@ -59,6 +59,16 @@ public:
   virtual void statusUpdate(SchedulerDriver* driver,
                             const TaskStatus& status) = 0;
 
+  // Invoked (instead of statusUpdate) when the status updates arrive
+  // in a batch, by default just calls statusUpdate for each status.
+  virtual void statusUpdates(SchedulerDriver* driver,
+                             const std::vector<TaskStatus>& statuses)
+  {
+    for (size_t i = 0; i < statuses.size(); i++) {
+      statusUpdate(driver, statuses[i]);
+    }
+  }
+
   virtual void frameworkMessage(SchedulerDriver* driver,
                                 const SlaveID& slaveId,
                                 const ExecutorID& executorId,
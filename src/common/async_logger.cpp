@@ -0,0 +1,176 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unistd.h>
+
+#include <sstream>
+
+#include "common/async_logger.hpp"
+#include "common/lock.hpp"
+
+using std::string;
+
+
+namespace mesos {
+namespace internal {
+
+// How long (in microseconds) the background thread sleeps when there
+// is nothing to write out.
+static const useconds_t IDLE_INTERVAL = 10000;
+
+
+AsyncLogger::AsyncLogger(google::base::Logger* _logger, size_t capacity)
+  : logger(_logger),
+    ring(capacity + 1, (Entry*) NULL),
+    head(0),
+    tail(0),
+    droppedMessages(0),
+    reportedMessages(0),
+    running(true)
+{
+  CHECK(logger != NULL);
+  CHECK(capacity > 0);
+
+  pthread_mutex_init(&mutex, NULL);
+
+  if (pthread_create(&thread, NULL, AsyncLogger::run, this) != 0) {
+    LOG(FATAL) << "Failed to create the logging thread";
+  }
+}
+
+
+AsyncLogger::~AsyncLogger()
+{
+  running = false;
+  pthread_join(thread, NULL);
+
+  drain();
+
+  pthread_mutex_destroy(&mutex);
+}
+
+
+void AsyncLogger::Write(bool force_flush,
+                        time_t timestamp,
+                        const char* message,
+                        int length)
+{
+  // glog writes an empty message with 'force_flush' to every logger
+  // before it aborts on a FATAL message, so write everything out now.
+  if (length == 0 && force_flush) {
+    Flush();
+    return;
+  }
+
+  size_t next = (tail + 1) % ring.size();
+
+  if (next == head) {
+    droppedMessages++;
+    return;
+  }
+
+  Entry* entry = new Entry();
+  entry->flush = force_flush;
+  entry->timestamp = timestamp;
+  entry->message.assign(message, length);
+
+  ring[tail] = entry;
+
+  // Make sure the entry is visible before the consumer can see it.
+  __sync_synchronize();
+
+  tail = next;
+}
+
+
+void AsyncLogger::Flush()
+{
+  drain();
+  logger->Flush();
+}
+
+
+google::uint32 AsyncLogger::LogSize()
+{
+  return logger->LogSize();
+}
+
+
+void AsyncLogger::drain()
+{
+  Lock lock(&mutex);
+
+  while (head != tail) {
+    __sync_synchronize();
+
+    Entry* entry = ring[head];
+    ring[head] = NULL;
+
+    // Let the producer reuse the slot.
+    __sync_synchronize();
+
+    head = (head + 1) % ring.size();
+
+    logger->Write(entry->flush, entry->timestamp,
+                  entry->message.data(), entry->message.size());
+
+    delete entry;
+  }
+
+  // Messages only get dropped while the ring is full, i.e., after
+  // the messages that were in the ring, so report them now.
+  uint64_t dropped = droppedMessages;
+  if (dropped > reportedMessages) {
+    std::ostringstream out;
+    out << "Dropped " << dropped - reportedMessages
+        << " log messages because the log buffer was full\n";
+    logger->Write(true, time(NULL), out.str().data(), out.str().size());
+    reportedMessages = dropped;
+  }
+}
+
+
+void* AsyncLogger::run(void* arg)
+{
+  AsyncLogger* logger = (AsyncLogger*) arg;
+
+  while (logger->running) {
+    if (logger->head == logger->tail) {
+      usleep(IDLE_INTERVAL);
+    } else {
+      logger->drain();
+    }
+  }
+
+  return NULL;
+}
+
+
+void AsyncLogger::install(size_t capacity)
+{
+  const google::LogSeverity severities[] =
+    { google::INFO, google::WARNING, google::ERROR };
+
+  for (size_t i = 0; i < sizeof(severities) / sizeof(severities[0]); i++) {
+    google::base::Logger* logger = google::base::GetLogger(severities[i]);
+    google::base::SetLogger(severities[i], new AsyncLogger(logger, capacity));
+  }
+}
+
+} // namespace internal {
+} // namespace mesos {
@@ -0,0 +1,110 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ASYNC_LOGGER_HPP__
+#define __ASYNC_LOGGER_HPP__
+
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+
+
+namespace mesos {
+namespace internal {
+
+// A glog logger that hands each (already formatted) message to a
+// background thread which writes it to the wrapped logger (e.g., the
+// log file), so that a log statement never blocks on disk. Messages
+// are queued in a bounded ring buffer; when the ring is full new
+// messages get dropped (and the number dropped gets written to the
+// log once there is room again) rather than blocking the caller.
+//
+// glog calls Logger::Write while holding its own mutex, so there is
+// only ever one thread adding to the ring at a time and the ring can
+// be a lock-free single producer/single consumer queue. Flushing
+// (e.g., glog flushes every logger before aborting on a FATAL
+// message) writes out everything queued before returning.
+class AsyncLogger : public google::base::Logger
+{
+public:
+  // The wrapped logger must outlive this logger. At most 'capacity'
+  // messages are queued at a time.
+  AsyncLogger(google::base::Logger* logger, size_t capacity);
+
+  virtual ~AsyncLogger();
+
+  virtual void Write(bool force_flush,
+                     time_t timestamp,
+                     const char* message,
+                     int length);
+
+  virtual void Flush();
+
+  virtual google::uint32 LogSize();
+
+  // Returns the number of messages dropped because the ring was full.
+  uint64_t dropped() const { return droppedMessages; }
+
+  // Returns the wrapped logger.
+  google::base::Logger* wrapped() const { return logger; }
+
+  // Wraps the loggers for the INFO, WARNING and ERROR severities (the
+  // FATAL logger is left alone) in AsyncLoggers.
+  static void install(size_t capacity);
+
+private:
+  struct Entry
+  {
+    bool flush;
+    time_t timestamp;
+    std::string message;
+  };
+
+  // Writes out the queued messages.
+  void drain();
+
+  static void* run(void* arg);
+
+  google::base::Logger* logger;
+
+  // The ring, 'head' is the next entry to write out (only changed by
+  // the consumer) and 'tail' the next free slot (only changed by the
+  // producer); one slot is always left free to tell full from empty.
+  std::vector<Entry*> ring;
+  volatile size_t head;
+  volatile size_t tail;
+
+  volatile uint64_t droppedMessages;
+  uint64_t reportedMessages; // Dropped messages already reported.
+
+  // Serializes consumers (i.e., the background thread and flushes).
+  pthread_mutex_t mutex;
+
+  pthread_t thread;
+  volatile bool running;
+};
+
+} // namespace internal {
+} // namespace mesos {
+
+#endif // __ASYNC_LOGGER_HPP__
@@ -0,0 +1,172 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "common/foreach.hpp"
+#include "common/interval_set.hpp"
+
+using std::map;
+
+
+namespace mesos {
+namespace internal {
+
+IntervalSet::IntervalSet(const Resource::Ranges& ranges)
+{
+  for (int i = 0; i < ranges.range_size(); i++) {
+    add(ranges.range(i).begin(), ranges.range(i).end());
+  }
+}
+
+
+Resource::Ranges IntervalSet::ranges() const
+{
+  Resource::Ranges result;
+
+  foreachpair (uint64_t begin, uint64_t end, intervals) {
+    Resource::Range* range = result.add_range();
+    range->set_begin(begin);
+    range->set_end(end);
+  }
+
+  return result;
+}
+
+
+void IntervalSet::add(uint64_t begin, uint64_t end)
+{
+  if (begin > end) {
+    return;
+  }
+
+  // Start at the interval before 'begin' if it overlaps or is
+  // adjacent, otherwise at the first interval after 'begin'.
+  map<uint64_t, uint64_t>::iterator it = intervals.upper_bound(begin);
+
+  if (it != intervals.begin()) {
+    map<uint64_t, uint64_t>::iterator previous = it;
+    --previous;
+    if (begin == 0 || previous->second >= begin - 1) {
+      it = previous;
+    }
+  }
+
+  // Merge every interval that overlaps or is adjacent to [begin, end]
+  // (being careful not to overflow when end is the maximum value).
+  while (it != intervals.end() &&
+         (end == std::numeric_limits<uint64_t>::max() ||
+          it->first <= end + 1)) {
+    begin = std::min(begin, it->first);
+    end = std::max(end, it->second);
+    intervals.erase(it++);
+  }
+
+  intervals[begin] = end;
+}
+
+
+void IntervalSet::remove(uint64_t begin, uint64_t end)
+{
+  if (begin > end) {
+    return;
+  }
+
+  // Start at the interval containing 'begin' (if any).
+  map<uint64_t, uint64_t>::iterator it = intervals.upper_bound(begin);
+
+  if (it != intervals.begin()) {
+    --it;
+    if (it->second < begin) {
+      ++it;
+    }
+  }
+
+  while (it != intervals.end() && it->first <= end) {
+    uint64_t first = it->first;
+    uint64_t last = it->second;
+
+    intervals.erase(it++);
+
+    // Keep whatever was before and after [begin, end].
+    if (first < begin) {
+      intervals[first] = begin - 1;
+    }
+
+    if (last > end) {
+      intervals[end + 1] = last;
+      break;
+    }
+  }
+}
+
+
+bool IntervalSet::contains(uint64_t begin, uint64_t end) const
+{
+  if (begin > end) {
+    return true;
+  }
+
+  // Since the intervals are normalized, [begin, end] must be within
+  // the interval that starts at or before 'begin'.
+  const_iterator it = intervals.upper_bound(begin);
+
+  if (it == intervals.begin()) {
+    return false;
+  }
+
+  --it;
+
+  return it->second >= end;
+}
+
+
+bool IntervalSet::contains(const IntervalSet& that) const
+{
+  foreachpair (uint64_t begin, uint64_t end, that.intervals) {
+    if (!contains(begin, end)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+IntervalSet& IntervalSet::operator += (const IntervalSet& that)
+{
+  foreachpair (uint64_t begin, uint64_t end, that.intervals) {
+    add(begin, end);
+  }
+
+  return *this;
+}
+
+
+IntervalSet& IntervalSet::operator -= (const IntervalSet& that)
+{
+  foreachpair (uint64_t begin, uint64_t end, that.intervals) {
+    remove(begin, end);
+  }
+
+  return *this;
+}
+
+} // namespace internal {
+} // namespace mesos {
@@ -0,0 +1,85 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERVAL_SET_HPP__
+#define __INTERVAL_SET_HPP__
+
+#include <stdint.h>
+
+#include <map>
+
+#include <mesos/mesos.hpp>
+
+
+namespace mesos {
+namespace internal {
+
+// A set of non-negative integers stored as closed intervals
+// [begin, end] in a balanced tree keyed by the beginning of each
+// interval. The intervals are always kept normalized (i.e., sorted,
+// with no two intervals overlapping or adjacent) so adding, removing
+// or checking for an interval takes O(log n) plus the number of
+// intervals that get merged or split. This is what the arithmetic on
+// Resource::Ranges (e.g., ports) is implemented with.
+class IntervalSet
+{
+public:
+  typedef std::map<uint64_t, uint64_t>::const_iterator const_iterator;
+
+  IntervalSet() {}
+
+  // Ranges that are inverted (i.e., begin > end) are ignored.
+  IntervalSet(const Resource::Ranges& ranges);
+
+  // Returns the (normalized) intervals as a Resource::Ranges.
+  Resource::Ranges ranges() const;
+
+  void add(uint64_t begin, uint64_t end);
+  void remove(uint64_t begin, uint64_t end);
+
+  // Returns true if every integer in [begin, end] is in the set.
+  bool contains(uint64_t begin, uint64_t end) const;
+
+  // Returns true if 'that' is a subset of this set.
+  bool contains(const IntervalSet& that) const;
+
+  IntervalSet& operator += (const IntervalSet& that);
+  IntervalSet& operator -= (const IntervalSet& that);
+
+  bool operator == (const IntervalSet& that) const
+  {
+    return intervals == that.intervals;
+  }
+
+  // Returns the number of intervals (not integers) in the set.
+  size_t size() const { return intervals.size(); }
+
+  bool empty() const { return intervals.empty(); }
+
+  const_iterator begin() const { return intervals.begin(); }
+  const_iterator end() const { return intervals.end(); }
+
+private:
+  // Maps the beginning of each interval to its (inclusive) end.
+  std::map<uint64_t, uint64_t> intervals;
+};
+
+} // namespace internal {
+} // namespace mesos {
+
+#endif // __INTERVAL_SET_HPP__
@@ -1,7 +1,11 @@
+#include <stdint.h>
+#include <stdio.h>
+
 #include <iostream>
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include <boost/variant.hpp>
 
@@ -161,4 +165,154 @@ inline void render(std::ostream& out, const Array& array)
   boost::apply_visitor(Renderer(out), value);
 }
 
+
+// Writes JSON directly into a string (e.g., the body of an HTTP
+// response) as it gets generated, rather than building up the JSON
+// objects above and then rendering them, which is what you want for
+// anything large. The caller is responsible for the nesting, e.g.:
+//
+//   JSON::Writer writer(&response.body);
+//   writer.beginObject();
+//   writer.field("id");
+//   writer.value(id);
+//   writer.field("tasks");
+//   writer.beginArray();
+//   ...
+//   writer.endArray();
+//   writer.endObject();
+//
+// Like with the JSON objects above, booleans get written as numbers.
+class Writer
+{
+public:
+  explicit Writer(std::string* _out) : out(_out), key(false) {}
+
+  void beginObject()
+  {
+    separate();
+    out->push_back('{');
+    first.push_back(true);
+  }
+
+  void endObject()
+  {
+    first.pop_back();
+    out->push_back('}');
+  }
+
+  void beginArray()
+  {
+    separate();
+    out->push_back('[');
+    first.push_back(true);
+  }
+
+  void endArray()
+  {
+    first.pop_back();
+    out->push_back(']');
+  }
+
+  // Writes the name of the next value written in an object.
+  void field(const std::string& name)
+  {
+    separate();
+    string(name);
+    out->push_back(':');
+    key = true;
+  }
+
+  void value(const std::string& s)
+  {
+    separate();
+    string(s);
+  }
+
+  void value(const char* s)
+  {
+    value(std::string(s));
+  }
+
+  void value(double d)
+  {
+    separate();
+    // Same as the Renderer (i.e., a precision of 10).
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.10g", d);
+    out->append(buffer);
+  }
+
+  // Integers get written exactly (a double would round anything
+  // beyond 2^53 and a precision of 10 rounds much sooner).
+  void value(uint64_t n)
+  {
+    separate();
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long) n);
+    out->append(buffer);
+  }
+
+  // Otherwise ints and bools would be ambiguous between double and
+  // uint64_t.
+  void value(int n)
+  {
+    value((double) n);
+  }
+
+  void value(bool b)
+  {
+    value(b ? 1.0 : 0.0);
+  }
+
+  // Writes a value that has already been rendered as JSON.
+  void raw(const std::string& json)
+  {
+    separate();
+    out->append(json);
+  }
+
+private:
+  // Writes a ',' if this is not the first value in an object or
+  // array (the ',' before a value in an object precedes its field).
+  void separate()
+  {
+    if (key) {
+      key = false;
+    } else if (!first.empty()) {
+      if (!first.back()) {
+        out->push_back(',');
+      }
+      first.back() = false;
+    }
+  }
+
+  void string(const std::string& s)
+  {
+    out->push_back('"');
+    for (size_t i = 0; i < s.size(); i++) {
+      char c = s[i];
+      if (c == '"' || c == '\\') {
+        out->push_back('\\');
+        out->push_back(c);
+      } else if ((unsigned char) c < 0x20) {
+        char buffer[8];
+        snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+        out->append(buffer);
+      } else {
+        out->push_back(c);
+      }
+    }
+    out->push_back('"');
+  }
+
+  std::string* out;
+
+  // Whether nothing has been written yet in each of the objects and
+  // arrays that are currently open.
+  std::vector<bool> first;
+
+  // Whether a field was just written (so the value needs no ',').
+  bool key;
+};
+
 } // namespace JSON {
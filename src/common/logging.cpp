@@ -16,10 +16,13 @@
  * limitations under the License.
  */
 
+#include <stdlib.h>
+
 #include <sys/stat.h>
 
 #include <glog/logging.h>
 
+#include "async_logger.hpp"
 #include "fatal.hpp"
 #include "logging.hpp"
 
@@ -37,6 +40,14 @@ using std::string;
 namespace mesos {
 namespace internal {
 
+// Writes out any log messages still queued (by the AsyncLoggers)
+// when the process exits.
+static void flushLogs()
+{
+  google::FlushLogFiles(google::INFO);
+}
+
+
 void Logging::registerOptions(Configurator* conf)
 {
   conf->addOption<bool>("quiet", 'q', "Disable logging to stderr", false);
@@ -45,6 +56,14 @@ void Logging::registerOptions(Configurator* conf)
   conf->addOption<int>("log_buf_secs",
                        "How many seconds to buffer log messages for\n",
                        0);
+  conf->addOption<bool>("async_logging",
+                        "Write log files from a background thread so\n"
+                        "that logging never blocks on disk",
+                        false);
+  conf->addOption<int>("async_log_messages",
+                       "Maximum number of log messages to queue for the\n"
+                       "background thread before dropping messages",
+                       100000);
 }
 
 
@@ -63,6 +82,11 @@ void Logging::init(const char* programName, const Configuration& conf)
 
   google::InitGoogleLogging(programName);
 
+  if (conf.get<bool>("async_logging", false)) {
+    AsyncLogger::install(conf.get<int>("async_log_messages", 100000));
+    atexit(flushLogs);
+  }
+
   if (!isQuiet(conf)) {
     google::SetStderrLogging(google::INFO);
   }
@@ -0,0 +1,371 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <iterator>
+
+#include <glog/logging.h>
+
+#include "common/foreach.hpp"
+#include "common/hashmap.hpp"
+#include "common/lock.hpp"
+#include "common/resource_vector.hpp"
+
+using std::back_inserter;
+using std::string;
+using std::vector;
+
+
+namespace mesos {
+namespace internal {
+
+// The interned names, one table per resource type (the ids of each
+// type are indexes into the corresponding vector of names).
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static hashmap<string, uint32_t> ids[3];
+static vector<string> names[3];
+
+
+// N.B. These get interned first (during static initialization, after
+// the tables above have been constructed) so they never need a lock.
+const uint32_t ResourceVector::CPUS = intern("cpus", Resource::SCALAR);
+const uint32_t ResourceVector::MEM = intern("mem", Resource::SCALAR);
+
+
+uint32_t ResourceVector::intern(const string& name, Resource::Type type)
+{
+  CHECK(Resource::Type_IsValid(type));
+
+  Lock lock(&mutex);
+
+  hashmap<string, uint32_t>::const_iterator iterator = ids[type].find(name);
+  if (iterator != ids[type].end()) {
+    return iterator->second;
+  }
+
+  uint32_t id = names[type].size();
+  names[type].push_back(name);
+  ids[type][name] = id;
+  return id;
+}
+
+
+// Ensures that the vectors can be indexed by 'id'.
+template <typename T>
+static void grow(vector<T>* values, vector<bool>* defined, uint32_t id)
+{
+  if (id >= values->size()) {
+    values->resize(id + 1);
+    defined->resize(id + 1, false);
+  }
+}
+
+
+ResourceVector::ResourceVector(
+    const google::protobuf::RepeatedPtrField<Resource>& resources)
+{
+  foreach (const Resource& resource, resources) {
+    add(resource);
+  }
+}
+
+
+ResourceVector::ResourceVector(const Resources& resources)
+{
+  foreach (const Resource& resource, resources) {
+    add(resource);
+  }
+}
+
+
+Resources ResourceVector::resources() const
+{
+  google::protobuf::RepeatedPtrField<Resource> result;
+
+  Lock lock(&mutex);
+
+  for (uint32_t id = 0; id < scalars.size(); id++) {
+    if (definedScalars[id]) {
+      Resource* resource = result.Add();
+      resource->set_name(names[Resource::SCALAR][id]);
+      resource->set_type(Resource::SCALAR);
+      resource->mutable_scalar()->set_value(scalars[id]);
+    }
+  }
+
+  for (uint32_t id = 0; id < ranges.size(); id++) {
+    if (definedRanges[id]) {
+      Resource* resource = result.Add();
+      resource->set_name(names[Resource::RANGES][id]);
+      resource->set_type(Resource::RANGES);
+      resource->mutable_ranges()->MergeFrom(ranges[id].ranges());
+    }
+  }
+
+  for (uint32_t id = 0; id < sets.size(); id++) {
+    if (definedSets[id]) {
+      Resource* resource = result.Add();
+      resource->set_name(names[Resource::SET][id]);
+      resource->set_type(Resource::SET);
+      Resource::Set* temp = resource->mutable_set();
+      foreach (const string& item, sets[id]) {
+        temp->add_item(item);
+      }
+    }
+  }
+
+  return result;
+}
+
+
+ResourceVector ResourceVector::allocatable() const
+{
+  ResourceVector result;
+
+  for (uint32_t id = 0; id < scalars.size(); id++) {
+    if (definedScalars[id] && scalars[id] > 0) {
+      result.addScalar(id, scalars[id]);
+    }
+  }
+
+  for (uint32_t id = 0; id < ranges.size(); id++) {
+    if (definedRanges[id] && !ranges[id].empty()) {
+      result.addRanges(id, ranges[id]);
+    }
+  }
+
+  for (uint32_t id = 0; id < sets.size(); id++) {
+    if (definedSets[id] && !sets[id].empty()) {
+      result.addSet(id, sets[id]);
+    }
+  }
+
+  return result;
+}
+
+
+size_t ResourceVector::size() const
+{
+  return std::count(definedScalars.begin(), definedScalars.end(), true) +
+    std::count(definedRanges.begin(), definedRanges.end(), true) +
+    std::count(definedSets.begin(), definedSets.end(), true);
+}
+
+
+// Returns true if the values defined in 'left' and 'right' are the
+// same (the vectors might have different sizes).
+template <typename T>
+static bool equal(const vector<T>& left, const vector<bool>& definedLeft,
+                  const vector<T>& right, const vector<bool>& definedRight)
+{
+  for (size_t id = 0; id < std::max(left.size(), right.size()); id++) {
+    bool l = id < left.size() && definedLeft[id];
+    bool r = id < right.size() && definedRight[id];
+    if (l != r || (l && !(left[id] == right[id]))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+bool ResourceVector::operator == (const ResourceVector& that) const
+{
+  return equal(scalars, definedScalars, that.scalars, that.definedScalars) &&
+    equal(ranges, definedRanges, that.ranges, that.definedRanges) &&
+    equal(sets, definedSets, that.sets, that.definedSets);
+}
+
+
+bool ResourceVector::operator != (const ResourceVector& that) const
+{
+  return !(*this == that);
+}
+
+
+bool ResourceVector::operator <= (const ResourceVector& that) const
+{
+  // A resource that isn't present in 'that' counts as zero (scalars)
+  // or empty (ranges and sets), so it only contains the resources of
+  // ours that are zero/empty too.
+  for (uint32_t id = 0; id < scalars.size(); id++) {
+    if (definedScalars[id] && scalars[id] > that.scalar(id)) {
+      return false;
+    }
+  }
+
+  for (uint32_t id = 0; id < ranges.size(); id++) {
+    if (definedRanges[id] && !ranges[id].empty()) {
+      if (id >= that.ranges.size() || !that.definedRanges[id] ||
+          !that.ranges[id].contains(ranges[id])) {
+        return false;
+      }
+    }
+  }
+
+  for (uint32_t id = 0; id < sets.size(); id++) {
+    if (definedSets[id] && !sets[id].empty()) {
+      if (id >= that.sets.size() || !that.definedSets[id] ||
+          !std::includes(that.sets[id].begin(), that.sets[id].end(),
+                         sets[id].begin(), sets[id].end())) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+
+ResourceVector ResourceVector::operator + (const ResourceVector& that) const
+{
+  ResourceVector result(*this);
+  result += that;
+  return result;
+}
+
+
+ResourceVector ResourceVector::operator - (const ResourceVector& that) const
+{
+  ResourceVector result(*this);
+  result -= that;
+  return result;
+}
+
+
+ResourceVector& ResourceVector::operator += (const ResourceVector& that)
+{
+  for (uint32_t id = 0; id < that.scalars.size(); id++) {
+    if (that.definedScalars[id]) {
+      addScalar(id, that.scalars[id]);
+    }
+  }
+
+  for (uint32_t id = 0; id < that.ranges.size(); id++) {
+    if (that.definedRanges[id]) {
+      addRanges(id, that.ranges[id]);
+    }
+  }
+
+  for (uint32_t id = 0; id < that.sets.size(); id++) {
+    if (that.definedSets[id]) {
+      addSet(id, that.sets[id]);
+    }
+  }
+
+  return *this;
+}
+
+
+ResourceVector& ResourceVector::operator -= (const ResourceVector& that)
+{
+  // Only subtract the resources that are present in this vector.
+  uint32_t size = std::min(scalars.size(), that.scalars.size());
+  for (uint32_t id = 0; id < size; id++) {
+    if (definedScalars[id] && that.definedScalars[id]) {
+      scalars[id] -= that.scalars[id];
+    }
+  }
+
+  size = std::min(ranges.size(), that.ranges.size());
+  for (uint32_t id = 0; id < size; id++) {
+    if (definedRanges[id] && that.definedRanges[id]) {
+      ranges[id] -= that.ranges[id];
+    }
+  }
+
+  size = std::min(sets.size(), that.sets.size());
+  for (uint32_t id = 0; id < size; id++) {
+    if (definedSets[id] && that.definedSets[id]) {
+      vector<string> result;
+      std::set_difference(sets[id].begin(), sets[id].end(),
+                          that.sets[id].begin(), that.sets[id].end(),
+                          back_inserter(result));
+      sets[id].swap(result);
+    }
+  }
+
+  return *this;
+}
+
+
+void ResourceVector::add(const Resource& resource)
+{
+  if (!Resource::Type_IsValid(resource.type())) {
+    return;
+  }
+
+  uint32_t id = intern(resource.name(), resource.type());
+
+  if (resource.type() == Resource::SCALAR) {
+    addScalar(id, resource.scalar().value());
+  } else if (resource.type() == Resource::RANGES) {
+    addRanges(id, IntervalSet(resource.ranges()));
+  } else if (resource.type() == Resource::SET) {
+    vector<string> sorted(resource.set().item().begin(),
+                          resource.set().item().end());
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    addSet(id, sorted);
+  }
+}
+
+
+void ResourceVector::addScalar(uint32_t id, double value)
+{
+  grow(&scalars, &definedScalars, id);
+
+  if (definedScalars[id]) {
+    scalars[id] += value;
+  } else {
+    scalars[id] = value;
+    definedScalars[id] = true;
+  }
+}
+
+
+void ResourceVector::addRanges(uint32_t id, const IntervalSet& _ranges)
+{
+  grow(&ranges, &definedRanges, id);
+
+  ranges[id] += _ranges;
+  definedRanges[id] = true;
+}
+
+
+void ResourceVector::addSet(uint32_t id, const vector<string>& set)
+{
+  grow(&sets, &definedSets, id);
+
+  if (definedSets[id]) {
+    vector<string> result;
+    std::set_union(sets[id].begin(), sets[id].end(),
+                   set.begin(), set.end(),
+                   back_inserter(result));
+    sets[id].swap(result);
+  } else {
+    sets[id] = set;
+    definedSets[id] = true;
+  }
+}
+
+} // namespace internal {
+} // namespace mesos {
@@ -0,0 +1,135 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RESOURCE_VECTOR_HPP__
+#define __RESOURCE_VECTOR_HPP__
+
+#include <stdint.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <mesos/mesos.hpp>
+
+#include "common/interval_set.hpp"
+#include "common/resources.hpp"
+
+
+// A ResourceVector holds the same information as a Resources object
+// but in a form that is cheap to do arithmetic on, for use when
+// keeping track of resources within the Mesos core (e.g., how much of
+// a slave is offered or in use). Every (name, type) pair gets
+// interned into a small integer id (shared by every ResourceVector in
+// the process), scalars are stored in a flat array indexed by that
+// id, ranges are stored as IntervalSets and sets are stored as sorted
+// vectors of items. Converting
+// to/from the protocol buffer representation should only be done at
+// the boundaries (i.e., when receiving or sending a message).
+
+// Note that the semantics are those of the Resources class: adding a
+// resource that isn't present adds it while subtracting a resource
+// that isn't present is a no-op, and a resource stays present (with
+// a possibly zero/empty value) after subtracting all of it. When
+// comparing (<=) a resource that isn't present counts as zero/empty.
+
+
+namespace mesos {
+namespace internal {
+
+class ResourceVector
+{
+public:
+  ResourceVector() {}
+
+  ResourceVector(const google::protobuf::RepeatedPtrField<Resource>& resources);
+  ResourceVector(const Resources& resources);
+
+  // Converts back to the protocol buffer representation.
+  Resources resources() const;
+
+  // Returns a ResourceVector with only the allocatable resources
+  // (see Resources::isAllocatable).
+  ResourceVector allocatable() const;
+
+  // Returns the number of (present) resources.
+  size_t size() const;
+
+  bool operator == (const ResourceVector& that) const;
+  bool operator != (const ResourceVector& that) const;
+  bool operator <= (const ResourceVector& that) const;
+
+  ResourceVector operator + (const ResourceVector& that) const;
+  ResourceVector operator - (const ResourceVector& that) const;
+  ResourceVector& operator += (const ResourceVector& that);
+  ResourceVector& operator -= (const ResourceVector& that);
+
+  // Returns the id for a resource with the specified name and type,
+  // interning the name if this is the first time it has been seen.
+  // Ids are dense and assigned separately for each type.
+  static uint32_t intern(const std::string& name, Resource::Type type);
+
+  // Ids of the well-known scalars, interned up front so that looking
+  // them up (e.g., when allocating) doesn't need to intern (and lock).
+  static const uint32_t CPUS;
+  static const uint32_t MEM;
+
+  // Returns the value of a scalar (zero if it isn't present).
+  double scalar(uint32_t id) const
+  {
+    return id < scalars.size() && definedScalars[id] ? scalars[id] : 0;
+  }
+
+  // N.B. This interns the name (see the ids above for a faster way).
+  double scalar(const std::string& name) const
+  {
+    return scalar(intern(name, Resource::SCALAR));
+  }
+
+  // Returns the largest scalar id that might be present plus one
+  // (i.e., scalar(id) is zero for every id not less than this).
+  uint32_t scalarsSize() const { return scalars.size(); }
+
+private:
+  void add(const Resource& resource);
+  void addScalar(uint32_t id, double value);
+  void addRanges(uint32_t id, const IntervalSet& ranges);
+  void addSet(uint32_t id, const std::vector<std::string>& set);
+
+  std::vector<double> scalars;
+  std::vector<bool> definedScalars;
+
+  std::vector<IntervalSet> ranges;
+  std::vector<bool> definedRanges;
+
+  std::vector<std::vector<std::string> > sets;
+  std::vector<bool> definedSets;
+};
+
+
+inline std::ostream& operator << (
+    std::ostream& stream,
+    const ResourceVector& resources)
+{
+  return stream << resources.resources();
+}
+
+} // namespace internal {
+} // namespace mesos {
+
+#endif // __RESOURCE_VECTOR_HPP__
@@ -24,10 +24,13 @@
 #include <boost/lexical_cast.hpp>
 
 #include "common/foreach.hpp"
+#include "common/interval_set.hpp"
 #include "common/resources.hpp"
 #include "common/strings.hpp"
 
 
+using mesos::internal::IntervalSet;
+
 using std::ostream;
 using std::string;
 using std::vector;
@@ -77,209 +80,44 @@ Resource::Scalar& operator -= (Resource::Scalar& left, const Resource::Scalar& r
 }
 
 
-static void coalesce(Resource::Ranges* ranges, const Resource::Range& range)
-{
-  // Note that we assume that ranges has already been coalesced.
-
-  bool coalesced = false;
-
-  for (int i = 0; i < ranges->range_size(); i++) {
-    int64_t begin = ranges->range(i).begin();
-    int64_t end = ranges->range(i).end();
-
-    if (begin <= range.begin() && range.end() <= end) {
-      // Ignore range since it is subsumed by a range in ranges.
-      coalesced = true;
-      break;
-    } else if (begin <= range.begin() && end < range.end()) {
-      // Grow the end of the range in ranges.
-      ranges->mutable_range(i)->set_end(range.end());
-      coalesced = true;
-      break;
-    } else if (range.begin() < begin && range.end() <= end) {
-      // Grow the beginning of the range in ranges.
-      ranges->mutable_range(i)->set_begin(range.begin());
-      coalesced = true;
-      break;
-    } else if (range.begin() < begin && end < range.end()) {
-      // Replace (grow both the beginning and the end) of the range in ranges.
-      ranges->mutable_range(i)->set_begin(range.begin());
-      ranges->mutable_range(i)->set_end(range.end());
-      coalesced = true;
-      break;
-    }
-  }
-  
-  if (!coalesced) {
-    ranges->add_range()->MergeFrom(range);
-  }
-}
-
-
-static void remove(Resource::Ranges* ranges, const Resource::Range& range)
-{
-  // Note that we assume that ranges has already been coalesced.
-
-  Resource::Ranges result;
-
-  for (int i = 0; i < ranges->range_size(); i++) {
-    int64_t begin = ranges->range(i).begin();
-    int64_t end = ranges->range(i).end();
-
-    if (begin == range.begin() && range.end() == end) {
-      // Remove range from ranges, but keep everything else.
-      for (int j = i; j < ranges->range_size(); j++) {
-        result.add_range()->MergeFrom(ranges->range(j));
-      }
-      break;
-    } else if (begin <= range.begin() && range.end() < end) {
-      // Shrink range in ranges.
-      Resource::Range* temp = result.add_range();
-      temp->set_begin(range.end() + 1);
-      temp->set_end(end);
-      break;
-    } else if (begin < range.begin() && range.end() >= end) {
-      // Shrink end of range in ranges.
-      Resource::Range* temp = result.add_range();
-      temp->set_begin(begin);
-      temp->set_end(range.begin() - 1);
-      break;
-    } else if (begin < range.begin() && range.end() < end) {
-      // Split range in ranges.
-      Resource::Range* temp = result.add_range();
-      temp->set_begin(begin);
-      temp->set_end(range.begin() - 1);
-      temp = result.add_range();
-      temp->set_begin(range.end() + 1);
-      temp->set_end(end);
-      break;
-    }
-  }
-
-  *ranges = result;
-}
-
-
 bool operator == (const Resource::Ranges& left, const Resource::Ranges& right)
 {
-  if (left.range_size() == right.range_size()) {
-    for (int i = 0; i < left.range_size(); i++) {
-      // Make sure this range is equal to a range in the right.
-      bool found = false;
-      for (int j = 0; j < right.range_size(); j++) {
-        if (left.range(i).begin() == right.range(j).begin() &&
-            left.range(i).end() == right.range(j).end()) {
-          found = true;
-          break;
-        }
-      }
-
-      if (!found) {
-        return false;
-      }
-    }
-
-    return true;
-  }
-
-  return false;
+  return IntervalSet(left) == IntervalSet(right);
 }
 
 
 bool operator <= (const Resource::Ranges& left, const Resource::Ranges& right)
 {
-  if (left.range_size() <= right.range_size()) {
-    for (int i = 0; i < left.range_size(); i++) {
-      // Make sure this range is a subset of every range in right.
-      for (int j = 0; j < right.range_size(); j++) {
-        if ((left.range(i).begin() <= right.range(j).begin() &&
-             left.range(i).end() > right.range(j).end()) ||
-            (left.range(i).begin() < right.range(j).begin() &&
-             left.range(i).end() >= right.range(j).end())) {
-          return false;
-        }
-      }
-    }
-
-    return true;
-  }
-
-  return false;
+  return IntervalSet(right).contains(IntervalSet(left));
 }
 
 
 Resource::Ranges operator + (const Resource::Ranges& left, const Resource::Ranges& right)
 {
-  Resource::Ranges result;
-
-  for (int i = 0; i < left.range_size(); i++) {
-    coalesce(&result, left.range(i));
-  }
-
-  for (int i = 0; i < right.range_size(); i++) {
-    coalesce(&result, right.range(i));
-  }
-
-  return result;
+  IntervalSet result(left);
+  result += IntervalSet(right);
+  return result.ranges();
 }
 
   
 Resource::Ranges operator - (const Resource::Ranges& left, const Resource::Ranges& right)
 {
-  Resource::Ranges result;
-
-  for (int i = 0; i < left.range_size(); i++) {
-    coalesce(&result, left.range(i));
-  }
-
-  for (int i = 0; i < right.range_size(); i++) {
-    coalesce(&result, right.range(i));
-  }
-
-  for (int i = 0; i < right.range_size(); i++) {
-    remove(&result, right.range(i));
-  }
-
-  return result;
+  IntervalSet result(left);
+  result -= IntervalSet(right);
+  return result.ranges();
 }
 
   
 Resource::Ranges& operator += (Resource::Ranges& left, const Resource::Ranges& right)
 {
-  Resource::Ranges temp;
-
-  for (int i = 0; i < left.range_size(); i++) {
-    coalesce(&temp, left.range(i));
-  }
-
-  left = temp;
-
-  for (int i = 0; i < right.range_size(); i++) {
-    coalesce(&left, right.range(i));
-  }
-
+  left = left + right;
   return left;
 }
 
 
 Resource::Ranges& operator -= (Resource::Ranges& left, const Resource::Ranges& right)
 {
-  Resource::Ranges temp;
-
-  for (int i = 0; i < left.range_size(); i++) {
-    coalesce(&temp, left.range(i));
-  }
-
-  for (int i = 0; i < right.range_size(); i++) {
-    coalesce(&temp, right.range(i));
-  }
-
-  left = temp;
-
-  for (int i = 0; i < right.range_size(); i++) {
-    remove(&left, right.range(i));
-  }
-
+  left = left - right;
   return left;
 }
 
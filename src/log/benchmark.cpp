@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <process/process.hpp>
+
+#include "common/fatal.hpp"
+#include "common/foreach.hpp"
+#include "common/result.hpp"
+#include "common/utils.hpp"
+
+#include "log/coordinator.hpp"
+#include "log/network.hpp"
+#include "log/replica.hpp"
+
+using namespace mesos;
+using namespace mesos::internal;
+using namespace mesos::internal::log;
+
+using process::Clock;
+
+using std::cout;
+using std::endl;
+using std::list;
+using std::string;
+using std::vector;
+
+
+// Prints the throughput (appends per second) and the 99th percentile
+// latency of the appends given the latency of each append.
+static void report(const string& name, vector<double> latencies, double secs)
+{
+  CHECK(!latencies.empty());
+
+  std::sort(latencies.begin(), latencies.end());
+
+  size_t index = (latencies.size() * 99) / 100;
+  if (index >= latencies.size()) {
+    index = latencies.size() - 1;
+  }
+
+  cout << "  " << std::left << std::setw(24) << name
+       << std::right << std::fixed << std::setprecision(1)
+       << std::setw(12) << latencies.size() / secs << " appends/sec"
+       << std::setw(12) << latencies[index] * 1000 << " ms p99" << endl;
+}
+
+
+// Runs the benchmark against a local "cluster" of the specified
+// number of replicas (all in this process, each with its own leveldb
+// in the specified directory) using a coordinator with a majority
+// quorum. Each entry is first appended one at a time and then in
+// pipelined batches of 'window' positions, with an entry's latency
+// being the time it took the append that included it to return.
+static void run(const string& directory,
+                int replicas,
+                int entries,
+                size_t window,
+                const string& data)
+{
+  vector<Replica*> cluster;
+  Network network;
+
+  for (int i = 0; i < replicas; i++) {
+    const string& path = directory + "/.log" + utils::stringify(i);
+    utils::os::rmdir(path);
+    cluster.push_back(new Replica(path));
+    network.add(cluster.back()->pid());
+  }
+
+  int quorum = replicas / 2 + 1;
+
+  cout << replicas << " replicas (quorum of " << quorum << "), "
+       << entries << " entries of " << data.size() << " bytes:" << endl;
+
+  {
+    Coordinator coord(quorum, cluster[0], &network);
+
+    Result<uint64_t> result = coord.elect();
+    CHECK(result.isSome()) << "Failed to elect the coordinator";
+
+    // Append one entry at a time.
+    vector<double> latencies;
+    double start = Clock::now();
+
+    for (int i = 0; i < entries; i++) {
+      double now = Clock::now();
+      result = coord.append(data);
+      CHECK(result.isSome()) << "Failed to append";
+      latencies.push_back(Clock::now() - now);
+    }
+
+    report("append", latencies, Clock::now() - start);
+
+    // Append in pipelined batches, handing the coordinator a few
+    // windows worth of entries at a time (so batches get pipelined).
+    latencies.clear();
+    start = Clock::now();
+
+    for (int i = 0; i < entries; i += window * 4) {
+      list<string> batch(std::min<int>(window * 4, entries - i), data);
+
+      double now = Clock::now();
+      result = coord.append(batch, window);
+      CHECK(result.isSome()) << "Failed to append";
+      latencies.insert(latencies.end(), batch.size(), Clock::now() - now);
+    }
+
+    report("pipelined append (" + utils::stringify(window) + ")",
+           latencies, Clock::now() - start);
+
+    coord.demote();
+  }
+
+  foreach (Replica* replica, cluster) {
+    delete replica;
+  }
+
+  for (int i = 0; i < replicas; i++) {
+    utils::os::rmdir(directory + "/.log" + utils::stringify(i));
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  if (argc < 2) {
+    fatal("Usage: %s directory <entries> <window> <bytes>", argv[0]);
+  }
+
+  string directory = argv[1];
+
+  int entries = argc > 2 ? atoi(argv[2]) : 1000;
+  int window = argc > 3 ? atoi(argv[3]) : 128;
+  int bytes = argc > 4 ? atoi(argv[4]) : 1024;
+
+  if (entries <= 0 || window <= 0 || bytes < 0) {
+    fatal("Expecting a positive number of entries and window size");
+  }
+
+  process::initialize(true);
+
+  const string data(bytes, 'x');
+
+  run(directory, 3, entries, window, data);
+  run(directory, 5, entries, window, data);
+
+  return 0;
+}
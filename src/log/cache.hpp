@@ -7,6 +7,7 @@
 #include <map>
 
 #include <tr1/functional>
+#include <tr1/unordered_map>
 
 #include "common/option.hpp"
 
@@ -14,6 +14,7 @@ using std::list;
 using std::pair;
 using std::set;
 using std::string;
+using std::vector;
 
 
 namespace mesos {
@@ -107,7 +108,29 @@ Result<uint64_t> Coordinator::elect()
 
     CHECK(positions.isReady()) << "Not expecting a discarded future!";
 
-    foreach (uint64_t position, positions.get()) {
+    // Rather than filling each position (a full round of the protocol
+    // per position) first catch up in bulk on the positions the other
+    // replicas have already learned, and only fill the rest.
+    Future<set<UPID> > members = network->members();
+
+    members.await(); // TODO(benh): Have timeout get passed in!
+
+    CHECK(members.isReady()) << "Not expecting a discarded future!";
+
+    set<UPID> peers = members.get();
+    peers.erase(replica->pid());
+
+    Future<set<uint64_t> > missing = replica->catchup(positions.get(), peers);
+
+    missing.await(); // Flow controlled with timeouts in the replica.
+
+    if (missing.isFailed()) {
+      return Result<uint64_t>::error(missing.failure());
+    }
+
+    CHECK(missing.isReady()) << "Not expecting a discarded future!";
+
+    foreach (uint64_t position, missing.get()) {
       Result<Action> result = fill(position);
       if (result.isError()) {
         return Result<uint64_t>::error(result.error());
@@ -161,6 +184,34 @@ Result<uint64_t> Coordinator::append(const string& bytes)
 }
 
 
+Result<uint64_t> Coordinator::append(
+    const list<string>& entries,
+    size_t window)
+{
+  if (!elected) {
+    return Result<uint64_t>::error("Coordinator not elected");
+  }
+
+  CHECK(!entries.empty());
+  CHECK(window > 0);
+
+  list<Action> actions;
+
+  foreach (const string& bytes, entries) {
+    Action action;
+    action.set_position(index + actions.size());
+    action.set_promised(id);
+    action.set_performed(id);
+    action.set_type(Action::APPEND);
+    Action::Append* append = action.mutable_append();
+    append->set_bytes(bytes);
+    actions.push_back(action);
+  }
+
+  return write(actions, window);
+}
+
+
 Result<uint64_t> Coordinator::truncate(uint64_t to)
 {
   if (!elected) {
@@ -349,6 +400,202 @@ Result<uint64_t> Coordinator::commit(const Action& action)
 }
 
 
+Result<uint64_t> Coordinator::write(
+    const list<Action>& actions,
+    size_t window)
+{
+  LOG(INFO) << "Coordinator attempting to write " << actions.size()
+            << " actions starting at position " << actions.front().position()
+            << " in batches of " << window;
+
+  CHECK(elected);
+
+  // Split the actions up into batch write requests.
+  vector<BatchWriteRequest> requests;
+
+  foreach (const Action& action, actions) {
+    if (requests.empty() || requests.back().writes_size() == (int) window) {
+      requests.push_back(BatchWriteRequest());
+      requests.back().set_id(id);
+    }
+
+    WriteRequest* request = requests.back().add_writes();
+    request->set_id(id);
+    request->set_position(action.position());
+    request->set_type(action.type());
+    switch (action.type()) {
+      case Action::NOP:
+        CHECK(action.has_nop());
+        request->mutable_nop();
+        break;
+      case Action::APPEND:
+        CHECK(action.has_append());
+        request->mutable_append()->MergeFrom(action.append());
+        break;
+      case Action::TRUNCATE:
+        CHECK(action.has_truncate());
+        request->mutable_truncate()->MergeFrom(action.truncate());
+        break;
+      default:
+        LOG(FATAL) << "Unknown Action::Type!";
+    }
+  }
+
+  // Pipeline the batches: the next batch gets sent (piggybacking the
+  // positions committed so far) before waiting on the current one.
+  vector<set<Future<BatchWriteResponse> > > futures(requests.size());
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    if (i == 0) {
+      futures[i] = remotecast(protocol::batch, requests[i]);
+    }
+
+    if (i + 1 < requests.size()) {
+      foreach (uint64_t position, learned) {
+        requests[i + 1].add_learned(position);
+      }
+      learned.clear();
+      futures[i + 1] = remotecast(protocol::batch, requests[i + 1]);
+    }
+
+    Result<uint64_t> result = await(requests[i], &futures[i]);
+
+    if (result.isSome()) {
+      result = commit(requests[i]);
+    }
+
+    if (result.isError() || result.isNone()) {
+      // Discard the futures of the batch in flight (if any).
+      if (i + 1 < requests.size()) {
+        discard(futures[i + 1]);
+      }
+      flush();
+      return result;
+    }
+
+    CHECK(result.isSome());
+    index = result.get() + 1;
+  }
+
+  // Nothing follows the last batch to piggyback its positions on.
+  flush();
+
+  return index - 1;
+}
+
+
+Result<uint64_t> Coordinator::await(
+    const BatchWriteRequest& request,
+    set<Future<BatchWriteResponse> >* futures)
+{
+  Option<Future<BatchWriteResponse> > option;
+  int okays = 0;
+
+  Timeout timeout = 1.0; // TODO(benh): Have timeout get passed in!
+
+  // N.B. Using (quorum - 1) here since the local replica is excluded!
+  while (okays < (quorum - 1)) {
+    option = select(*futures, timeout.remaining());
+    if (option.isNone()) {
+      // Timed out ...
+      discard(*futures);
+      return Result<uint64_t>::none();
+    }
+
+    CHECK(option.get().isReady());
+    const BatchWriteResponse& response = option.get().get();
+    CHECK(response.id() == request.id());
+
+    if (!response.okay()) {
+      discard(*futures);
+      elected = false;
+      return Result<uint64_t>::error("Coordinator demoted");
+    }
+
+    CHECK(response.positions_size() == request.writes_size());
+    okays++;
+    futures->erase(option.get());
+  }
+
+  // Got enough remote okays, discard the remaining futures.
+  discard(*futures);
+
+  return request.writes(request.writes_size() - 1).position();
+}
+
+
+Result<uint64_t> Coordinator::commit(const BatchWriteRequest& request)
+{
+  const uint64_t first = request.writes(0).position();
+  const uint64_t last = request.writes(request.writes_size() - 1).position();
+
+  LOG(INFO) << "Coordinator attempting to commit positions "
+            << first << " -> " << last;
+
+  CHECK(elected);
+
+  // A commit is just a learned write (see Coordinator::commit above),
+  // and the local replica doesn't need any piggybacked positions.
+  BatchWriteRequest commit;
+  commit.set_id(request.id());
+  commit.mutable_writes()->MergeFrom(request.writes());
+
+  for (int i = 0; i < commit.writes_size(); i++) {
+    commit.mutable_writes(i)->set_learned(true);
+  }
+
+  Future<BatchWriteResponse> future =
+    protocol::batch(replica->pid(), commit);
+
+  future.await(); // TODO(benh): Let it timeout, but consider it a failure.
+
+  if (future.isFailed()) {
+    return Result<uint64_t>::error(future.failure());
+  }
+
+  CHECK(future.isReady()) << "Not expecting a discarded future!";
+
+  const BatchWriteResponse& response = future.get();
+  CHECK(response.id() == request.id());
+
+  if (!response.okay()) {
+    elected = false;
+    return Result<uint64_t>::error("Coordinator demoted");
+  }
+
+  // Commit successful, the remote replicas learn these positions with
+  // the next batch write request (or flush).
+  for (int i = 0; i < request.writes_size(); i++) {
+    learned.push_back(request.writes(i).position());
+  }
+
+  return last;
+}
+
+
+void Coordinator::flush()
+{
+  if (learned.empty()) {
+    return;
+  }
+
+  BatchWriteRequest request;
+  request.set_id(id);
+
+  foreach (uint64_t position, learned) {
+    request.add_learned(position);
+  }
+
+  learned.clear();
+
+  // Like a learned message we don't wait for any responses.
+  set<Future<BatchWriteResponse> > futures =
+    remotecast(protocol::batch, request);
+
+  discard(futures);
+}
+
+
 Result<Action> Coordinator::fill(uint64_t position)
 {
   LOG(INFO) << "Coordinator attempting to fill position "
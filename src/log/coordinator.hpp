@@ -1,6 +1,8 @@
 #ifndef __LOG_COORDINATOR_HPP__
 #define __LOG_COORDINATOR_HPP__
 
+#include <list>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -44,6 +46,20 @@ public:
   // but can be retried.
   Result<uint64_t> append(const std::string& bytes);
 
+  // Returns the result of trying to append the specified entries (in
+  // order) to consecutive positions. The entries get written in
+  // batches of at most 'window' positions (each batch costs a single
+  // synchronous write on each replica) and the next batch is sent
+  // while waiting for the current one, so up to two batches are in
+  // flight. A some result returns the position of the last entry. A
+  // result of none means the append failed (e.g., due to timeout),
+  // but can be retried (some of the entries may have been appended).
+  // Remote replicas learn the last batch with the next write (or when
+  // the coordinator gets demoted).
+  Result<uint64_t> append(
+      const std::list<std::string>& entries,
+      size_t window = 128);
+
   // Returns the result of trying to truncate the log (from the
   // beginning to the specified position exclusive). A result of
   // none means the truncate failed (e.g., due to timeout), but can be
@@ -60,6 +76,24 @@ private:
   // local replica and then sending out learned messages).
   Result<uint64_t> commit(const Action& action);
 
+  // Helpers like write and commit but for a batch of actions (for
+  // consecutive positions). Rather than sending learned messages the
+  // committed positions get piggybacked on the next batch written
+  // (and whatever is left gets flushed before returning).
+  Result<uint64_t> write(const std::list<Action>& actions, size_t window);
+  Result<uint64_t> commit(const BatchWriteRequest& request);
+
+  // Helper that waits for a quorum of the remote replicas to accept
+  // a batch write request.
+  Result<uint64_t> await(
+      const BatchWriteRequest& request,
+      std::set<Future<BatchWriteResponse> >* futures);
+
+  // Helper that sends out the committed positions that have not yet
+  // been piggybacked on a batch write request (without waiting for
+  // any responses, like a learned message).
+  void flush();
+
   // Helper that tries to fill a position in the log.
   Result<Action> fill(uint64_t position);
 
@@ -91,6 +125,11 @@ private:
   uint64_t id; // Coordinator ID.
 
   uint64_t index; // Last position written in the log.
+
+  // Positions committed locally during a batched write that the
+  // remote replicas have not been told about yet (see
+  // BatchWriteRequest).
+  std::vector<uint64_t> learned;
 };
 
 } // namespace log {
@@ -136,6 +136,14 @@ public:
     // Writer must be created.
     Result<Position> append(const std::string& data);
 
+    // Attempts to append each of the specified data (in order) to the
+    // log, writing them in pipelined batches (see
+    // Coordinator::append). A none result means the operation timed
+    // out (some of the data may have been appended), otherwise the
+    // new ending position of the log is returned or an error. Upon
+    // error a new Writer must be created.
+    Result<Position> append(const std::list<std::string>& data);
+
     // Attempts to truncate the log up to but not including the
     // specificed position. A none result means the operation timed
     // out, otherwise the new ending position of the log is returned
@@ -366,6 +374,29 @@ Result<Log::Position> Log::Writer::append(const std::string& data)
 }
 
 
+Result<Log::Position> Log::Writer::append(const std::list<std::string>& data)
+{
+  if (error.isSome()) {
+    return Result<Log::Position>::error(error.get());
+  }
+
+  LOG(INFO) << "Attempting to append " << data.size() << " entries to the log";
+
+  Result<uint64_t> result = coordinator.append(data);
+
+  if (result.isError()) {
+    error = result.error();
+    return Result<Log::Position>::error(error.get());
+  } else if (result.isNone()) {
+    return Result<Log::Position>::none();
+  }
+
+  CHECK(result.isSome());
+
+  return Log::Position(result.get());
+}
+
+
 Result<Log::Position> Log::Writer::truncate(const Log::Position& to)
 {
   if (error.isSome()) {
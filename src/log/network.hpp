@@ -47,6 +47,9 @@ public:
   // Set the PIDs that are part of this network.
   void set(const std::set<process::UPID>& pids);
 
+  // Returns the PIDs that are currently part of this network.
+  process::Future<std::set<process::UPID> > members();
+
   // Sends a request to each member of the network and returns a set
   // of futures that represent their responses.
   template <typename Req, typename Res>
@@ -127,6 +130,11 @@ public:
     }
   }
 
+  std::set<process::UPID> members()
+  {
+    return pids;
+  }
+
   // Sends a request to each of the groups members and returns a set
   // of futures that represent their responses.
   template <typename Req, typename Res>
@@ -208,6 +216,12 @@ inline void Network::set(const std::set<process::UPID>& pids)
 }
 
 
+inline process::Future<std::set<process::UPID> > Network::members()
+{
+  return process::dispatch(process, &NetworkProcess::members);
+}
+
+
 template <typename Req, typename Res>
 process::Future<std::set<process::Future<Res> > > Network::broadcast(
     const Protocol<Req, Res>& protocol,
@@ -3,12 +3,19 @@
 #include <leveldb/write_batch.h>
 
 #include <algorithm>
+#include <deque>
+#include <map>
+#include <sstream>
+#include <vector>
 
 #include <process/dispatch.hpp>
 #include <process/protobuf.hpp>
+#include <process/timer.hpp>
 
+#include "common/json.hpp"
 #include "common/utils.hpp"
 
+#include "log/cache.hpp"
 #include "log/replica.hpp"
 
 #include "messages/log.hpp"
@@ -20,6 +27,7 @@ using process::wait; // Necessary on some OS's to disambiguate.
 using std::list;
 using std::set;
 using std::string;
+using std::vector;
 
 
 namespace mesos {
@@ -31,6 +39,7 @@ namespace protocol {
 // Some replica protocol definitions.
 Protocol<PromiseRequest, PromiseResponse> promise;
 Protocol<WriteRequest, WriteResponse> write;
+Protocol<BatchWriteRequest, BatchWriteResponse> batch;
 Protocol<LearnRequest, LearnResponse> learn;
 
 } // namespace protocol {
@@ -41,7 +50,7 @@ struct State
   uint64_t coordinator; // Last promise made to a coordinator.
   uint64_t begin; // Beginning position of the log.
   uint64_t end; // Ending position of the log.
-  std::set<uint64_t> learned; // Positions present and learned
+  std::set<uint64_t> holes; // Positions (up to the end) not present.
   std::set<uint64_t> unlearned; // Positions present but unlearned.
 };
 
@@ -54,10 +63,31 @@ public:
   virtual Try<State> recover(const string& path) = 0;
   virtual Try<void> persist(const Promise& promise) = 0;
   virtual Try<void> persist(const Action& action) = 0;
+  virtual Try<void> persist(const list<Action>& actions) = 0;
   virtual Try<Action> read(uint64_t position) = 0;
+
+  // Persists a checkpoint of the specified state so that recovering
+  // doesn't need to read every action written up to this point.
+  virtual Try<void> checkpoint(const State& state) = 0;
+
+  // Returns the actions present in storage between the specified
+  // positions (inclusive), in order.
+  virtual Try<list<Action> > read(uint64_t from, uint64_t to) = 0;
+
+  // Deletes up to 'limit' of the positions that have been truncated
+  // (i.e., are below the beginning of the log). Returns true once all
+  // truncated positions have been deleted.
+  virtual Try<bool> reclaim(size_t limit) = 0;
 };
 
 
+// Keys of the checkpoint record and the prefix of the "dirty" markers
+// (see LevelDBStorage::dirty), both sort after every position (all
+// digits) so scanning the positions in the log is unaffected.
+static const string CHECKPOINT_KEY = "checkpoint";
+static const string DIRTY_PREFIX = "dirty/";
+
+
 // Concrete implementation of the storage interface using leveldb.
 class LevelDBStorage : public Storage
 {
@@ -68,7 +98,11 @@ public:
   virtual Try<State> recover(const string& path);
   virtual Try<void> persist(const Promise& promise);
   virtual Try<void> persist(const Action& action);
+  virtual Try<void> persist(const list<Action>& actions);
   virtual Try<Action> read(uint64_t position);
+  virtual Try<list<Action> > read(uint64_t from, uint64_t to);
+  virtual Try<void> checkpoint(const State& state);
+  virtual Try<bool> reclaim(size_t limit);
 
 private:
   class Varint64Comparator : public leveldb::Comparator
@@ -142,14 +176,69 @@ private:
     return position.get();
   }
 
+  // Key of the marker for a position written at or before the end of
+  // the last checkpoint (e.g., filling a hole or learning a position)
+  // which must be re-read when recovering from that checkpoint.
+  static string dirty(uint64_t position)
+  {
+    return DIRTY_PREFIX + stringify(position);
+  }
+
+  // Updates the state to reflect the action (when recovering).
+  static void update(State* state, const Action& action);
+
   // Varint64Comparator comparator; // TODO(benh): Use varint comparator.
 
   leveldb::DB* db;
+
+  // Ending position of the last checkpoint (if any).
+  Option<uint64_t> checkpointed;
+
+  // Positions before 'truncated' have been truncated (the logical
+  // low-water mark) and positions before 'reclaimed' have actually
+  // been deleted.
+  uint64_t truncated;
+  uint64_t reclaimed;
 };
 
 
+// Run-length encodes the positions as ranges.
+static void encode(
+    const set<uint64_t>& positions,
+    google::protobuf::RepeatedPtrField<Checkpoint::Range>* ranges)
+{
+  foreach (uint64_t position, positions) {
+    int last = ranges->size() - 1;
+    if (last >= 0 && ranges->Get(last).to() + 1 == position) {
+      ranges->Mutable(last)->set_to(position);
+    } else {
+      Checkpoint::Range* range = ranges->Add();
+      range->set_from(position);
+      range->set_to(position);
+    }
+  }
+}
+
+
+static void decode(
+    const google::protobuf::RepeatedPtrField<Checkpoint::Range>& ranges,
+    set<uint64_t>* positions)
+{
+  for (int i = 0; i < ranges.size(); i++) {
+    for (uint64_t position = ranges.Get(i).from();
+         position <= ranges.Get(i).to();
+         position++) {
+      positions->insert(positions->end(), position);
+    }
+  }
+}
+
+
 LevelDBStorage::LevelDBStorage()
-  : db(NULL)
+  : db(NULL),
+    checkpointed(Option<uint64_t>::none()),
+    truncated(0),
+    reclaimed(0)
 {
   // Nothing to see here.
 }
@@ -195,11 +284,95 @@ Try<State> LevelDBStorage::recover(const string& path)
   state.begin = 0;
   state.end = 0;
 
+  string value;
+
+  // Get the last promise (if any).
+  status = db->Get(leveldb::ReadOptions(), stringify(0), &value);
+
+  if (status.ok()) {
+    Record record;
+
+    if (!record.ParseFromString(value) || record.type() != Record::PROMISE) {
+      return Try<State>::error("Bad promise record");
+    }
+
+    CHECK(record.has_promise());
+    state.coordinator = record.promise().id();
+  } else if (!status.IsNotFound()) {
+    return Try<State>::error(status.ToString());
+  }
+
+  // Next position to scan for, any positions skipped are holes.
+  uint64_t next = 0;
+
+  // Start from the last checkpoint (if any), in which case we only
+  // need to re-read the positions written since the checkpoint.
+  status = db->Get(leveldb::ReadOptions(), CHECKPOINT_KEY, &value);
+
+  if (status.ok()) {
+    Record record;
+
+    if (!record.ParseFromString(value) || record.type() != Record::CHECKPOINT) {
+      return Try<State>::error("Bad checkpoint record");
+    }
+
+    CHECK(record.has_checkpoint());
+    const Checkpoint& checkpoint = record.checkpoint();
+
+    state.coordinator = std::max(state.coordinator, checkpoint.coordinator());
+    state.begin = checkpoint.begin();
+    state.end = checkpoint.end();
+    decode(checkpoint.holes(), &state.holes);
+    decode(checkpoint.unlearned(), &state.unlearned);
+
+    checkpointed = checkpoint.end();
+
+    next = checkpoint.end() + 1;
+
+    // Re-read the positions written at or before the end of the
+    // checkpoint since it was taken.
+    leveldb::Iterator* iterator = db->NewIterator(leveldb::ReadOptions());
+
+    iterator->Seek(DIRTY_PREFIX);
+
+    while (iterator->Valid() && iterator->key().starts_with(DIRTY_PREFIX)) {
+      leveldb::Slice key = iterator->key();
+      key.remove_prefix(DIRTY_PREFIX.size());
+      uint64_t position = LevelDBStorage::position(key);
+
+      status = db->Get(leveldb::ReadOptions(), stringify(position + 1), &value);
+
+      if (status.ok()) {
+        Record record;
+
+        if (!record.ParseFromString(value) || record.type() != Record::ACTION) {
+          delete iterator;
+          return Try<State>::error("Bad action record");
+        }
+
+        CHECK(record.has_action());
+        update(&state, record.action());
+      } else if (!status.IsNotFound()) { // Not found means truncated.
+        delete iterator;
+        return Try<State>::error(status.ToString());
+      }
+
+      iterator->Next();
+    }
+
+    delete iterator;
+  } else if (!status.IsNotFound()) {
+    return Try<State>::error(status.ToString());
+  }
+
+  // Now scan the positions after the checkpoint (or the entire log if
+  // there is no checkpoint).
   leveldb::Iterator* iterator = db->NewIterator(leveldb::ReadOptions());
 
-  iterator->SeekToFirst();
+  iterator->Seek(stringify(next + 1));
 
-  while (iterator->Valid()) {
+  // Stop at the first key that isn't a position (see CHECKPOINT_KEY).
+  while (iterator->Valid() && isdigit(iterator->key()[0])) {
     const leveldb::Slice& slice = iterator->value();
 
     google::protobuf::io::ArrayInputStream stream(slice.data(), slice.size());
@@ -207,48 +380,67 @@ Try<State> LevelDBStorage::recover(const string& path)
     Record record;
 
     if (!record.ParseFromZeroCopyStream(&stream)) {
+      delete iterator;
       return Try<State>::error("Failed to deserialize record");
     }
 
-    switch (record.type()) {
-      case Record::PROMISE: {
-        CHECK(record.has_promise());
-        const Promise& promise = record.promise();
-        state.coordinator = promise.id();
-        break;
-      }
+    if (record.type() != Record::ACTION) {
+      delete iterator;
+      return Try<State>::error("Bad record");
+    }
 
-      case Record::ACTION: {
-        CHECK(record.has_action());
-        const Action& action = record.action();
-        if (action.has_learned() && action.learned()) {
-          state.learned.insert(action.position());
-          state.unlearned.erase(action.position());
-          if (action.has_type() && action.type() == Action::TRUNCATE) {
-            state.begin = std::max(state.begin, action.truncate().to());
-          }
-        } else {
-          state.learned.erase(action.position());
-          state.unlearned.insert(action.position());
-        }
-        state.end = std::max(state.end, action.position());
-        break;
-      }
+    CHECK(record.has_action());
+    const Action& action = record.action();
 
-      default: {
-        return Try<State>::error("Bad record");
-      }
+    for (; next < action.position(); next++) {
+      state.holes.insert(next);
     }
 
+    next = action.position() + 1;
+
+    update(&state, action);
+
     iterator->Next();
   }
 
   delete iterator;
 
+  // We need to assume that position 0 is a hole for a brand new log
+  // (a coordinator will simply fill it with a no-op when it first
+  // gets elected).
+  if (next == 0) {
+    state.holes.insert(0);
+  }
+
+  truncated = state.begin;
+
+  // Positions that have since been truncated are neither holes nor
+  // unlearned.
+  state.holes.erase(
+      state.holes.begin(), state.holes.lower_bound(state.begin));
+  state.unlearned.erase(
+      state.unlearned.begin(), state.unlearned.lower_bound(state.begin));
+
   return state;
 }
 
 
+void LevelDBStorage::update(State* state, const Action& action)
+{
+  if (action.has_learned() && action.learned()) {
+    state->unlearned.erase(action.position());
+    if (action.has_type() && action.type() == Action::TRUNCATE) {
+      state->begin = std::max(state->begin, action.truncate().to());
+    }
+  } else {
+    state->unlearned.insert(action.position());
+  }
+
+  state->holes.erase(action.position());
+  state->end = std::max(state->end, action.position());
+}
+
+
 Try<void> LevelDBStorage::persist(const Promise& promise)
 {
   leveldb::WriteOptions options;
@@ -276,37 +468,119 @@ Try<void> LevelDBStorage::persist(const Promise& promise)
 
 Try<void> LevelDBStorage::persist(const Action& action)
 {
+  return persist(list<Action>(1, action));
+}
+
+
+Try<void> LevelDBStorage::persist(const list<Action>& actions)
+{
+  // All of the actions go into a single batch so that persisting
+  // many actions costs a single (synchronous) write to disk.
   leveldb::WriteBatch batch;
 
-  // Delete positions only if a truncate action has been *learned*.
-  // TODO(benh): Consider doing this asynchronously (but will require
-  // synchronization on the underlying DB).
-  if (action.has_learned() && action.learned() &&
-      action.has_type() && action.type() == Action::TRUNCATE) {
-    CHECK(action.has_truncate());
+  foreach (const Action& action, actions) {
+    Record record;
+    record.set_type(Record::ACTION);
+    record.mutable_action()->MergeFrom(action);
 
-    leveldb::Iterator* iterator = db->NewIterator(leveldb::ReadOptions());
+    string value;
 
-    iterator->Seek(stringify(1)); // The actual "beginning" of the log.
+    if (!record.SerializeToString(&value)) {
+      return Try<void>::error("Failed to serialize record");
+    }
 
-    const string& to = stringify(action.truncate().to() + 1);
+    batch.Put(stringify(action.position() + 1), value);
 
-    while (iterator->Valid()) {
-      // Only iterate as far as (but excluding) the truncate position.
-      // TODO(benh): Use varint comparator.
-      if (leveldb::BytewiseComparator()->Compare(iterator->key(), to) >= 0) {
-        break;
-      }
-      batch.Delete(iterator->key());
-      iterator->Next();
+    if (checkpointed.isSome() && action.position() <= checkpointed.get()) {
+      batch.Put(dirty(action.position()), "");
     }
+  }
 
-    delete iterator;
+  leveldb::WriteOptions options;
+  options.sync = true;
+
+  leveldb::Status status = db->Write(options, &batch);
+
+  if (!status.ok()) {
+    return Try<void>::error(status.ToString());
+  }
+
+  // A learned truncate just moves the low-water mark, the truncated
+  // positions get deleted in the background (see reclaim).
+  foreach (const Action& action, actions) {
+    if (action.has_learned() && action.learned() &&
+        action.has_type() && action.type() == Action::TRUNCATE) {
+      CHECK(action.has_truncate());
+      truncated = std::max(truncated, action.truncate().to());
+    }
+  }
+
+  return Try<void>::some();
+}
+
+
+Try<bool> LevelDBStorage::reclaim(size_t limit)
+{
+  leveldb::WriteBatch batch;
+
+  leveldb::Iterator* iterator = db->NewIterator(leveldb::ReadOptions());
+
+  // Start after the positions already deleted (rather than at the
+  // actual "beginning" of the log, i.e., stringify(1)) so we don't
+  // have to skip over their deletions each time.
+  iterator->Seek(stringify(reclaimed + 1));
+
+  const string& to = stringify(truncated + 1);
+
+  size_t deleted = 0;
+
+  while (iterator->Valid() && deleted < limit) {
+    // Only iterate as far as (but excluding) the truncate position.
+    // TODO(benh): Use varint comparator.
+    if (leveldb::BytewiseComparator()->Compare(iterator->key(), to) >= 0) {
+      break;
+    }
+    batch.Delete(iterator->key());
+    deleted++;
+    iterator->Next();
+  }
+
+  // Done once we've reached the truncate position (or the end).
+  bool done = !iterator->Valid() ||
+    leveldb::BytewiseComparator()->Compare(iterator->key(), to) >= 0;
+
+  uint64_t next = done ? truncated : position(iterator->key()) - 1;
+
+  delete iterator;
+
+  if (deleted > 0) {
+    // No need to sync, positions that don't get deleted because of a
+    // failure are below the mark and just get reclaimed again later.
+    leveldb::Status status = db->Write(leveldb::WriteOptions(), &batch);
+
+    if (!status.ok()) {
+      return Try<bool>::error(status.ToString());
+    }
   }
 
+  reclaimed = next;
+
+  return done;
+}
+
+
+Try<void> LevelDBStorage::checkpoint(const State& state)
+{
+  Checkpoint checkpoint;
+  checkpoint.set_coordinator(state.coordinator);
+  checkpoint.set_begin(state.begin);
+  checkpoint.set_end(state.end);
+  encode(state.holes, checkpoint.mutable_holes());
+  encode(state.unlearned, checkpoint.mutable_unlearned());
+
   Record record;
-  record.set_type(Record::ACTION);
-  record.mutable_action()->MergeFrom(action);
+  record.set_type(Record::CHECKPOINT);
+  record.mutable_checkpoint()->MergeFrom(checkpoint);
 
   string value;
 
@@ -314,7 +588,22 @@ Try<void> LevelDBStorage::persist(const Action& action)
     return Try<void>::error("Failed to serialize record");
   }
 
-  batch.Put(stringify(action.position() + 1), value);
+  leveldb::WriteBatch batch;
+
+  batch.Put(CHECKPOINT_KEY, value);
+
+  // The positions written since the last checkpoint are covered by
+  // this checkpoint, so their markers can go.
+  leveldb::Iterator* iterator = db->NewIterator(leveldb::ReadOptions());
+
+  iterator->Seek(DIRTY_PREFIX);
+
+  while (iterator->Valid() && iterator->key().starts_with(DIRTY_PREFIX)) {
+    batch.Delete(iterator->key());
+    iterator->Next();
+  }
+
+  delete iterator;
 
   leveldb::WriteOptions options;
   options.sync = true;
@@ -325,12 +614,19 @@ Try<void> LevelDBStorage::persist(const Action& action)
     return Try<void>::error(status.ToString());
   }
 
+  checkpointed = state.end;
+
   return Try<void>::some();
 }
 
 
 Try<Action> LevelDBStorage::read(uint64_t position)
 {
+  // Truncated positions might not have been deleted yet.
+  if (position < truncated) {
+    return Try<Action>::error("Attempted to read truncated position");
+  }
+
   string value;
 
   leveldb::ReadOptions options;
@@ -357,6 +653,85 @@ Try<Action> LevelDBStorage::read(uint64_t position)
 }
 
 
+Try<list<Action> > LevelDBStorage::read(uint64_t from, uint64_t to)
+{
+  // Rather than a Get per position do a single pass with an iterator.
+  list<Action> actions;
+
+  // Skip truncated positions (which might not have been deleted yet).
+  from = std::max(from, truncated);
+
+  if (from > to) {
+    return actions;
+  }
+
+  leveldb::Iterator* iterator = db->NewIterator(leveldb::ReadOptions());
+
+  iterator->Seek(stringify(from + 1));
+
+  const string& last = stringify(to + 1);
+
+  while (iterator->Valid()) {
+    // Only iterate as far as (and including) the last position.
+    // TODO(benh): Use varint comparator.
+    if (leveldb::BytewiseComparator()->Compare(iterator->key(), last) > 0) {
+      break;
+    }
+
+    const leveldb::Slice& slice = iterator->value();
+
+    google::protobuf::io::ArrayInputStream stream(slice.data(), slice.size());
+
+    Record record;
+
+    if (!record.ParseFromZeroCopyStream(&stream)) {
+      delete iterator;
+      return Try<list<Action> >::error("Failed to deserialize record");
+    }
+
+    if (record.type() != Record::ACTION) {
+      delete iterator;
+      return Try<list<Action> >::error("Bad record");
+    }
+
+    actions.push_back(record.action());
+
+    iterator->Next();
+  }
+
+  if (!iterator->status().ok()) {
+    const string& error = iterator->status().ToString();
+    delete iterator;
+    return Try<list<Action> >::error(error);
+  }
+
+  delete iterator;
+
+  return actions;
+}
+
+
+// Number of recently written actions a replica keeps in memory so
+// that reading the tail of the log doesn't have to go to leveldb.
+static const int CACHE_CAPACITY = 1024;
+
+// Number of actions a replica persists between checkpoints of its
+// state (see Storage::checkpoint).
+static const uint64_t CHECKPOINT_INTERVAL = 1000;
+
+// Flow control for catching up: the number of positions asked for in
+// a single catch up request, the number of requests in flight at a
+// time, and how long to wait for a response before asking another
+// replica instead.
+static const uint64_t CATCHUP_RANGE = 1000;
+static const size_t CATCHUP_WINDOW = 4;
+static const double CATCHUP_TIMEOUT = 5.0;
+
+// Number of truncated positions deleted at a time in the background
+// (in between handling other requests).
+static const size_t RECLAIM_CHUNK = 1000;
+
+
 class ReplicaProcess : public ProtobufProcess<ReplicaProcess>
 {
 public:
@@ -391,6 +766,20 @@ public:
   // Returns the highest implicit promise this replica has given.
   uint64_t promised();
 
+  // Catches up on the specified positions by learning them in bulk
+  // from the specified replicas (see Replica::catchup).
+  process::Promise<std::set<uint64_t> > catchup(
+      const std::set<uint64_t>& positions,
+      const std::set<UPID>& peers);
+
+  // Deletes a chunk of the truncated positions, continuing in the
+  // background (i.e., after any pending requests) until they've all
+  // been deleted.
+  void reclaim();
+
+  // Returns the cache hit and miss counts (as JSON) over HTTP.
+  process::Promise<HttpResponse> stats(const HttpRequest& request);
+
 private:
   // Handles a request from a coordinator to promise not to accept
   // writes from any other coordinator.
@@ -399,6 +788,10 @@ private:
   // Handles a request from a coordinator to write an action.
   void write(const WriteRequest& request);
 
+  // Handles a request from a coordinator to write a batch of actions
+  // (and learn some previously written positions).
+  void batch(const BatchWriteRequest& request);
+
   // Handles a request from a coordinator (or replica) to learn the
   // specified position in the log.
   void learn(uint64_t position);
@@ -406,10 +799,41 @@ private:
   // Handles a message notifying of a learned action.
   void learned(const Action& action);
 
+  // Handles a request from a (lagging) replica to learn the learned
+  // actions in a range of positions.
+  void learnRange(const CatchupRequest& request);
+
+  // Handles the learned actions in a range of positions (i.e., the
+  // response to a catch up request we made).
+  void learnedRange(const CatchupResponse& response);
+
+  // Handles a catch up request that hasn't been responded to in time.
+  void catchupTimedout(uint64_t id);
+
+  // Helper that returns the action that results from performing the
+  // specified write request. A none result means the request must be
+  // rejected (i.e., we have promised a newer coordinator) and an
+  // error result means the current action at the position could not
+  // be read.
+  Result<Action> perform(const WriteRequest& request);
+
   // Helper routines that write a record corresponding to the
   // specified argument. Returns true on success and false otherwise.
   bool persist(const Promise& promise);
   bool persist(const Action& action);
+  bool persist(const list<Action>& actions);
+
+  // Helper routine to checkpoint the state of the log (see
+  // Storage::checkpoint). Dispatched by persist so that it happens
+  // after (rather than adds to the latency of) the triggering write.
+  void checkpoint();
+
+  // Helper routines for catching up that send out as many catch up
+  // requests as flow control allows (or finish catching up if there
+  // is nothing left to ask for) and that queue up whatever remains
+  // missing in a range to be asked of the next replica.
+  void requestRanges();
+  void retryRange(uint64_t from, uint64_t to, size_t peer, size_t tried);
 
   // Helper routine to recover log (e.g., on restart).
   void recover(const std::string& path);
@@ -431,13 +855,61 @@ private:
 
   // Unlearned positions in the log.
   std::set<uint64_t> unlearned;
+
+  // Recently written (and learned) actions, kept up to date with
+  // storage since every write goes through ReplicaProcess::persist.
+  Cache<uint64_t, Action> cache;
+
+  // Reads (of positions that are not holes) served from the cache
+  // versus from storage.
+  uint64_t hits;
+  uint64_t misses;
+
+  // Actions persisted since the last checkpoint.
+  uint64_t uncheckpointed;
+
+  bool checkpointing; // True while a checkpoint is pending.
+
+  // State of catching up (if in progress).
+  struct Catchup
+  {
+    // A range of positions to ask for, asking the replicas in turn
+    // starting with 'peer' (having already asked 'tried' of them).
+    struct Range
+    {
+      uint64_t from;
+      uint64_t to;
+      size_t peer;
+      size_t tried;
+    };
+
+    std::vector<UPID> peers;
+    std::set<uint64_t> positions; // Positions still missing.
+    std::deque<Range> ranges; // Ranges left to ask for.
+    std::map<uint64_t, Range> outstanding; // Ranges asked for, by id.
+    process::Promise<std::set<uint64_t> > promise;
+  };
+
+  Catchup* catchingUp; // NULL unless catching up.
+
+  bool reclaiming; // True while deleting truncated positions.
+
+  uint64_t catchupId; // Id of the last catch up request.
 };
 
 
 ReplicaProcess::ReplicaProcess(const string& path)
   : coordinator(0),
     begin(0),
-    end(0)
+    end(0),
+    cache(CACHE_CAPACITY),
+    hits(0),
+    misses(0),
+    uncheckpointed(0),
+    checkpointing(false),
+    catchingUp(NULL),
+    reclaiming(false),
+    catchupId(0)
 {
   storage = new LevelDBStorage(); // TODO(benh): Factor out and expose storage.
 
@@ -450,6 +922,9 @@ ReplicaProcess::ReplicaProcess(const string& path)
   installProtobufHandler<WriteRequest>(
       &ReplicaProcess::write);
 
+  installProtobufHandler<BatchWriteRequest>(
+      &ReplicaProcess::batch);
+
   installProtobufHandler<LearnedMessage>(
       &ReplicaProcess::learned,
       &LearnedMessage::action);
@@ -457,11 +932,24 @@ ReplicaProcess::ReplicaProcess(const string& path)
   installProtobufHandler<LearnRequest>(
       &ReplicaProcess::learn,
       &LearnRequest::position);
+
+  installProtobufHandler<CatchupRequest>(
+      &ReplicaProcess::learnRange);
+
+  installProtobufHandler<CatchupResponse>(
+      &ReplicaProcess::learnedRange);
+
+  installHttpHandler("stats.json", &ReplicaProcess::stats);
 }
 
 
 ReplicaProcess::~ReplicaProcess()
 {
+  if (catchingUp != NULL) {
+    catchingUp->promise.fail("Replica terminated while catching up");
+    delete catchingUp;
+  }
+
   delete storage;
 }
 
@@ -476,6 +964,15 @@ Result<Action> ReplicaProcess::read(uint64_t position)
     return Result<Action>::none();
   }
 
+  Option<Action> cached = cache.get(position);
+
+  if (cached.isSome()) {
+    hits++;
+    return cached.get();
+  }
+
+  misses++;
+
   // Must exist in storage ...
   Try<Action> action = storage->read(position);
 
@@ -511,16 +1008,57 @@ process::Promise<list<Action> > ReplicaProcess::read(
 
   list<Action> actions;
 
-  for (uint64_t position = from; position <= to; position++) {
-    Result<Action> result = read(position);
+  // Serve as much of the range as possible from the cache (the tail
+  // of the log is usually there) ...
+  uint64_t position = from;
+
+  for (; position <= to; position++) {
+    if (holes.count(position) > 0) {
+      continue;
+    }
+
+    Option<Action> cached = cache.get(position);
+
+    if (cached.isNone()) {
+      break;
+    }
+
+    hits++;
+    actions.push_back(cached.get());
+  }
+
+  // ... and read the rest of it from storage in a single pass.
+  if (position <= to) {
+    Try<list<Action> > result = storage->read(position, to);
 
     if (result.isError()) {
       process::Promise<list<Action> > promise;
       promise.fail(result.error());
       return promise;
-    } else if (result.isSome()) {
-      actions.push_back(result.get());
     }
+
+    misses += result.get().size();
+
+    // Every position that isn't a hole must exist in storage.
+    list<Action>::const_iterator iterator = result.get().begin();
+
+    for (; position <= to; position++) {
+      if (holes.count(position) > 0) {
+        continue;
+      }
+
+      if (iterator == result.get().end() ||
+          iterator->position() != position) {
+        process::Promise<list<Action> > promise;
+        promise.fail("Missing position " + utils::stringify(position) +
+                     " in storage");
+        return promise;
+      }
+
+      ++iterator;
+    }
+
+    actions.insert(actions.end(), result.get().begin(), result.get().end());
   }
 
   return actions;
@@ -569,6 +1107,91 @@ uint64_t ReplicaProcess::promised()
 }
 
 
+process::Promise<set<uint64_t> > ReplicaProcess::catchup(
+    const set<uint64_t>& positions,
+    const set<UPID>& peers)
+{
+  if (catchingUp != NULL) {
+    process::Promise<set<uint64_t> > promise;
+    promise.fail("Already catching up");
+    return promise;
+  } else if (positions.empty() || peers.empty()) {
+    return positions;
+  }
+
+  LOG(INFO) << "Replica catching up on " << positions.size()
+            << " positions from " << peers.size() << " replicas";
+
+  catchingUp = new Catchup();
+  catchingUp->peers.assign(peers.begin(), peers.end());
+  catchingUp->positions = positions;
+
+  // Split the positions up into ranges, spreading the ranges across
+  // the replicas to ask.
+  foreach (uint64_t position, positions) {
+    std::deque<Catchup::Range>& ranges = catchingUp->ranges;
+    if (ranges.empty() || position - ranges.back().from >= CATCHUP_RANGE) {
+      Catchup::Range range;
+      range.from = position;
+      range.to = position;
+      range.peer = ranges.size() % peers.size();
+      range.tried = 0;
+      ranges.push_back(range);
+    } else {
+      ranges.back().to = position;
+    }
+  }
+
+  // Save the promise since requesting ranges never finishes catching
+  // up here (there is at least one range to ask for).
+  process::Promise<set<uint64_t> > promise = catchingUp->promise;
+
+  requestRanges();
+
+  return promise;
+}
+
+
+void ReplicaProcess::reclaim()
+{
+  Try<bool> done = storage->reclaim(RECLAIM_CHUNK);
+
+  if (done.isError()) {
+    // Not fatal, the positions are already truncated, try again later.
+    LOG(ERROR) << "Error deleting truncated positions: " << done.error();
+    reclaiming = true;
+    delay(1.0, self(), &ReplicaProcess::reclaim);
+  } else if (!done.get()) {
+    reclaiming = true;
+    dispatch(self(), &ReplicaProcess::reclaim);
+  } else {
+    reclaiming = false;
+  }
+}
+
+
+process::Promise<HttpResponse> ReplicaProcess::stats(
+    const HttpRequest& request)
+{
+  JSON::Object object;
+  object.values["cache_hits"] = hits;
+  object.values["cache_misses"] = misses;
+  object.values["cache_hit_rate"] = hits + misses > 0
+    ? (double) hits / (hits + misses)
+    : 0.0;
+
+  std::ostringstream out;
+
+  JSON::render(out, object);
+
+  HttpOKResponse response;
+  response.headers["Content-Type"] = "text/x-json";
+  response.headers["Content-Length"] = utils::stringify(out.str().size());
+  response.body = out.str().data();
+  return response;
+}
+
+
 // Note that certain failures that occur result in returning from the
 // current function but *NOT* sending a 'nack' back to the coordinator
 // because that implies a coordinator has been demoted. Not sending
@@ -661,102 +1284,166 @@ void ReplicaProcess::promise(const PromiseRequest& request)
 
 void ReplicaProcess::write(const WriteRequest& request)
 {
-  Result<Action> result = read(request.position());
+  Result<Action> action = perform(request);
 
-  if (result.isError()) {
-    LOG(ERROR) << "Error getting log record at " << request.position()
-               << ": " << result.error();
-  } else if (result.isNone()) {
-    if (request.id() < coordinator) {
+  if (action.isError()) {
+    LOG(ERROR) << action.error();
+  } else if (action.isNone()) {
+    WriteResponse response;
+    response.set_okay(false);
+    response.set_id(request.id());
+    response.set_position(request.position());
+    send(from(), response);
+  } else {
+    CHECK(action.isSome());
+    if (persist(action.get())) {
       WriteResponse response;
-      response.set_okay(false);
+      response.set_okay(true);
       response.set_id(request.id());
       response.set_position(request.position());
       send(from(), response);
-    } else {
-      Action action;
-      action.set_position(request.position());
-      action.set_promised(coordinator);
-      action.set_performed(request.id());
-      if (request.has_learned()) action.set_learned(request.learned());
-      action.set_type(request.type());
-
-      switch (request.type()) {
-        case Action::NOP:
-          CHECK(request.has_nop());
-          action.mutable_nop();
-          break;
-        case Action::APPEND:
-          CHECK(request.has_append());
-          action.mutable_append()->MergeFrom(request.append());
-          break;
-        case Action::TRUNCATE:
-          CHECK(request.has_truncate());
-          action.mutable_truncate()->MergeFrom(request.truncate());
-          break;
-        default:
-          LOG(FATAL) << "Unknown Action::Type!";
-      }
-
-      if (persist(action)) {
-        WriteResponse response;
-        response.set_okay(true);
-        response.set_id(request.id());
-        response.set_position(request.position());
-        send(from(), response);
-      }
     }
-  } else if (result.isSome()) {
-    Action action = result.get();
-    CHECK(action.position() == request.position());
+  }
+}
 
-    if (request.id() < action.promised()) {
-      WriteResponse response;
+
+void ReplicaProcess::batch(const BatchWriteRequest& request)
+{
+  list<Action> actions;
+
+  for (int i = 0; i < request.writes_size(); i++) {
+    const WriteRequest& write = request.writes(i);
+    CHECK(write.id() == request.id());
+
+    Result<Action> action = perform(write);
+
+    if (action.isError()) {
+      LOG(ERROR) << action.error();
+      return;
+    } else if (action.isNone()) {
+      BatchWriteResponse response;
       response.set_okay(false);
       response.set_id(request.id());
-      response.set_position(request.position());
       send(from(), response);
-    } else {
-      // TODO(benh): Check if this position has already been learned,
-      // and if so, check that we are re-writing the same value!
-      action.set_performed(request.id());
-      action.clear_learned();
-      if (request.has_learned()) action.set_learned(request.learned());
-      action.clear_type();
-      action.clear_nop();
-      action.clear_append();
-      action.clear_truncate();
-      action.set_type(request.type());
-
-      switch (request.type()) {
-        case Action::NOP:
-          CHECK(request.has_nop());
-          action.mutable_nop();
-          break;
-        case Action::APPEND:
-          CHECK(request.has_append());
-          action.mutable_append()->MergeFrom(request.append());
-          break;
-        case Action::TRUNCATE:
-          CHECK(request.has_truncate());
-          action.mutable_truncate()->MergeFrom(request.truncate());
-          break;
-        default:
-          LOG(FATAL) << "Unknown Action::Type!";
-      }
+      return;
+    }
 
-      if (persist(action)) {
-        WriteResponse response;
-        response.set_okay(true);
-        response.set_id(request.id());
-        response.set_position(request.position());
-        send(from(), response);
-      }
+    CHECK(action.isSome());
+    actions.push_back(action.get());
+  }
+
+  // Learn the piggybacked positions too, but only those that still
+  // have the action this coordinator wrote (i.e., the action that got
+  // learned). We might not have a position at all if we missed the
+  // write, in which case it gets filled in later.
+  for (int i = 0; i < request.learned_size(); i++) {
+    Result<Action> result = read(request.learned(i));
+
+    if (result.isError()) {
+      LOG(ERROR) << "Error getting log record at " << request.learned(i)
+                 << ": " << result.error();
+    } else if (result.isSome() &&
+               result.get().has_performed() &&
+               result.get().performed() == request.id() &&
+               !(result.get().has_learned() && result.get().learned())) {
+      Action action = result.get();
+      action.set_learned(true);
+      actions.push_back(action);
+    }
+  }
+
+  if (actions.empty() || persist(actions)) {
+    BatchWriteResponse response;
+    response.set_okay(true);
+    response.set_id(request.id());
+    for (int i = 0; i < request.writes_size(); i++) {
+      response.add_positions(request.writes(i).position());
     }
+    send(from(), response);
   }
 }
 
 
+Result<Action> ReplicaProcess::perform(const WriteRequest& request)
+{
+  Result<Action> result = read(request.position());
+
+  if (result.isError()) {
+    return Result<Action>::error(
+        "Error getting log record at " +
+        utils::stringify(request.position()) + ": " + result.error());
+  } else if (result.isNone()) {
+    if (request.id() < coordinator) {
+      return Result<Action>::none();
+    }
+
+    Action action;
+    action.set_position(request.position());
+    action.set_promised(coordinator);
+    action.set_performed(request.id());
+    if (request.has_learned()) action.set_learned(request.learned());
+    action.set_type(request.type());
+
+    switch (request.type()) {
+      case Action::NOP:
+        CHECK(request.has_nop());
+        action.mutable_nop();
+        break;
+      case Action::APPEND:
+        CHECK(request.has_append());
+        action.mutable_append()->MergeFrom(request.append());
+        break;
+      case Action::TRUNCATE:
+        CHECK(request.has_truncate());
+        action.mutable_truncate()->MergeFrom(request.truncate());
+        break;
+      default:
+        LOG(FATAL) << "Unknown Action::Type!";
+    }
+
+    return action;
+  }
+
+  CHECK(result.isSome());
+  Action action = result.get();
+  CHECK(action.position() == request.position());
+
+  if (request.id() < action.promised()) {
+    return Result<Action>::none();
+  }
+
+  // TODO(benh): Check if this position has already been learned,
+  // and if so, check that we are re-writing the same value!
+  action.set_performed(request.id());
+  action.clear_learned();
+  if (request.has_learned()) action.set_learned(request.learned());
+  action.clear_type();
+  action.clear_nop();
+  action.clear_append();
+  action.clear_truncate();
+  action.set_type(request.type());
+
+  switch (request.type()) {
+    case Action::NOP:
+      CHECK(request.has_nop());
+      action.mutable_nop();
+      break;
+    case Action::APPEND:
+      CHECK(request.has_append());
+      action.mutable_append()->MergeFrom(request.append());
+      break;
+    case Action::TRUNCATE:
+      CHECK(request.has_truncate());
+      action.mutable_truncate()->MergeFrom(request.truncate());
+      break;
+    default:
+      LOG(FATAL) << "Unknown Action::Type!";
+  }
+
+  return action;
+}
+
+
 void ReplicaProcess::learned(const Action& action)
 {
   CHECK(action.learned());
@@ -769,6 +1456,165 @@ void ReplicaProcess::learned(const Action& action)
 }
 
 
+void ReplicaProcess::learnRange(const CatchupRequest& request)
+{
+  CatchupResponse response;
+  response.set_id(request.id());
+
+  // Only the positions we (still) have can be in the response.
+  uint64_t first = std::max(request.from(), begin);
+  uint64_t last = std::min(request.to(), end);
+
+  if (first <= last) {
+    Try<list<Action> > actions = storage->read(first, last);
+
+    if (actions.isError()) {
+      // Let the request time out, the requester will ask elsewhere.
+      LOG(ERROR) << "Error reading log records from " << first
+                 << " to " << last << ": " << actions.error();
+      return;
+    }
+
+    foreach (const Action& action, actions.get()) {
+      if (action.has_learned() && action.learned()) {
+        response.add_actions()->MergeFrom(action);
+      }
+    }
+  }
+
+  send(from(), response);
+}
+
+
+void ReplicaProcess::learnedRange(const CatchupResponse& response)
+{
+  if (catchingUp == NULL ||
+      catchingUp->outstanding.count(response.id()) == 0) {
+    return; // Must have timed out (or no longer catching up).
+  }
+
+  Catchup::Range range = catchingUp->outstanding[response.id()];
+  catchingUp->outstanding.erase(response.id());
+
+  list<Action> actions;
+
+  for (int i = 0; i < response.actions_size(); i++) {
+    const Action& action = response.actions(i);
+    if (action.has_learned() && action.learned() &&
+        action.position() >= range.from &&
+        action.position() <= range.to &&
+        catchingUp->positions.count(action.position()) > 0) {
+      actions.push_back(action);
+    }
+  }
+
+  if (!actions.empty()) {
+    if (!persist(actions)) {
+      // Give up, the caller can always fill the positions instead.
+      catchingUp->promise.set(catchingUp->positions);
+      delete catchingUp;
+      catchingUp = NULL;
+      return;
+    }
+
+    foreach (const Action& action, actions) {
+      catchingUp->positions.erase(action.position());
+    }
+
+    LOG(INFO) << "Replica caught up on " << actions.size()
+              << " positions between " << range.from << " and " << range.to;
+  }
+
+  retryRange(range.from, range.to, range.peer, range.tried);
+  requestRanges();
+}
+
+
+void ReplicaProcess::catchupTimedout(uint64_t id)
+{
+  if (catchingUp == NULL || catchingUp->outstanding.count(id) == 0) {
+    return; // Must have gotten a response.
+  }
+
+  Catchup::Range range = catchingUp->outstanding[id];
+  catchingUp->outstanding.erase(id);
+
+  LOG(WARNING) << "Replica timed out catching up on positions between "
+               << range.from << " and " << range.to;
+
+  retryRange(range.from, range.to, range.peer, range.tried);
+  requestRanges();
+}
+
+
+void ReplicaProcess::requestRanges()
+{
+  CHECK(catchingUp != NULL);
+
+  while (catchingUp->outstanding.size() < CATCHUP_WINDOW &&
+         !catchingUp->ranges.empty()) {
+    Catchup::Range range = catchingUp->ranges.front();
+    catchingUp->ranges.pop_front();
+
+    const vector<UPID>& peers = catchingUp->peers;
+    const UPID& peer = peers[(range.peer + range.tried) % peers.size()];
+
+    range.tried++;
+
+    CatchupRequest request;
+    request.set_id(++catchupId);
+    request.set_from(range.from);
+    request.set_to(range.to);
+    send(peer, request);
+
+    catchingUp->outstanding[request.id()] = range;
+
+    delay(CATCHUP_TIMEOUT, self(), &ReplicaProcess::catchupTimedout,
+          request.id());
+  }
+
+  if (catchingUp->outstanding.empty() && catchingUp->ranges.empty()) {
+    LOG(INFO) << "Replica finished catching up with "
+              << catchingUp->positions.size() << " positions still missing";
+
+    catchingUp->promise.set(catchingUp->positions);
+    delete catchingUp;
+    catchingUp = NULL;
+  }
+}
+
+
+void ReplicaProcess::retryRange(
+    uint64_t from,
+    uint64_t to,
+    size_t peer,
+    size_t tried)
+{
+  CHECK(catchingUp != NULL);
+
+  // Narrow the range down to the positions still missing.
+  const set<uint64_t>& positions = catchingUp->positions;
+
+  set<uint64_t>::const_iterator first = positions.lower_bound(from);
+  set<uint64_t>::const_iterator last = positions.upper_bound(to);
+
+  if (first == last) {
+    return; // Caught up on the entire range.
+  } else if (tried >= catchingUp->peers.size()) {
+    return; // None of the replicas have learned what remains.
+  }
+
+  Catchup::Range range;
+  range.from = *first;
+  range.to = *(--last);
+  range.peer = peer;
+  range.tried = tried;
+
+  // Retry before asking for new ranges.
+  catchingUp->ranges.push_front(range);
+}
+
+
 void ReplicaProcess::learn(uint64_t position)
 {
   Result<Action> result = read(position);
@@ -808,38 +1654,96 @@ bool ReplicaProcess::persist(const Promise& promise)
 
 bool ReplicaProcess::persist(const Action& action)
 {
-  Try<void> persisted = storage->persist(action);
+  return persist(list<Action>(1, action));
+}
+
+
+bool ReplicaProcess::persist(const list<Action>& actions)
+{
+  Try<void> persisted = storage->persist(actions);
 
   if (persisted.isError()) {
     LOG(ERROR) << "Error writing to log: " << persisted.error();
     return false;
   }
 
-  LOG(INFO) << "Persisted action at " << action.position();
+  foreach (const Action& action, actions) {
+    LOG(INFO) << "Persisted action at " << action.position();
 
-  // No longer a hole here (if there even was one).
-  holes.erase(action.position());
+    cache.put(action.position(), action);
 
-  // Update unlearned positions and deal with truncation actions.
-  if (action.has_learned() && action.learned()) {
-    unlearned.erase(action.position());
-    if (action.has_type() && action.type() == Action::TRUNCATE) {
-      begin = std::max(begin, action.truncate().to());
+    // No longer a hole here (if there even was one).
+    holes.erase(action.position());
+
+    // Update unlearned positions and deal with truncation actions.
+    if (action.has_learned() && action.learned()) {
+      unlearned.erase(action.position());
+      if (action.has_type() && action.type() == Action::TRUNCATE) {
+        begin = std::max(begin, action.truncate().to());
+        if (!reclaiming) {
+          reclaiming = true;
+          dispatch(self(), &ReplicaProcess::reclaim);
+        }
+      }
+    } else {
+      unlearned.insert(action.position());
+    }
+
+    // Update holes if we just wrote many positions past the last end.
+    for (uint64_t position = end + 1;
+         position < action.position();
+         position++) {
+      holes.insert(position);
     }
-  }
 
-  // Update holes if we just wrote many positions past the last end.
-  for (uint64_t position = end + 1; position < action.position(); position++) {
-    holes.insert(position);
+    // And update the end position.
+    end = std::max(end, action.position());
   }
 
-  // And update the end position.
-  end = std::max(end, action.position());
+  // Periodically checkpoint so recovering doesn't need to read every
+  // action in the log, but only once the write has been acknowledged
+  // (i.e., after any pending requests).
+  uncheckpointed += actions.size();
+
+  if (uncheckpointed >= CHECKPOINT_INTERVAL && !checkpointing) {
+    checkpointing = true;
+    dispatch(self(), &ReplicaProcess::checkpoint);
+  }
 
   return true;
 }
 
 
+void ReplicaProcess::checkpoint()
+{
+  checkpointing = false;
+
+  // Holes and unlearned positions that have been truncated don't
+  // need to be remembered.
+  holes.erase(holes.begin(), holes.lower_bound(begin));
+  unlearned.erase(unlearned.begin(), unlearned.lower_bound(begin));
+
+  State state;
+  state.coordinator = coordinator;
+  state.begin = begin;
+  state.end = end;
+  state.holes = holes;
+  state.unlearned = unlearned;
+
+  Try<void> checkpointed = storage->checkpoint(state);
+
+  if (checkpointed.isError()) {
+    // Not fatal, we'll just try again after the next write.
+    LOG(ERROR) << "Error checkpointing the log: " << checkpointed.error();
+    return;
+  }
+
+  LOG(INFO) << "Checkpointed the log at position " << end;
+
+  uncheckpointed = 0;
+}
+
+
 void ReplicaProcess::recover(const string& path)
 {
   Try<State> state = storage->recover(path);
@@ -851,24 +1755,7 @@ void ReplicaProcess::recover(const string& path)
   begin = state.get().begin;
   end = state.get().end;
   unlearned = state.get().unlearned;
-
-  // Only use the learned positions to help determine the holes.
-  const std::set<uint64_t>& learned = state.get().learned;
-
-  // We need to assume that position 0 is a hole for a brand new log
-  // (a coordinator will simply fill it with a no-op when it first
-  // gets elected), unless the position was found during recovery or
-  // it has been truncated.
-  if (learned.count(0) == 0 && unlearned.count(0) == 0 && begin == 0) {
-    holes.insert(0);
-  }
-
-  // Now determine the rest of the holes.
-  for (uint64_t position = begin; position < end; position++) {
-    if (learned.count(position) == 0 && unlearned.count(position) == 0) {
-      holes.insert(position);
-    }
-  }
+  holes = state.get().holes;
 
   LOG(INFO) << "Replica recovered with log positions "
             << begin << " -> " << end
@@ -881,6 +1768,10 @@ Replica::Replica(const std::string& path)
 {
   process = new ReplicaProcess(path);
   process::spawn(process);
+
+  // Delete any positions that got truncated but not deleted before
+  // the replica was last shut down.
+  process::dispatch(process, &ReplicaProcess::reclaim);
 }
 
 
@@ -924,6 +1815,14 @@ process::Future<uint64_t> Replica::promised()
 }
 
 
+process::Future<std::set<uint64_t> > Replica::catchup(
+    const std::set<uint64_t>& positions,
+    const std::set<process::UPID>& peers)
+{
+  return process::dispatch(process, &ReplicaProcess::catchup, positions, peers);
+}
+
+
 process::PID<ReplicaProcess> Replica::pid()
 {
   return process->self();
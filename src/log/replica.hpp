@@ -22,6 +22,7 @@ namespace protocol {
 // Some replica protocol declarations.
 extern Protocol<PromiseRequest, PromiseResponse> promise;
 extern Protocol<WriteRequest, WriteResponse> write;
+extern Protocol<BatchWriteRequest, BatchWriteResponse> batch;
 extern Protocol<LearnRequest, LearnResponse> learn;
 
 } // namespace protocol {
@@ -56,6 +57,14 @@ public:
   // Returns the highest implicit promise this replica has given.
   process::Future<uint64_t> promised();
 
+  // Catches up on the specified (missing) positions by learning them
+  // in bulk from the specified replicas. Returns the positions that
+  // none of the replicas had learned (i.e., those still missing).
+  // The replica keeps handling requests while catching up.
+  process::Future<std::set<uint64_t> > catchup(
+      const std::set<uint64_t>& positions,
+      const std::set<process::UPID>& peers);
+
   // Returns the PID associated with this replica.
   process::PID<ReplicaProcess> pid();
 
@@ -68,11 +68,22 @@ public:
       const SlaveID& slaveId,
       const Resources& resources) {}
 
+  // Whenever a task gets added to or removed from a framework (e.g.,
+  // launched, or reported by a re-registering slave) the master
+  // invokes these callbacks (after updating the framework).
+  virtual void taskAdded(Task* task) {}
+
+  virtual void taskRemoved(Task* task) {}
+
   // Whenever a framework that has filtered resources want's to revive
   // offers for those resources the master invokes this callback.
   virtual void offersRevived(Framework* framework) {}
 
   virtual void timerTick() {}
+
+  // Invoked by the master when an allocation the allocator deferred
+  // (by delaying Master::allocate) is due.
+  virtual void allocate() {}
 };
 
 } // namespace master {
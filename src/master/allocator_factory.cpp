@@ -17,6 +17,8 @@
  */
 
 #include "allocator_factory.hpp"
+#include "drf_allocator.hpp"
+#include "request_allocator.hpp"
 #include "simple_allocator.hpp"
 
 using namespace mesos::internal::master;
@@ -24,4 +26,6 @@ using namespace mesos::internal::master;
 DEFINE_FACTORY(Allocator, Master *)
 {
   registerClass<SimpleAllocator>("simple");
+  registerClass<DRFAllocator>("drf");
+  registerClass<RequestAllocator>("request");
 }
@@ -0,0 +1,410 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <glog/logging.h>
+
+#include "common/utils.hpp"
+
+#include "master/drf_allocator.hpp"
+
+using std::make_pair;
+using std::max;
+using std::string;
+using std::vector;
+
+
+namespace mesos {
+namespace internal {
+namespace master {
+
+void DRFAllocator::initialize(Master* _master)
+{
+  master = _master;
+  initialized = true;
+}
+
+
+void DRFAllocator::frameworkAdded(Framework* framework)
+{
+  CHECK(initialized);
+
+  LOG(INFO) << "Added framework " << framework->id;
+
+  refresh();
+
+  frameworks[framework->id] = framework;
+  update(framework);
+
+  reconsider();
+  allocate();
+}
+
+
+void DRFAllocator::frameworkRemoved(Framework* framework)
+{
+  CHECK(initialized);
+
+  refresh();
+
+  foreachkey (const SlaveID& slaveId, utils::copy(refusers)) {
+    refusers.remove(slaveId, framework->id);
+  }
+
+  if (shares.contains(framework->id)) {
+    ordering.erase(make_pair(shares[framework->id], framework->id.value()));
+    shares.erase(framework->id);
+  }
+
+  frameworks.erase(framework->id);
+
+  LOG(INFO) << "Removed framework " << framework->id;
+
+  // The master removes the framework's executors without telling us
+  // about the resources they were using.
+  foreachkey (const SlaveID& slaveId, framework->executors) {
+    touch(slaveId);
+  }
+
+  reconsider();
+  allocate();
+}
+
+
+void DRFAllocator::slaveAdded(Slave* slave)
+{
+  CHECK(initialized);
+
+  LOG(INFO) << "Added slave " << slave->id
+            << " with " << slave->info.resources();
+
+  refresh();
+
+  slaves[slave->id] = slave;
+
+  totalResources += slave->info.resources();
+  update();
+
+  touch(slave->id);
+  allocate();
+}
+
+
+void DRFAllocator::slaveRemoved(Slave* slave)
+{
+  CHECK(initialized);
+
+  LOG(INFO) << "Removed slave " << slave->id;
+
+  refresh();
+
+  slaves.erase(slave->id);
+  dirty.erase(slave->id);
+  idle.erase(slave->id);
+  refusers.remove(slave->id);
+
+  totalResources -= slave->info.resources();
+  update();
+}
+
+
+void DRFAllocator::resourcesRequested(
+    const FrameworkID& frameworkId,
+    const vector<ResourceRequest>& requests)
+{
+  CHECK(initialized);
+
+  LOG(INFO) << "Received resource request from framework " << frameworkId;
+}
+
+
+void DRFAllocator::resourcesUnused(
+    const FrameworkID& frameworkId,
+    const SlaveID& slaveId,
+    const Resources& resources)
+{
+  CHECK(initialized);
+
+  refresh();
+
+  if (resources.allocatable().size() > 0) {
+    VLOG(1) << "Framework " << frameworkId
+            << " left " << resources.allocatable()
+            << " unused on slave " << slaveId;
+    refusers.put(slaveId, frameworkId);
+  }
+
+  changed(frameworkId);
+
+  touch(slaveId);
+  allocate();
+}
+
+
+void DRFAllocator::resourcesRecovered(
+    const FrameworkID& frameworkId,
+    const SlaveID& slaveId,
+    const Resources& resources)
+{
+  CHECK(initialized);
+
+  refresh();
+
+  if (resources.allocatable().size() > 0) {
+    VLOG(1) << "Recovered " << resources.allocatable()
+            << " on slave " << slaveId
+            << " from framework " << frameworkId;
+    refusers.remove(slaveId);
+  }
+
+  changed(frameworkId);
+
+  touch(slaveId);
+  allocate();
+}
+
+
+void DRFAllocator::taskAdded(Task* task)
+{
+  CHECK(initialized);
+
+  refresh();
+
+  changed(task->framework_id());
+}
+
+
+void DRFAllocator::taskRemoved(Task* task)
+{
+  CHECK(initialized);
+
+  refresh();
+
+  changed(task->framework_id());
+}
+
+
+void DRFAllocator::offersRevived(Framework* framework)
+{
+  CHECK(initialized);
+
+  refresh();
+
+  LOG(INFO) << "Filters removed for framework " << framework->id;
+
+  reconsider();
+  allocate();
+}
+
+
+void DRFAllocator::timerTick()
+{
+  CHECK(initialized);
+
+  // The tick is when the master expires filters, so reconsider any
+  // leftover resources.
+  refresh();
+
+  reconsider();
+  allocate();
+}
+
+
+double DRFAllocator::share(Framework* framework)
+{
+  // TODO(benh): This implementaion of "dominant resource fairness"
+  // currently does not take into account resources that are not
+  // scalars.
+  double share = 0;
+
+  for (uint32_t id = 0; id < totalResources.scalarsSize(); id++) {
+    double total = totalResources.scalar(id);
+    if (total > 0) {
+      share = max(share, framework->resources.scalar(id) / total);
+    }
+  }
+
+  return share;
+}
+
+
+void DRFAllocator::update(Framework* framework)
+{
+  const double dominant = share(framework);
+
+  if (shares.contains(framework->id)) {
+    if (shares[framework->id] == dominant) {
+      return; // Still in the right place.
+    }
+    ordering.erase(make_pair(shares[framework->id], framework->id.value()));
+  }
+
+  shares[framework->id] = dominant;
+  ordering[make_pair(dominant, framework->id.value())] = framework;
+}
+
+
+void DRFAllocator::update()
+{
+  ordering.clear();
+  shares.clear();
+  changes.clear();
+
+  foreachvalue (Framework* framework, frameworks) {
+    update(framework);
+  }
+}
+
+
+void DRFAllocator::changed(const FrameworkID& frameworkId)
+{
+  if (frameworks.contains(frameworkId)) {
+    update(frameworks[frameworkId]);
+    changes.insert(frameworkId);
+  }
+}
+
+
+void DRFAllocator::refresh()
+{
+  foreach (const FrameworkID& frameworkId, changes) {
+    if (frameworks.contains(frameworkId)) {
+      update(frameworks[frameworkId]);
+    }
+  }
+
+  changes.clear();
+}
+
+
+void DRFAllocator::touch(const SlaveID& slaveId)
+{
+  if (slaves.contains(slaveId)) {
+    dirty.insert(slaveId);
+  }
+}
+
+
+void DRFAllocator::reconsider()
+{
+  foreach (const SlaveID& slaveId, idle) {
+    dirty.insert(slaveId);
+  }
+
+  idle.clear();
+}
+
+
+void DRFAllocator::allocate()
+{
+  if (dirty.empty()) {
+    return;
+  }
+
+  // Get the (active) frameworks in the order to send offers to.
+  vector<Framework*> ordered;
+  foreachvalue (Framework* framework, ordering) {
+    if (framework->active) {
+      ordered.push_back(framework);
+    }
+  }
+
+  if (ordered.empty()) {
+    VLOG(1) << "No frameworks to allocate resources!";
+    foreach (const SlaveID& slaveId, dirty) {
+      idle.insert(slaveId);
+    }
+    dirty.clear();
+    return;
+  }
+
+  // Find all the available resources that can be allocated.
+  hashmap<Slave*, Resources> available;
+  foreach (const SlaveID& slaveId, dirty) {
+    Slave* slave = slaves[slaveId];
+
+    idle.erase(slaveId);
+
+    if (slave->active) {
+      ResourceVector resources = slave->resourcesFree().allocatable();
+
+      // TODO(benh): For now, only make offers when there is some cpu
+      // and memory left (see SimpleAllocator::makeNewOffers).
+      if (resources.scalar(ResourceVector::CPUS) >= MIN_CPUS &&
+          resources.scalar(ResourceVector::MEM) > MIN_MEM) {
+        VLOG(1) << "Found available resources: " << resources
+                << " on slave " << slave->id;
+        available[slave] = resources.resources();
+      }
+    }
+  }
+
+  dirty.clear();
+
+  if (available.size() == 0) {
+    VLOG(1) << "No resources available to allocate!";
+    return;
+  }
+
+  // Clear refusers on any slave that has been refused by everyone.
+  foreachkey (Slave* slave, available) {
+    if (refusers.get(slave->id).size() == ordered.size()) {
+      VLOG(1) << "Clearing refusers for slave " << slave->id
+              << " because EVERYONE has refused resources from it";
+      refusers.remove(slave->id);
+    }
+  }
+
+  foreach (Framework* framework, ordered) {
+    if (available.size() == 0) {
+      break;
+    }
+
+    // Check if we should offer resources to this framework.
+    hashmap<Slave*, Resources> offerable;
+    foreachpair (Slave* slave, const Resources& resources, available) {
+      if (!refusers.contains(slave->id, framework->id) &&
+          !framework->filters(slave, resources)) {
+        VLOG(1) << "Offering " << resources
+                << " on slave " << slave->id
+                << " to framework " << framework->id;
+        offerable[slave] = resources;
+      }
+    }
+
+    if (offerable.size() > 0) {
+      foreachkey (Slave* slave, offerable) {
+        available.erase(slave);
+      }
+
+      master->makeOffers(framework, offerable);
+
+      update(framework);
+    }
+  }
+
+  // Remember the slaves with resources nobody got offered.
+  foreachkey (Slave* slave, available) {
+    idle.insert(slave->id);
+  }
+}
+
+} // namespace master {
+} // namespace internal {
+} // namespace mesos {
@@ -0,0 +1,156 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DRF_ALLOCATOR_HPP__
+#define __DRF_ALLOCATOR_HPP__
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/hashmap.hpp"
+#include "common/hashset.hpp"
+#include "common/multihashmap.hpp"
+#include "common/resource_vector.hpp"
+
+#include "master/allocator.hpp"
+
+
+namespace mesos {
+namespace internal {
+namespace master {
+
+// Offers resources to frameworks in order of their dominant share,
+// like the SimpleAllocator, but does the work incrementally. Rather
+// than sorting every framework and looking at every slave each time
+// something changes, the frameworks are kept in an index ordered by
+// dominant share (a framework gets moved when its resources change)
+// and an allocation only looks at the slaves whose free resources
+// might have gone up since they were last looked at.
+class DRFAllocator : public Allocator
+{
+public:
+  DRFAllocator(): initialized(false) {}
+
+  virtual ~DRFAllocator() {}
+
+  virtual void initialize(Master* _master);
+
+  virtual void frameworkAdded(Framework* framework);
+
+  virtual void frameworkRemoved(Framework* framework);
+
+  virtual void slaveAdded(Slave* slave);
+
+  virtual void slaveRemoved(Slave* slave);
+
+  virtual void resourcesRequested(
+      const FrameworkID& frameworkId,
+      const std::vector<ResourceRequest>& requests);
+
+  virtual void resourcesUnused(
+    const FrameworkID& frameworkId,
+    const SlaveID& slaveId,
+    const Resources& resources);
+
+  virtual void resourcesRecovered(
+    const FrameworkID& frameworkId,
+    const SlaveID& slaveId,
+    const Resources& resources);
+
+  virtual void taskAdded(Task* task);
+
+  virtual void taskRemoved(Task* task);
+
+  virtual void offersRevived(Framework* framework);
+
+  virtual void timerTick();
+
+private:
+  // Returns the dominant share of a framework.
+  double share(Framework* framework);
+
+  // Recomputes the dominant share of a framework and moves it to its
+  // new place in the ordering.
+  void update(Framework* framework);
+
+  // Recomputes the dominant share of every framework (e.g., after the
+  // total resources in the cluster have changed).
+  void update();
+
+  // Moves a framework whose resources have changed and remembers to
+  // move it again the next time we get invoked (see 'changes').
+  void changed(const FrameworkID& frameworkId);
+
+  // Moves the frameworks whose resources changed since the last time
+  // we got invoked.
+  void refresh();
+
+  // Marks a slave as needing to be looked at in the next allocation.
+  void touch(const SlaveID& slaveId);
+
+  // Marks every slave that had resources left over after the last
+  // time it was looked at as needing to be looked at again (e.g.,
+  // because a framework's filters might have changed).
+  void reconsider();
+
+  // Offers the free resources on the slaves that need to be looked at.
+  void allocate();
+
+  bool initialized;
+
+  Master* master;
+
+  ResourceVector totalResources;
+
+  hashmap<FrameworkID, Framework*> frameworks;
+
+  hashmap<SlaveID, Slave*> slaves;
+
+  // Frameworks ordered by dominant share (ties are broken by id to
+  // make the ordering deterministic) and the share each framework
+  // currently has in the ordering.
+  std::map<std::pair<double, std::string>, Framework*> ordering;
+  hashmap<FrameworkID, double> shares;
+
+  // Frameworks whose resources changed during the last invocation.
+  // The master tells us about some changes before it has finished
+  // making them (e.g., unused resources before it removes the offer
+  // they were in), so we move those frameworks again next time.
+  hashset<FrameworkID> changes;
+
+  // Slaves whose free resources might have gone up since they were
+  // last looked at.
+  hashset<SlaveID> dirty;
+
+  // Slaves that had resources that did not get offered to anyone the
+  // last time they were looked at.
+  hashset<SlaveID> idle;
+
+  // Remember which frameworks refused each slave "recently"; this is
+  // cleared when the slave's free resources go up or when everyone
+  // has refused it.
+  multihashmap<SlaveID, FrameworkID> refusers;
+};
+
+} // namespace master {
+} // namespace internal {
+} // namespace mesos {
+
+#endif // __DRF_ALLOCATOR_HPP__
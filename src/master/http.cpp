@@ -1,11 +1,15 @@
 #include <iomanip>
+#include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "common/build.hpp"
 #include "common/foreach.hpp"
+#include "common/hashset.hpp"
 #include "common/json.hpp"
 #include "common/resources.hpp"
+#include "common/strings.hpp"
 #include "common/type_utils.hpp"
 #include "common/utils.hpp"
 
@@ -17,6 +21,7 @@ using process::HttpRequest;
 using process::Promise;
 
 using std::string;
+using std::vector;
 
 
 namespace mesos {
@@ -27,105 +32,160 @@ namespace master {
 // that it can be shared between slave/http.cpp and master/http.cpp.
 
 
-// Returns a JSON object modeled on a Resources.
-JSON::Object model(const Resources& resources)
+// Writes a JSON object modeled on a Resources.
+void model(JSON::Writer* writer, const Resources& resources)
 {
   // TODO(benh): Add all of the resources.
   Resource::Scalar none;
   Resource::Scalar cpus = resources.get("cpus", none);
   Resource::Scalar mem = resources.get("mem", none);
 
-  JSON::Object object;
-  object.values["cpus"] = cpus.value();
-  object.values["mem"] = mem.value();
+  writer->beginObject();
+  writer->field("cpus");
+  writer->value(cpus.value());
+  writer->field("mem");
+  writer->value(mem.value());
+  writer->endObject();
+}
+
 
-  return object;
+// Writes a JSON object modeled on a Task.
+void model(JSON::Writer* writer, const Task& task)
+{
+  writer->beginObject();
+  writer->field("id");
+  writer->value(task.task_id().value());
+  writer->field("name");
+  writer->value(task.name());
+  writer->field("framework_id");
+  writer->value(task.framework_id().value());
+  writer->field("slave_id");
+  writer->value(task.slave_id().value());
+  writer->field("state");
+  writer->value(TaskState_Name(task.state()));
+  writer->field("resources");
+  model(writer, task.resources());
+  writer->endObject();
 }
 
 
-// Returns a JSON object modeled on a Task.
-JSON::Object model(const Task& task)
+// Writes a JSON object modeled on an Offer.
+void model(JSON::Writer* writer, const Offer& offer)
 {
-  JSON::Object object;
-  object.values["id"] = task.task_id().value();
-  object.values["name"] = task.name();
-  object.values["framework_id"] = task.framework_id().value();
-  object.values["slave_id"] = task.slave_id().value();
-  object.values["state"] = TaskState_Name(task.state());
-  object.values["resources"] = model(task.resources());
-  return object;
+  writer->beginObject();
+  writer->field("id");
+  writer->value(offer.id().value());
+  writer->field("framework_id");
+  writer->value(offer.framework_id().value());
+  writer->field("slave_id");
+  writer->value(offer.slave_id().value());
+  writer->field("resources");
+  model(writer, offer.resources());
+  writer->endObject();
 }
 
 
-// Returns a JSON object modeled on an Offer.
-JSON::Object model(const Offer& offer)
+// Writes the fields of a Framework (excluding its resources, tasks
+// and offers, which change along with its tasks and offers).
+void fields(JSON::Writer* writer, const Framework& framework)
 {
-  JSON::Object object;
-  object.values["id"] = offer.id().value();
-  object.values["framework_id"] = offer.framework_id().value();
-  object.values["slave_id"] = offer.slave_id().value();
-  object.values["resources"] = model(offer.resources());
-  return object;
+  writer->field("id");
+  writer->value(framework.id.value());
+  writer->field("name");
+  writer->value(framework.info.name());
+  writer->field("user");
+  writer->value(framework.info.user());
+  writer->field("executor_uri");
+  writer->value(framework.info.executor().uri());
+  writer->field("registered_time");
+  writer->value(framework.registeredTime);
+  writer->field("unregistered_time");
+  writer->value(framework.unregisteredTime);
+  writer->field("reregistered_time");
+  writer->value(framework.reregisteredTime);
+  writer->field("active");
+  writer->value(framework.active);
 }
 
 
-// Returns a JSON object modeled on a Framework.
-JSON::Object model(const Framework& framework)
+// Writes a JSON object modeled on a Framework.
+void model(JSON::Writer* writer, const Framework& framework)
 {
-  JSON::Object object;
-  object.values["id"] = framework.id.value();
-  object.values["name"] = framework.info.name();
-  object.values["user"] = framework.info.user();
-  object.values["executor_uri"] = framework.info.executor().uri();
-  object.values["registered_time"] = framework.registeredTime;
-  object.values["unregistered_time"] = framework.unregisteredTime;
-  object.values["reregistered_time"] = framework.reregisteredTime;
-  object.values["active"] = framework.active;
-  object.values["resources"] = model(framework.resources);
+  writer->beginObject();
+  fields(writer, framework);
+  writer->field("resources");
+  model(writer, framework.resources.resources());
 
   // Model all of the tasks associated with a framework.
-  {
-    JSON::Array array;
-    foreachvalue (Task* task, framework.tasks) {
-      array.values.push_back(model(*task));
-    }
-
-    object.values["tasks"] = array;
+  writer->field("tasks");
+  writer->beginArray();
+  foreachvalue (Task* task, framework.tasks) {
+    model(writer, *task);
   }
+  writer->endArray();
 
-  {
-    JSON::Array array;
-    foreach (const Task& task, framework.completedTasks) {
-      array.values.push_back(model(task));
-    }
-
-    object.values["completed_tasks"] = array;
+  writer->field("completed_tasks");
+  writer->beginArray();
+  foreach (const Task& task, framework.completedTasks) {
+    model(writer, task);
   }
+  writer->endArray();
 
   // Model all of the offers associated with a framework.
-  {
-    JSON::Array array;
-    foreach (Offer* offer, framework.offers) {
-      array.values.push_back(model(*offer));
-    }
+  writer->field("offers");
+  writer->beginArray();
+  foreach (Offer* offer, framework.offers) {
+    model(writer, *offer);
+  }
+  writer->endArray();
+
+  writer->endObject();
+}
+
+
+// Writes a JSON object modeled after a Slave.
+void model(JSON::Writer* writer, const Slave& slave)
+{
+  writer->beginObject();
+  writer->field("id");
+  writer->value(slave.id.value());
+  writer->field("hostname");
+  writer->value(slave.info.hostname());
+  writer->field("web_ui_url");
+  writer->value(slave.info.public_hostname());
+  writer->field("registered_time");
+  writer->value(slave.registeredTime);
+  writer->field("resources");
+  model(writer, slave.info.resources());
+  writer->endObject();
+}
+
 
-    object.values["offers"] = array;
+// Returns the fields asked for in a query (e.g.,
+// "fields=slaves,frameworks"), or an empty set if there were none
+// (i.e., all fields are wanted).
+static hashset<string> fields(const string& query)
+{
+  hashset<string> result;
+
+  std::map<string, vector<string> > pairs = strings::pairs(query, '&', '=');
+
+  if (pairs.count("fields") > 0) {
+    foreach (const string& value, pairs["fields"]) {
+      foreach (const string& field, strings::split(value, ",")) {
+        result.insert(field);
+      }
+    }
   }
 
-  return object;
+  return result;
 }
 
 
-// Returns a JSON object modeled after a Slave.
-JSON::Object model(const Slave& slave)
+// Returns true if a field was asked for (see fields above).
+static bool contains(const hashset<string>& fields, const string& field)
 {
-  JSON::Object object;
-  object.values["id"] = slave.id.value();
-  object.values["hostname"] = slave.info.hostname();
-  object.values["web_ui_url"] = slave.info.public_hostname();
-  object.values["registered_time"] = slave.registeredTime;
-  object.values["resources"] = model(slave.info.resources());
-  return object;
+  return fields.empty() || fields.contains(field);
 }
 
 
@@ -185,13 +245,22 @@ Promise<HttpResponse> stats(
   object.values["valid_status_updates"] = master.stats.validStatusUpdates;
   object.values["invalid_status_updates"] = master.stats.invalidStatusUpdates;
 
+  uint64_t rounds = master.stats.allocationRounds;
+  object.values["allocation_rounds"] = rounds;
+  object.values["allocation_slaves_per_round"] = rounds > 0
+    ? (double) master.stats.allocationSlavesExamined / rounds
+    : 0.0;
+  object.values["allocation_latency"] = rounds > 0
+    ? master.stats.allocationTime / rounds
+    : 0.0;
+
   // Get total and used (note, not offered) resources in order to
   // compute capacity of scalar resources.
   Resources totalResources;
   Resources usedResources;
   foreach (Slave* slave, master.getActiveSlaves()) {
     totalResources += slave->info.resources();
-    usedResources += slave->resourcesInUse;
+    usedResources += slave->resourcesInUse.resources();
   }
 
   foreach (const Resource& resource, totalResources) {
@@ -220,58 +289,261 @@ Promise<HttpResponse> stats(
 }
 
 
-Promise<HttpResponse> state(
-    const Master& master,
-    const HttpRequest& request)
+const string& render(const Master& master, const string& query)
 {
-  LOG(INFO) << "HTTP request for '" << request.path << "'";
+  Master::StateCache& cache =
+    query == "" ? master.stateCache : master.filteredStateCache;
 
-  JSON::Object object;
-  object.values["build_date"] = build::DATE;
-  object.values["build_user"] = build::USER;
-  object.values["start_time"] = master.startTime;
-  object.values["id"] = master.id;
-  object.values["pid"] = string(master.self());
-
-  // Model all of the slaves.
-  {
-    JSON::Array array;
-    foreachvalue (Slave* slave, master.slaves) {
-      array.values.push_back(model(*slave));
+  // Only render the state if it has changed since the last time (or
+  // different fields are wanted).
+  if (!cache.valid ||
+      cache.version != master.stateVersion ||
+      cache.query != query) {
+    const hashset<string>& wanted = fields(query);
+
+    string& body = cache.body;
+    body.clear();
+
+    JSON::Writer writer(&body);
+    writer.beginObject();
+
+    if (contains(wanted, "build_date")) {
+      writer.field("build_date");
+      writer.value(build::DATE);
     }
 
-    object.values["slaves"] = array;
-  }
+    if (contains(wanted, "build_user")) {
+      writer.field("build_user");
+      writer.value(build::USER);
+    }
 
-  // Model all of the frameworks.
-  {
-    JSON::Array array;
-    foreachvalue (Framework* framework, master.frameworks) {
-      array.values.push_back(model(*framework));
+    if (contains(wanted, "start_time")) {
+      writer.field("start_time");
+      writer.value(master.startTime);
     }
 
-    object.values["frameworks"] = array;
-  }
+    if (contains(wanted, "id")) {
+      writer.field("id");
+      writer.value(master.id);
+    }
 
-  // Model all of the completed frameworks.
-  {
-    JSON::Array array;
+    if (contains(wanted, "pid")) {
+      writer.field("pid");
+      writer.value(string(master.self()));
+    }
 
-    foreach (const Framework& framework, master.completedFrameworks) {
-      array.values.push_back(model(framework));
+    // Model all of the slaves.
+    if (contains(wanted, "slaves")) {
+      writer.field("slaves");
+      writer.beginArray();
+      foreachvalue (Slave* slave, master.slaves) {
+        model(&writer, *slave);
+      }
+      writer.endArray();
     }
 
-    object.values["completed_frameworks"] = array;
+    // Model all of the frameworks.
+    if (contains(wanted, "frameworks")) {
+      writer.field("frameworks");
+      writer.beginArray();
+      foreachvalue (Framework* framework, master.frameworks) {
+        model(&writer, *framework);
+      }
+      writer.endArray();
+    }
+
+    // Model all of the completed frameworks.
+    if (contains(wanted, "completed_frameworks")) {
+      writer.field("completed_frameworks");
+      writer.beginArray();
+      foreach (const Framework& framework, master.completedFrameworks) {
+        model(&writer, framework);
+      }
+      writer.endArray();
+    }
+
+    writer.endObject();
+
+    cache.valid = true;
+    cache.version = master.stateVersion;
+    cache.query = query;
   }
 
-  std::ostringstream out;
+  return cache.body;
+}
 
-  JSON::render(out, object);
+
+Promise<HttpResponse> state(
+    const Master& master,
+    const HttpRequest& request)
+{
+  LOG(INFO) << "HTTP request for '" << request.path << "'";
+
+  const string& body = render(master, request.query);
 
   HttpOKResponse response;
   response.headers["Content-Type"] = "text/x-json";
-  response.headers["Content-Length"] = utils::stringify(out.str().size());
-  response.body = out.str().data();
+  response.headers["Content-Length"] = utils::stringify(body.size());
+  response.body = body;
+  return response;
+}
+
+
+// Names of the types of changes (see Master::Change) in deltas.
+static const char* CHANGES[] = {
+  "framework_added",
+  "framework_updated",
+  "framework_removed",
+  "slave_added",
+  "slave_removed",
+  "task_added",
+  "task_updated",
+  "task_removed",
+  "offer_added",
+  "offer_removed"
+};
+
+
+Promise<HttpResponse> delta(
+    const Master& master,
+    const HttpRequest& request)
+{
+  LOG(INFO) << "HTTP request for '" << request.path << "'";
+
+  std::map<string, vector<string> > pairs =
+    strings::pairs(request.query, '&', '=');
+
+  // Check if the journal still has every change since the version
+  // asked for, otherwise the whole state gets sent instead. Versions
+  // are only meaningful for the same master (i.e., id), so a client
+  // that last saw a different master gets the whole state too.
+  bool journaled = false;
+  uint64_t since = 0;
+  if (pairs.count("since") > 0 &&
+      (pairs.count("id") == 0 || pairs["id"].back() == master.id)) {
+    Try<uint64_t> version = utils::numify<uint64_t>(pairs["since"].back());
+    if (version.isSome() && version.get() <= master.stateVersion) {
+      since = version.get();
+      journaled = master.changes.empty()
+        ? since == master.stateVersion
+        : since + 1 >= master.changes.front().version;
+    }
+  }
+
+  HttpOKResponse response;
+
+  JSON::Writer writer(&response.body);
+  writer.beginObject();
+  writer.field("id");
+  writer.value(master.id);
+  writer.field("version");
+  writer.value(master.stateVersion);
+
+  if (!journaled) {
+    writer.field("state");
+    writer.raw(render(master, ""));
+  } else {
+    // Frameworks, slaves, tasks and offers get written as they are
+    // now, which might be more recent than the change (a change for
+    // something that has been removed since gets skipped since the
+    // removal comes later).
+    writer.field("changes");
+    writer.beginArray();
+    foreach (const Master::Change& change, master.changes) {
+      if (change.version <= since) {
+        continue;
+      }
+
+      Framework* framework = NULL;
+      Slave* slave = NULL;
+      Task* task = NULL;
+      Offer* offer = NULL;
+
+      switch (change.type) {
+        case Master::Change::FRAMEWORK_ADDED:
+        case Master::Change::FRAMEWORK_UPDATED: {
+          FrameworkID frameworkId;
+          frameworkId.set_value(change.id);
+          if (!master.frameworks.contains(frameworkId)) {
+            continue;
+          }
+          framework = master.frameworks.find(frameworkId)->second;
+          break;
+        }
+        case Master::Change::SLAVE_ADDED: {
+          SlaveID slaveId;
+          slaveId.set_value(change.id);
+          if (!master.slaves.contains(slaveId)) {
+            continue;
+          }
+          slave = master.slaves.find(slaveId)->second;
+          break;
+        }
+        case Master::Change::TASK_ADDED:
+        case Master::Change::TASK_UPDATED: {
+          FrameworkID frameworkId;
+          frameworkId.set_value(change.frameworkId);
+          TaskID taskId;
+          taskId.set_value(change.id);
+          if (!master.frameworks.contains(frameworkId)) {
+            continue;
+          }
+          Framework* owner = master.frameworks.find(frameworkId)->second;
+          if (!owner->tasks.contains(taskId)) {
+            continue;
+          }
+          task = owner->tasks[taskId];
+          break;
+        }
+        case Master::Change::OFFER_ADDED: {
+          OfferID offerId;
+          offerId.set_value(change.id);
+          if (!master.offers.contains(offerId)) {
+            continue;
+          }
+          offer = master.offers.find(offerId)->second;
+          break;
+        }
+        default:
+          break;
+      }
+
+      writer.beginObject();
+      writer.field("version");
+      writer.value(change.version);
+      writer.field("type");
+      writer.value(CHANGES[change.type]);
+      writer.field("id");
+      writer.value(change.id);
+
+      if (framework != NULL) {
+        writer.field("framework");
+        writer.beginObject();
+        fields(&writer, *framework);
+        writer.endObject();
+      } else if (slave != NULL) {
+        writer.field("slave");
+        model(&writer, *slave);
+      } else if (task != NULL) {
+        writer.field("task");
+        model(&writer, *task);
+      } else if (offer != NULL) {
+        writer.field("offer");
+        model(&writer, *offer);
+      } else if (change.frameworkId != "") {
+        writer.field("framework_id");
+        writer.value(change.frameworkId);
+      }
+
+      writer.endObject();
+    }
+    writer.endArray();
+  }
+
+  writer.endObject();
+
+  response.headers["Content-Type"] = "text/x-json";
+  response.headers["Content-Length"] = utils::stringify(response.body.size());
   return response;
 }
 
@@ -1,6 +1,8 @@
 #ifndef __MASTER_HTTP_HPP__
 #define __MASTER_HTTP_HPP__
 
+#include <string>
+
 #include <process/future.hpp>
 #include <process/http.hpp>
 
@@ -28,11 +30,26 @@ process::Promise<process::HttpResponse> stats(
     const process::HttpRequest& request);
 
 
+// Returns the JSON for the current state of the cluster, with only the
+// fields asked for in the query (e.g., "fields=slaves,frameworks").
+// The JSON only gets rendered again if the state (or query) changed.
+const std::string& render(const Master& master, const std::string& query);
+
+
 // Returns current state of the cluster that the master knows about.
 process::Promise<process::HttpResponse> state(
     const Master& master,
     const process::HttpRequest& request);
 
+
+// Returns the changes to the state since the version in the query
+// (e.g., "since=42&id=..."), or the whole state if the master no
+// longer remembers all of those changes, no version was given or the
+// version was from a master with a different id.
+process::Promise<process::HttpResponse> delta(
+    const Master& master,
+    const process::HttpRequest& request);
+
 } // namespace json {
 } // namespace http {
 } // namespace master {
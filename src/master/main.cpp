@@ -27,7 +27,7 @@
 #include "detector/detector.hpp"
 
 #include "master/allocator.hpp"
-#include "master/simple_allocator.hpp"
+#include "master/allocator_factory.hpp"
 #include "master/master.hpp"
 #include "master/webui.hpp"
 
@@ -99,7 +99,14 @@ int main(int argc, char **argv)
     fatalerror("Could not chdir into %s", dirname(argv[0]));
   }
 
-  Allocator* allocator = new SimpleAllocator();
+  string type = conf["allocator"];
+  LOG(INFO) << "Creating \"" << type << "\" allocator";
+  Allocator* allocator = AllocatorFactory::instantiate(type, NULL);
+
+  if (allocator == NULL) {
+    cerr << "Unrecognized allocator type: " << type << endl;
+    exit(1);
+  }
 
   Master* master = new Master(allocator, conf);
   process::spawn(master);
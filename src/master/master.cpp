@@ -221,6 +221,11 @@ void Master::registerOptions(Configurator* configurator)
 {
   SlavesManager::registerOptions(configurator);
 
+  configurator->addOption<string>(
+      "allocator",
+      "Allocator to use (simple, drf or request)",
+      "simple");
+
   configurator->addOption<bool>(
       "root_submissions",
       "Can root submit frameworks?",
@@ -230,6 +235,31 @@ void Master::registerOptions(Configurator* configurator)
       "failover_timeout",
       "Framework failover timeout in seconds",
       60 * 60 * 24);
+
+  configurator->addOption<double>(
+      "framework_status_update_batch_interval",
+      "Amount of time (in seconds) to batch up status updates\n"
+      "before forwarding them to a framework (0 disables batching)",
+      0.0);
+
+  configurator->addOption<int>(
+      "state_journal_size",
+      "Number of changes to the master's state to remember for\n"
+      "the subscribers of state_delta.json",
+      10000);
+
+  configurator->addOption<double>(
+      "allocation_interval",
+      "Amount of time (in seconds) to batch up changes to slaves\n"
+      "and frameworks before doing an allocation (0 allocates\n"
+      "right away, only used by the simple allocator)",
+      0.0);
+
+  configurator->addOption<int>(
+      "allocation_dirty_threshold",
+      "Number of changed slaves and frameworks that triggers an\n"
+      "allocation before the allocation interval has passed",
+      100);
 }
 
 
@@ -313,6 +343,9 @@ void Master::initialize()
 
   failoverTimeout = conf.get<int>("failover_timeout", 60 * 60 * 24);
 
+  statusUpdateBatchInterval =
+    conf.get<double>("framework_status_update_batch_interval", 0.0);
+
   // Start all the statistics at 0.
   CHECK(TASK_STARTING == TaskState_MIN);
   CHECK(TASK_LOST == TaskState_MAX);
@@ -326,9 +359,18 @@ void Master::initialize()
   stats.invalidStatusUpdates = 0;
   stats.validFrameworkMessages = 0;
   stats.invalidFrameworkMessages = 0;
+  stats.allocationRounds = 0;
+  stats.allocationSlavesExamined = 0;
+  stats.allocationTime = 0;
 
   startTime = elapsedTime();
 
+  stateVersion = 0;
+  stateCache.valid = false;
+  filteredStateCache.valid = false;
+
+  journalSize = conf.get<int>("state_journal_size", 10000);
+
   // Install handler functions for certain messages.
   installProtobufHandler<SubmitSchedulerRequest>(
       &Master::submitScheduler,
@@ -343,13 +385,15 @@ void Master::initialize()
 
   installProtobufHandler<RegisterFrameworkMessage>(
       &Master::registerFramework,
-      &RegisterFrameworkMessage::framework);
+      &RegisterFrameworkMessage::framework,
+      &RegisterFrameworkMessage::supports_batched_status_updates);
 
   installProtobufHandler<ReregisterFrameworkMessage>(
       &Master::reregisterFramework,
       &ReregisterFrameworkMessage::framework_id,
       &ReregisterFrameworkMessage::framework,
-      &ReregisterFrameworkMessage::failover);
+      &ReregisterFrameworkMessage::failover,
+      &ReregisterFrameworkMessage::supports_batched_status_updates);
 
   installProtobufHandler<UnregisterFrameworkMessage>(
       &Master::unregisterFramework,
@@ -389,14 +433,18 @@ void Master::initialize()
 
   installProtobufHandler<RegisterSlaveMessage>(
       &Master::registerSlave,
-      &RegisterSlaveMessage::slave);
+      &RegisterSlaveMessage::slave,
+      &RegisterSlaveMessage::supports_run_tasks,
+      &RegisterSlaveMessage::supports_status_update_acknowledgements);
 
   installProtobufHandler<ReregisterSlaveMessage>(
       &Master::reregisterSlave,
       &ReregisterSlaveMessage::slave_id,
       &ReregisterSlaveMessage::slave,
       &ReregisterSlaveMessage::executor_infos,
-      &ReregisterSlaveMessage::tasks);
+      &ReregisterSlaveMessage::tasks,
+      &ReregisterSlaveMessage::supports_run_tasks,
+      &ReregisterSlaveMessage::supports_status_update_acknowledgements);
 
   installProtobufHandler<UnregisterSlaveMessage>(
       &Master::unregisterSlave,
@@ -407,6 +455,11 @@ void Master::initialize()
       &StatusUpdateMessage::update,
       &StatusUpdateMessage::pid);
 
+  installProtobufHandler<StatusUpdatesMessage>(
+      &Master::statusUpdates,
+      &StatusUpdatesMessage::updates,
+      &StatusUpdatesMessage::pids);
+
   installProtobufHandler<ExecutorToFrameworkMessage>(
       &Master::executorMessage,
       &ExecutorToFrameworkMessage::slave_id,
@@ -436,6 +489,10 @@ void Master::initialize()
   installHttpHandler(
       "state.json",
       bind(&http::json::state, cref(*this), params::_1));
+
+  installHttpHandler(
+      "state_delta.json",
+      bind(&http::json::delta, cref(*this), params::_1));
 }
 
 
@@ -479,7 +536,8 @@ void Master::noMasterDetected()
 }
 
 
-void Master::registerFramework(const FrameworkInfo& frameworkInfo)
+void Master::registerFramework(const FrameworkInfo& frameworkInfo,
+                               bool supportsBatchedStatusUpdates)
 {
   if (!elected) {
     LOG(WARNING) << "Ignoring register framework message since not elected yet";
@@ -488,6 +546,7 @@ void Master::registerFramework(const FrameworkInfo& frameworkInfo)
 
   Framework* framework =
     new Framework(frameworkInfo, newFrameworkId(), from(), elapsedTime());
+  framework->supportsBatchedStatusUpdates = supportsBatchedStatusUpdates;
 
   LOG(INFO) << "Registering framework " << framework->id << " at " << from();
 
@@ -520,7 +579,8 @@ void Master::registerFramework(const FrameworkInfo& frameworkInfo)
 
 void Master::reregisterFramework(const FrameworkID& frameworkId,
                                  const FrameworkInfo& frameworkInfo,
-                                 bool failover)
+                                 bool failover,
+                                 bool supportsBatchedStatusUpdates)
 {
   if (!elected) {
     LOG(WARNING) << "Ignoring re-register framework message since "
@@ -563,6 +623,10 @@ void Master::reregisterFramework(const FrameworkID& frameworkId,
 
     Framework* framework = frameworks[frameworkId];
 
+    // The (possibly failed over) scheduler driver might be a different
+    // version than the one that registered before.
+    framework->supportsBatchedStatusUpdates = supportsBatchedStatusUpdates;
+
     if (failover) {
       // TODO: Should we check whether the new scheduler has given
       // us a different framework name, user name or executor info?
@@ -595,34 +659,42 @@ void Master::reregisterFramework(const FrameworkID& frameworkId,
     // any tasks it has that have been reported by reconnecting slaves.
     Framework* framework =
       new Framework(frameworkInfo, frameworkId, from(), elapsedTime());
+    framework->supportsBatchedStatusUpdates = supportsBatchedStatusUpdates;
 
     // TODO(benh): Check for root submissions like above!
 
     addFramework(framework);
 
     // Add any running tasks reported by slaves for this framework.
-    foreachpair (const SlaveID& slaveId, Slave* slave, slaves) {
-      foreachvalue (Task* task, slave->tasks) {
-        if (framework->id == task->framework_id()) {
-          framework->addTask(task);
-          // Also add the task's executor for resource accounting.
-          if (!framework->hasExecutor(slave->id, task->executor_id())) {
-            CHECK(slave->hasExecutor(framework->id, task->executor_id()));
-            const ExecutorInfo& executorInfo =
-              slave->executors[framework->id][task->executor_id()];
-            framework->addExecutor(slave->id, executorInfo);
-          }
+    foreach (const SlaveID& slaveId, orphans.get(framework->id)) {
+      Slave* slave = getSlave(slaveId);
+      CHECK(slave != NULL);
+      foreach (Task* task, slave->getTasks(framework->id)) {
+        framework->addTask(task);
+        journal(Change::TASK_ADDED,
+                task->task_id().value(),
+                framework->id.value());
+        // Also add the task's executor for resource accounting.
+        if (!framework->hasExecutor(slave->id, task->executor_id())) {
+          CHECK(slave->hasExecutor(framework->id, task->executor_id()));
+          const ExecutorInfo& executorInfo =
+            slave->executors[framework->id][task->executor_id()];
+          framework->addExecutor(slave->id, executorInfo);
         }
+        allocator->taskAdded(task);
       }
     }
+
+    orphans.remove(framework->id);
   }
 
   CHECK(frameworks.count(frameworkId) > 0);
 
   // Broadcast the new framework pid to all the slaves. We have to
   // broadcast because an executor might be running on a slave but
-  // it currently isn't running any tasks. This could be a
-  // potential scalability issue ...
+  // it currently isn't running any tasks (and after a master failover
+  // we only learn about the executors that are running tasks). This
+  // could be a potential scalability issue ...
   foreachvalue (Slave* slave, slaves) {
     UpdateFrameworkMessage message;
     message.mutable_framework_id()->MergeFrom(frameworkId);
@@ -656,6 +728,7 @@ void Master::deactivateFramework(const FrameworkID& frameworkId)
   if (framework != NULL) {
     if (framework->pid == from()) {
       framework->active = false;
+      journal(Change::FRAMEWORK_UPDATED, framework->id.value());
     } else {
       LOG(WARNING) << from() << " tried to deactivate framework; "
         << "expecting " << framework->pid;
@@ -802,7 +875,9 @@ void Master::schedulerMessage(const SlaveID& slaveId,
 }
 
 
-void Master::registerSlave(const SlaveInfo& slaveInfo)
+void Master::registerSlave(const SlaveInfo& slaveInfo,
+                           bool supportsRunTasks,
+                           bool supportsStatusUpdateAcknowledgements)
 {
   if (!elected) {
     LOG(WARNING) << "Ignoring register slave message since not elected yet";
@@ -810,6 +885,9 @@ void Master::registerSlave(const SlaveInfo& slaveInfo)
   }
 
   Slave* slave = new Slave(slaveInfo, newSlaveId(), from(), elapsedTime());
+  slave->supportsRunTasks = supportsRunTasks;
+  slave->supportsStatusUpdateAcknowledgements =
+    supportsStatusUpdateAcknowledgements;
 
   LOG(INFO) << "Attempting to register slave " << slave->id
             << " at " << slave->pid;
@@ -831,7 +909,9 @@ void Master::registerSlave(const SlaveInfo& slaveInfo)
 void Master::reregisterSlave(const SlaveID& slaveId,
                              const SlaveInfo& slaveInfo,
                              const vector<ExecutorInfo>& executorInfos,
-                             const vector<Task>& tasks)
+                             const vector<Task>& tasks,
+                             bool supportsRunTasks,
+                             bool supportsStatusUpdateAcknowledgements)
 {
   if (!elected) {
     LOG(WARNING) << "Ignoring re-register slave message since not elected yet";
@@ -855,12 +935,19 @@ void Master::reregisterSlave(const SlaveID& slaveId,
                    << " is being allowed to re-register with an already"
                    << " in use id (" << slaveId << ")";
 
+      slave->supportsRunTasks = supportsRunTasks;
+      slave->supportsStatusUpdateAcknowledgements =
+        supportsStatusUpdateAcknowledgements;
+
       SlaveReregisteredMessage message;
       message.mutable_slave_id()->MergeFrom(slave->id);
       send(slave->pid, message);
 
     } else {
       Slave* slave = new Slave(slaveInfo, slaveId, from(), elapsedTime());
+      slave->supportsRunTasks = supportsRunTasks;
+      slave->supportsStatusUpdateAcknowledgements =
+        supportsStatusUpdateAcknowledgements;
 
       LOG(INFO) << "Attempting to re-register slave " << slave->id
                 << " at " << slave->pid;
@@ -904,49 +991,85 @@ void Master::statusUpdate(const StatusUpdate& update, const UPID& pid)
             << " of framework " << update.framework_id()
             << " is now in state " << status.state();
 
-  Slave* slave = getSlave(update.slave_id());
-  if (slave != NULL) {
-    Framework* framework = getFramework(update.framework_id());
-    if (framework != NULL) {
+  Framework* framework = processStatusUpdate(update);
+  if (framework != NULL) {
+    // Only batch updates for scheduler drivers that understand a
+    // batch, and from slaves that understand the (batched)
+    // acknowledgement the scheduler driver sends back for it.
+    Slave* slave = getSlave(update.slave_id());
+    CHECK(slave != NULL);
+
+    if (statusUpdateBatchInterval > 0 &&
+        framework->supportsBatchedStatusUpdates &&
+        slave->supportsStatusUpdateAcknowledgements) {
+      StatusUpdatesMessage message;
+      message.add_updates()->MergeFrom(update);
+      message.add_pids(pid);
+      batchStatusUpdates(framework, message);
+    } else {
       // Pass on the (transformed) status update to the framework.
       StatusUpdateMessage message;
       message.mutable_update()->MergeFrom(update);
       message.set_pid(pid);
       send(framework->pid, message);
+    }
+  }
+}
 
-      // Lookup the task and see if we need to update anything locally.
-      Task* task = slave->getTask(update.framework_id(), status.task_id());
-      if (task != NULL) {
-        task->set_state(status.state());
 
-        // Handle the task appropriately if it's terminated.
-        if (status.state() == TASK_FINISHED ||
-            status.state() == TASK_FAILED ||
-            status.state() == TASK_KILLED ||
-            status.state() == TASK_LOST) {
-          removeTask(task);
-        }
+void Master::statusUpdates(const vector<StatusUpdate>& updates,
+                           const vector<string>& pids)
+{
+  if (updates.size() != pids.size()) {
+    LOG(WARNING) << "Ignoring malformed status updates from " << from();
+    return;
+  }
+
+  LOG(INFO) << "Received " << updates.size()
+            << " status updates from " << from();
+
+  // Group the updates by framework so that each framework gets (at
+  // most) one message for the entire batch.
+  hashmap<FrameworkID, StatusUpdatesMessage> messages;
+
+  for (size_t i = 0; i < updates.size(); i++) {
+    const StatusUpdate& update = updates[i];
 
-        stats.tasks[status.state()]++;
+    VLOG(1) << "Status update from " << from()
+            << ": task " << update.status().task_id()
+            << " of framework " << update.framework_id()
+            << " is now in state " << update.status().state();
 
-        stats.validStatusUpdates++;
+    Framework* framework = processStatusUpdate(update);
+    if (framework != NULL) {
+      Slave* slave = getSlave(update.slave_id());
+      CHECK(slave != NULL);
+
+      if (framework->supportsBatchedStatusUpdates &&
+          slave->supportsStatusUpdateAcknowledgements) {
+        StatusUpdatesMessage& message = messages[framework->id];
+        message.add_updates()->MergeFrom(update);
+        message.add_pids(pids[i]);
       } else {
-        LOG(WARNING) << "Status update from " << from()
-                     << ": error, couldn't lookup "
-                     << "task " << status.task_id();
-	stats.invalidStatusUpdates++;
+        // See the comment in Master::statusUpdate.
+        StatusUpdateMessage message;
+        message.mutable_update()->MergeFrom(update);
+        message.set_pid(pids[i]);
+        send(framework->pid, message);
       }
+    }
+  }
+
+  foreachpair (const FrameworkID& frameworkId,
+               const StatusUpdatesMessage& message,
+               messages) {
+    Framework* framework = getFramework(frameworkId);
+    CHECK(framework != NULL);
+    if (statusUpdateBatchInterval > 0) {
+      batchStatusUpdates(framework, message);
     } else {
-      LOG(WARNING) << "Status update from " << from()
-                   << ": error, couldn't lookup "
-                   << "framework " << update.framework_id();
-      stats.invalidStatusUpdates++;
+      send(framework->pid, message);
     }
-  } else {
-    LOG(WARNING) << "Status update from " << from()
-                 << ": error, couldn't lookup slave "
-                 << update.slave_id();
-    stats.invalidStatusUpdates++;
   }
 }
 
@@ -1015,9 +1138,8 @@ void Master::exitedExecutor(const SlaveID& slaveId,
       // has occured.
 
       // Tell the framework which tasks have been lost.
-      foreachvalue (Task* task, utils::copy(framework->tasks)) {
-        if (task->slave_id() == slave->id &&
-	    task->executor_id() == executorId) {
+      foreach (Task* task, utils::copy(framework->getTasks(slave->id))) {
+        if (task->executor_id() == executorId) {
           StatusUpdateMessage message;
           StatusUpdate* update = message.mutable_update();
           update->mutable_framework_id()->MergeFrom(task->framework_id());
@@ -1041,8 +1163,17 @@ void Master::exitedExecutor(const SlaveID& slaveId,
       }
 
       // Remove executor from slave.
+      Resources resources;
+      if (slave->hasExecutor(frameworkId, executorId)) {
+        resources = slave->executors[frameworkId][executorId].resources();
+      }
+
       slave->removeExecutor(frameworkId, executorId);
       framework->removeExecutor(slave->id, executorId);
+      journal(Change::FRAMEWORK_UPDATED, framework->id.value());
+
+      // Tell the allocator about the resources the executor was using.
+      allocator->resourcesRecovered(frameworkId, slave->id, resources);
 
       // TODO(benh): Send the framework it's executor's exit status?
       // Or maybe at least have something like
@@ -1098,6 +1229,12 @@ void Master::timerTick()
 }
 
 
+void Master::allocate()
+{
+  allocator->allocate();
+}
+
+
 void Master::frameworkFailoverTimeout(const FrameworkID& frameworkId,
                                       double reregisteredTime)
 {
@@ -1111,6 +1248,31 @@ void Master::frameworkFailoverTimeout(const FrameworkID& frameworkId,
 }
 
 
+void Master::flushStatusUpdates(const FrameworkID& frameworkId)
+{
+  if (pendingUpdates.contains(frameworkId)) {
+    Framework* framework = getFramework(frameworkId);
+    if (framework != NULL) {
+      const StatusUpdatesMessage& message = pendingUpdates[frameworkId];
+      if (framework->supportsBatchedStatusUpdates) {
+        send(framework->pid, message);
+      } else {
+        // The framework failed over to an older scheduler driver
+        // since these updates were batched.
+        for (int i = 0; i < message.updates_size(); i++) {
+          StatusUpdateMessage update;
+          update.mutable_update()->MergeFrom(message.updates(i));
+          update.set_pid(message.pids(i));
+          send(framework->pid, update);
+        }
+      }
+    }
+
+    pendingUpdates.erase(frameworkId);
+  }
+}
+
+
 void Master::exited()
 {
   foreachvalue (Framework* framework, frameworks) {
@@ -1121,6 +1283,7 @@ void Master::exited()
 
       // Stop sending offers here for now.
       framework->active = false;
+      journal(Change::FRAMEWORK_UPDATED, framework->id.value());
 
       // Delay dispatching a message to ourselves for the timeout.
       delay(failoverTimeout, self(),
@@ -1176,6 +1339,8 @@ void Master::makeOffers(Framework* framework,
     framework->addOffer(offer);
     slave->addOffer(offer);
 
+    journal(Change::OFFER_ADDED, offer->id().value());
+
     // Add the offer *AND* the corresponding slave's PID.
     message.add_offers()->MergeFrom(*offer);
     message.add_pids(slave->pid);
@@ -1293,9 +1458,10 @@ struct ResourceUsageChecker : TaskDescriptionVisitor
     }
 
     // Check if this task uses more resources than offered.
-    Resources taskResources = task.resources();
+    ResourceVector offered = offer->resources();
+    ResourceVector taskResources = task.resources();
 
-    if (!((usedResources + taskResources) <= offer->resources())) {
+    if (!((usedResources + taskResources) <= offered)) {
       return TaskDescriptionError::some(
           "Task uses more resources than offered");
     }
@@ -1305,7 +1471,7 @@ struct ResourceUsageChecker : TaskDescriptionVisitor
     if (!executors.contains(executorInfo.executor_id())) {
       if (!slave->hasExecutor(framework->id, executorInfo.executor_id())) {
         taskResources += executorInfo.resources();
-        if (!((usedResources + taskResources) <= offer->resources())) {
+        if (!((usedResources + taskResources) <= offered)) {
           return TaskDescriptionError::some(
               "Task + executor uses more resources than offered");
         }
@@ -1318,7 +1484,7 @@ struct ResourceUsageChecker : TaskDescriptionVisitor
     return TaskDescriptionError::none();
   }
 
-  Resources usedResources;
+  ResourceVector usedResources;
   hashset<ExecutorID> executors;
 };
 
@@ -1334,6 +1500,8 @@ void Master::processTasks(Offer* offer,
 {
   Resources usedResources; // Accumulated resources used from this offer.
 
+  vector<TaskDescription> launched; // Tasks to send to the slave.
+
   // Create task visitors.
   list<TaskDescriptionVisitor*> visitors;
   visitors.push_back(new SlaveIDChecker());
@@ -1356,6 +1524,7 @@ void Master::processTasks(Offer* offer,
     if (error.isNone()) {
       // Task looks good, get it running!
       usedResources += launchTask(task, framework, slave);
+      launched.push_back(task);
     } else {
       // Error validating task, send a failed status update.
       StatusUpdateMessage message;
@@ -1378,6 +1547,10 @@ void Master::processTasks(Offer* offer,
     delete visitor;
   } while (!visitors.empty());
 
+  if (!launched.empty()) {
+    runTasks(framework, slave, launched);
+  }
+
   // All used resources should be allocatable, enforced by our validators.
   CHECK(usedResources == usedResources.allocatable());
 
@@ -1437,6 +1610,7 @@ Resources Master::launchTask(const TaskDescription& task,
   t->mutable_resources()->MergeFrom(task.resources());
 
   framework->addTask(t);
+  journal(Change::TASK_ADDED, t->task_id().value(), framework->id.value());
 
   // TODO(benh): Refactor this code into Slave::addTask.
   if (!slave->hasExecutor(framework->id, executorInfo.executor_id())) {
@@ -1448,18 +1622,13 @@ Resources Master::launchTask(const TaskDescription& task,
 
   slave->addTask(t);
 
+  allocator->taskAdded(t);
+
   resources += task.resources();
 
   LOG(INFO) << "Launching task " << task.task_id()
             << " on slave " << slave->id;
 
-  RunTaskMessage message;
-  message.mutable_framework()->MergeFrom(framework->info);
-  message.mutable_framework_id()->MergeFrom(framework->id);
-  message.set_pid(framework->pid);
-  message.mutable_task()->MergeFrom(task);
-  send(slave->pid, message);
-
   // TODO(benh): This is a double count if the executor decides to
   // send a status update for TASK_STARTING itself. Currently we don't
   // disallow this although we really should have a state machine that
@@ -1470,11 +1639,38 @@ Resources Master::launchTask(const TaskDescription& task,
 }
 
 
+void Master::runTasks(Framework* framework,
+                      Slave* slave,
+                      const vector<TaskDescription>& tasks)
+{
+  if (slave->supportsRunTasks) {
+    RunTasksMessage message;
+    message.mutable_framework()->MergeFrom(framework->info);
+    message.mutable_framework_id()->MergeFrom(framework->id);
+    message.set_pid(framework->pid);
+    foreach (const TaskDescription& task, tasks) {
+      message.add_tasks()->MergeFrom(task);
+    }
+    send(slave->pid, message);
+  } else {
+    foreach (const TaskDescription& task, tasks) {
+      RunTaskMessage message;
+      message.mutable_framework()->MergeFrom(framework->info);
+      message.mutable_framework_id()->MergeFrom(framework->id);
+      message.set_pid(framework->pid);
+      message.mutable_task()->MergeFrom(task);
+      send(slave->pid, message);
+    }
+  }
+}
+
+
 void Master::addFramework(Framework* framework)
 {
   CHECK(frameworks.count(framework->id) == 0);
 
   frameworks[framework->id] = framework;
+  journal(Change::FRAMEWORK_ADDED, framework->id.value());
 
   link(framework->pid);
 
@@ -1518,6 +1714,8 @@ void Master::failoverFramework(Framework* framework, const UPID& newPid)
 
   framework->reregisteredTime = elapsedTime();
 
+  journal(Change::FRAMEWORK_UPDATED, framework->id.value());
+
   FrameworkRegisteredMessage message;
   message.mutable_framework_id()->MergeFrom(framework->id);
   send(newPid, message);
@@ -1529,7 +1727,10 @@ void Master::removeFramework(Framework* framework)
   framework->active = false;
   // TODO: Notify allocator that a framework removal is beginning?
 
-  // Tell slaves to shutdown the framework.
+  // Tell slaves to shutdown the framework. This goes to every slave
+  // since a slave might be running an executor of the framework that
+  // isn't running any tasks (which we might not know about, see
+  // Master::reregisterFramework).
   foreachvalue (Slave* slave, slaves) {
     ShutdownFrameworkMessage message;
     message.mutable_framework_id()->MergeFrom(framework->id);
@@ -1574,6 +1775,8 @@ void Master::removeFramework(Framework* framework)
     completedFrameworks.pop_front();
   }
 
+  journal(Change::FRAMEWORK_REMOVED, framework->id.value());
+
   // Delete it.
   frameworks.erase(framework->id);
   allocator->frameworkRemoved(framework);
@@ -1590,6 +1793,7 @@ void Master::addSlave(Slave* slave, bool reregister)
             << " with " << slave->info.resources();
 
   slaves[slave->id] = slave;
+  journal(Change::SLAVE_ADDED, slave->id.value());
 
   link(slave->pid);
 
@@ -1657,6 +1861,10 @@ void Master::readdSlave(Slave* slave,
     Framework* framework = getFramework(task.framework_id());
     if (framework != NULL) {
       framework->addTask(t);
+      journal(Change::TASK_ADDED,
+              t->task_id().value(),
+              framework->id.value());
+      allocator->taskAdded(t);
       UpdateFrameworkMessage message;
       message.mutable_framework_id()->MergeFrom(framework->id);
       message.set_pid(framework->pid);
@@ -1665,6 +1873,9 @@ void Master::readdSlave(Slave* slave,
       // TODO(benh): We should really put a timeout on how long we
       // keep tasks running on a slave that never have frameworks
       // reregister and claim them.
+      if (!orphans.contains(task.framework_id(), slave->id)) {
+        orphans.put(task.framework_id(), slave->id);
+      }
       LOG(WARNING) << "Possibly orphaned task " << task.task_id()
                    << " of framework " << task.framework_id()
                    << " running on slave " << slave->id;
@@ -1680,6 +1891,11 @@ void Master::removeSlave(Slave* slave)
 
   // TODO: Notify allocator that a slave removal is beginning?
 
+  // Forget about any orphaned tasks running on this slave.
+  foreachkey (const FrameworkID& frameworkId, slave->frameworkTasks) {
+    orphans.remove(frameworkId, slave->id);
+  }
+
   // Remove pointers to slave's tasks in frameworks, and send status updates
   foreachvalue (Task* task, utils::copy(slave->tasks)) {
     Framework* framework = getFramework(task->framework_id());
@@ -1749,6 +1965,8 @@ void Master::removeSlave(Slave* slave)
 
   // TODO(benh): unlink(slave->pid);
 
+  journal(Change::SLAVE_REMOVED, slave->id.value());
+
   // Delete it.
   slaves.erase(slave->id);
   allocator->slaveRemoved(slave);
@@ -1758,6 +1976,10 @@ void Master::removeSlave(Slave* slave)
 
 void Master::removeTask(Task* task)
 {
+  journal(Change::TASK_REMOVED,
+          task->task_id().value(),
+          task->framework_id().value());
+
   // Remove from framework.
   Framework* framework = getFramework(task->framework_id());
   CHECK(framework != NULL);
@@ -1768,6 +1990,8 @@ void Master::removeTask(Task* task)
   CHECK(slave != NULL);
   slave->removeTask(task);
 
+  allocator->taskRemoved(task);
+
   // Tell the allocator about the recovered resources.
   allocator->resourcesRecovered(framework->id, slave->id, task->resources());
 
@@ -1775,8 +1999,95 @@ void Master::removeTask(Task* task)
 }
 
 
+Framework* Master::processStatusUpdate(const StatusUpdate& update)
+{
+  const TaskStatus& status = update.status();
+
+  Slave* slave = getSlave(update.slave_id());
+  if (slave == NULL) {
+    LOG(WARNING) << "Status update from " << from()
+                 << ": error, couldn't lookup slave "
+                 << update.slave_id();
+    stats.invalidStatusUpdates++;
+    return NULL;
+  }
+
+  Framework* framework = getFramework(update.framework_id());
+  if (framework == NULL) {
+    LOG(WARNING) << "Status update from " << from()
+                 << ": error, couldn't lookup "
+                 << "framework " << update.framework_id();
+    stats.invalidStatusUpdates++;
+    return NULL;
+  }
+
+  // Lookup the task and see if we need to update anything locally.
+  Task* task = slave->getTask(update.framework_id(), status.task_id());
+  if (task != NULL) {
+    task->set_state(status.state());
+    journal(Change::TASK_UPDATED,
+            task->task_id().value(),
+            task->framework_id().value());
+
+    // Handle the task appropriately if it's terminated.
+    if (status.state() == TASK_FINISHED ||
+        status.state() == TASK_FAILED ||
+        status.state() == TASK_KILLED ||
+        status.state() == TASK_LOST) {
+      removeTask(task);
+    }
+
+    stats.tasks[status.state()]++;
+
+    stats.validStatusUpdates++;
+  } else {
+    LOG(WARNING) << "Status update from " << from()
+                 << ": error, couldn't lookup "
+                 << "task " << status.task_id();
+    stats.invalidStatusUpdates++;
+  }
+
+  // The update still gets passed on to the framework even if we
+  // couldn't find the task (e.g., the master failed over).
+  return framework;
+}
+
+
+void Master::batchStatusUpdates(Framework* framework,
+                                const StatusUpdatesMessage& message)
+{
+  // Schedule a flush when the first updates for this framework show up.
+  if (!pendingUpdates.contains(framework->id)) {
+    delay(statusUpdateBatchInterval, self(),
+          &Master::flushStatusUpdates, framework->id);
+  }
+
+  pendingUpdates[framework->id].MergeFrom(message);
+}
+
+
+void Master::journal(Change::Type type,
+                     const string& id,
+                     const string& frameworkId)
+{
+  Change change;
+  change.version = ++stateVersion;
+  change.type = type;
+  change.id = id;
+  change.frameworkId = frameworkId;
+
+  changes.push_back(change);
+
+  while (changes.size() > journalSize) {
+    changes.pop_front();
+  }
+}
+
+
 void Master::removeOffer(Offer* offer, bool rescind)
 {
+  journal(Change::OFFER_REMOVED, offer->id().value());
+
   // Remove from framework.
   Framework* framework = getFramework(offer->framework_id());
   CHECK(framework != NULL);
@@ -19,6 +19,7 @@
 #ifndef __MASTER_HPP__
 #define __MASTER_HPP__
 
+#include <deque>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,7 @@
 #include "common/hashmap.hpp"
 #include "common/hashset.hpp"
 #include "common/multihashmap.hpp"
+#include "common/resource_vector.hpp"
 #include "common/resources.hpp"
 #include "common/type_utils.hpp"
 #include "common/units.hpp"
@@ -70,10 +72,12 @@ public:
   void newMasterDetected(const UPID& pid);
   void noMasterDetected();
   void masterDetectionFailure();
-  void registerFramework(const FrameworkInfo& frameworkInfo);
+  void registerFramework(const FrameworkInfo& frameworkInfo,
+                         bool supportsBatchedStatusUpdates);
   void reregisterFramework(const FrameworkID& frameworkId,
                            const FrameworkInfo& frameworkInfo,
-                           bool failover);
+                           bool failover,
+                           bool supportsBatchedStatusUpdates);
   void unregisterFramework(const FrameworkID& frameworkId);
   void deactivateFramework(const FrameworkID& frameworkId);
   void resourceRequest(const FrameworkID& frameworkId,
@@ -88,13 +92,19 @@ public:
                         const FrameworkID& frameworkId,
                         const ExecutorID& executorId,
                         const std::string& data);
-  void registerSlave(const SlaveInfo& slaveInfo);
+  void registerSlave(const SlaveInfo& slaveInfo,
+                     bool supportsRunTasks,
+                     bool supportsStatusUpdateAcknowledgements);
   void reregisterSlave(const SlaveID& slaveId,
                        const SlaveInfo& slaveInfo,
                        const std::vector<ExecutorInfo>& executorInfos,
-                       const std::vector<Task>& tasks);
+                       const std::vector<Task>& tasks,
+                       bool supportsRunTasks,
+                       bool supportsStatusUpdateAcknowledgements);
   void unregisterSlave(const SlaveID& slaveId);
   void statusUpdate(const StatusUpdate& update, const UPID& pid);
+  void statusUpdates(const std::vector<StatusUpdate>& updates,
+                     const std::vector<std::string>& pids);
   void executorMessage(const SlaveID& slaveId,
                        const FrameworkID& frameworkId,
                        const ExecutorID& executorId,
@@ -106,8 +116,10 @@ public:
   void activatedSlaveHostnamePort(const std::string& hostname, uint16_t port);
   void deactivatedSlaveHostnamePort(const std::string& hostname, uint16_t port);
   void timerTick();
+  void allocate();
   void frameworkFailoverTimeout(const FrameworkID& frameworkId,
                                 double reregisteredTime);
+  void flushStatusUpdates(const FrameworkID& frameworkId);
   void exited();
 
   // Return connected frameworks that are not in the process of being removed
@@ -155,14 +167,60 @@ protected:
   void removeSlave(Slave* slave);
 
   // Launch a task from a task description, and returned the consumed
-  // resources for the task and possibly it's executor.
+  // resources for the task and possibly it's executor. The task still
+  // needs to be sent to the slave (see Master::runTasks).
   Resources launchTask(const TaskDescription& task,
                        Framework* framework,
                        Slave* slave);
 
+  // Send the launched tasks to the slave, as a single message if the
+  // slave supports it or one message per task otherwise.
+  void runTasks(Framework* framework,
+                Slave* slave,
+                const std::vector<TaskDescription>& tasks);
+
   // Remove a task.
   void removeTask(Task* task);
 
+  // Updates the state of the task (removing it if it's terminated)
+  // and returns the framework the status update should be forwarded
+  // to, or NULL if the slave or framework no longer exists.
+  Framework* processStatusUpdate(const StatusUpdate& update);
+
+  // Adds the status updates to the next batch sent to the framework
+  // (see --framework_status_update_batch_interval).
+  void batchStatusUpdates(Framework* framework,
+                          const StatusUpdatesMessage& message);
+
+  // A change to the state that gets rendered in state.json, which
+  // gets journaled for the subscribers of state_delta.json (see
+  // http::json::delta).
+  struct Change
+  {
+    enum Type {
+      FRAMEWORK_ADDED,
+      FRAMEWORK_UPDATED,
+      FRAMEWORK_REMOVED,
+      SLAVE_ADDED,
+      SLAVE_REMOVED,
+      TASK_ADDED,
+      TASK_UPDATED,
+      TASK_REMOVED,
+      OFFER_ADDED,
+      OFFER_REMOVED
+    };
+
+    uint64_t version; // The state version after this change.
+    Type type;
+    std::string id; // Of the framework, slave, task or offer.
+    std::string frameworkId; // Of a task (task ids are per framework).
+  };
+
+  // Records a change in the journal and bumps the state version.
+  void journal(Change::Type type,
+               const std::string& id,
+               const std::string& frameworkId = "");
+
   // Remove an offer and optionally rescind the offer as well.
   void removeOffer(Offer* offer, bool rescind = false);
 
@@ -196,6 +254,15 @@ private:
       const Master& master,
       const HttpRequest& request);
 
+  friend const std::string& http::json::render(
+      const Master& master,
+      const std::string& query);
+
+  friend Promise<HttpResponse> http::json::delta(
+      const Master& master,
+      const HttpRequest& request);
+
+protected:
   const Configuration conf;
 
   bool elected;
@@ -212,6 +279,11 @@ private:
 
   hashmap<FrameworkID, Framework*> frameworks;
   hashmap<SlaveID, Slave*> slaves;
+
+  // Slaves that re-registered with tasks of frameworks that had yet
+  // to re-register (e.g., after a master failover), so that those
+  // frameworks can find their tasks without looking at every slave.
+  multihashmap<FrameworkID, SlaveID> orphans;
   hashmap<OfferID, Offer*> offers;
 
   std::list<Framework> completedFrameworks;
@@ -227,13 +299,50 @@ private:
     uint64_t invalidStatusUpdates;
     uint64_t validFrameworkMessages;
     uint64_t invalidFrameworkMessages;
+    uint64_t allocationRounds;
+    uint64_t allocationSlavesExamined; // Summed over all rounds.
+    double allocationTime; // Seconds spent in all rounds.
   } stats;
 
   // Start time used to calculate uptime.
   double startTime;
 
+  // Incremented whenever something that gets rendered in state.json
+  // changes (see Master::journal), so that an unchanged state doesn't
+  // get rendered again.
+  uint64_t stateVersion;
+
+  // The most recent changes, oldest first, bounded by
+  // --state_journal_size.
+  std::deque<Change> changes;
+  size_t journalSize;
+
+  // A rendering of state.json (see http::json::state), along with the
+  // state version and query it was rendered for.
+  struct StateCache
+  {
+    bool valid;
+    uint64_t version;
+    std::string query;
+    std::string body;
+  };
+
+  // The last rendering of the whole state (which state_delta.json
+  // also sends) and of the last filtered query, kept apart so that
+  // neither evicts the other. Mutable since the http handlers only
+  // get a const master.
+  mutable StateCache stateCache;
+  mutable StateCache filteredStateCache;
+
   // Failover timeout for frameworks, in seconds.
   int failoverTimeout;
+
+  // Amount of time (in seconds) to batch up status updates before
+  // forwarding them to a framework (0 forwards each one immediately).
+  double statusUpdateBatchInterval;
+
+  // Status updates waiting to be sent to each framework.
+  hashmap<FrameworkID, StatusUpdatesMessage> pendingUpdates;
 };
 
 
@@ -244,9 +353,12 @@ struct Slave
         const SlaveID& _id,
         const UPID& _pid,
         double time)
-    : info(_info),
-      id(_id),
+    : id(_id),
+      info(_info),
+      resourcesTotal(_info.resources()),
       pid(_pid),
+      supportsRunTasks(false),
+      supportsStatusUpdateAcknowledgements(false),
       active(true),
       registeredTime(time),
       lastHeartbeat(time) {}
@@ -255,14 +367,19 @@ struct Slave
 
   Task* getTask(const FrameworkID& frameworkId, const TaskID& taskId)
   {
-    foreachvalue (Task* task, tasks) {
-      if (task->framework_id() == frameworkId &&
-          task->task_id() == taskId) {
-        return task;
-      }
-    }
+    hashmap<std::pair<FrameworkID, TaskID>, Task*>::const_iterator it =
+      tasks.find(std::make_pair(frameworkId, taskId));
+    return it != tasks.end() ? it->second : NULL;
+  }
 
-    return NULL;
+  // Returns the tasks of a framework running on this slave (copy the
+  // result before adding or removing any of them).
+  const hashset<Task*>& getTasks(const FrameworkID& frameworkId)
+  {
+    static const hashset<Task*> none;
+    hashmap<FrameworkID, hashset<Task*> >::const_iterator it =
+      frameworkTasks.find(frameworkId);
+    return it != frameworkTasks.end() ? it->second : none;
   }
 
   void addTask(Task* task)
@@ -271,6 +388,7 @@ struct Slave
       std::make_pair(task->framework_id(), task->task_id());
     CHECK(tasks.count(key) == 0);
     tasks[key] = task;
+    frameworkTasks[task->framework_id()].insert(task);
     resourcesInUse += task->resources();
   }
 
@@ -280,6 +398,10 @@ struct Slave
       std::make_pair(task->framework_id(), task->task_id());
     CHECK(tasks.count(key) > 0);
     tasks.erase(key);
+    frameworkTasks[task->framework_id()].erase(task);
+    if (frameworkTasks[task->framework_id()].size() == 0) {
+      frameworkTasks.erase(task->framework_id());
+    }
     resourcesInUse -= task->resources();
   }
 
@@ -328,22 +450,33 @@ struct Slave
     }
   }
 
-  Resources resourcesFree()
+  ResourceVector resourcesFree()
   {
-    return info.resources() - (resourcesOffered + resourcesInUse);
+    return resourcesTotal - (resourcesOffered + resourcesInUse);
   }
 
   const SlaveID id;
   const SlaveInfo info;
+  const ResourceVector resourcesTotal; // The slave's info.resources().
 
   UPID pid;
 
+  // Whether the slave understands RunTasksMessage (older slaves need
+  // to be sent a RunTaskMessage for each task).
+  bool supportsRunTasks;
+
+  // Whether the slave understands StatusUpdateAcknowledgementsMessage
+  // (older slaves need each status update to be acknowledged with a
+  // StatusUpdateAcknowledgementMessage, so their updates never get
+  // batched on the way to a framework).
+  bool supportsStatusUpdateAcknowledgements;
+
   bool active; // Turns false when slave is being removed.
   double registeredTime;
   double lastHeartbeat;
 
-  Resources resourcesOffered; // Resources currently in offers.
-  Resources resourcesInUse;   // Resources currently used by tasks.
+  ResourceVector resourcesOffered; // Resources currently in offers.
+  ResourceVector resourcesInUse;   // Resources currently used by tasks.
 
   // Executors running on this slave.
   hashmap<FrameworkID, hashmap<ExecutorID, ExecutorInfo> > executors;
@@ -351,6 +484,9 @@ struct Slave
   // Tasks running on this slave, indexed by FrameworkID x TaskID.
   hashmap<std::pair<FrameworkID, TaskID>, Task*> tasks;
 
+  // The same tasks, indexed by FrameworkID.
+  hashmap<FrameworkID, hashset<Task*> > frameworkTasks;
+
   // Active offers on this slave.
   hashset<Offer*> offers;
 
@@ -368,6 +504,7 @@ struct Framework
     : info(_info),
       id(_id),
       pid(_pid),
+      supportsBatchedStatusUpdates(false),
       active(true),
       registeredTime(time),
       reregisteredTime(time) {}
@@ -376,17 +513,25 @@ struct Framework
 
   Task* getTask(const TaskID& taskId)
   {
-    if (tasks.count(taskId) > 0) {
-      return tasks[taskId];
-    } else {
-      return NULL;
-    }
+    hashmap<TaskID, Task*>::const_iterator it = tasks.find(taskId);
+    return it != tasks.end() ? it->second : NULL;
+  }
+
+  // Returns the tasks of this framework running on a slave (copy the
+  // result before adding or removing any of them).
+  const hashset<Task*>& getTasks(const SlaveID& slaveId)
+  {
+    static const hashset<Task*> none;
+    hashmap<SlaveID, hashset<Task*> >::const_iterator it =
+      slaveTasks.find(slaveId);
+    return it != slaveTasks.end() ? it->second : none;
   }
 
   void addTask(Task* task)
   {
     CHECK(!tasks.contains(task->task_id()));
     tasks[task->task_id()] = task;
+    slaveTasks[task->slave_id()].insert(task);
     resources += task->resources();
   }
 
@@ -401,6 +546,10 @@ struct Framework
     }
 
     tasks.erase(task->task_id());
+    slaveTasks[task->slave_id()].erase(task);
+    if (slaveTasks[task->slave_id()].size() == 0) {
+      slaveTasks.erase(task->slave_id());
+    }
     resources -= task->resources();
   }
 
@@ -469,6 +618,11 @@ struct Framework
 
   UPID pid;
 
+  // Whether the scheduler driver understands StatusUpdatesMessage
+  // (older drivers need each status update in its own
+  // StatusUpdateMessage, so their updates never get batched).
+  bool supportsBatchedStatusUpdates;
+
   bool active; // Turns false when framework is being removed.
   double registeredTime;
   double reregisteredTime;
@@ -476,11 +630,15 @@ struct Framework
 
   hashmap<TaskID, Task*> tasks;
 
+  // The same tasks, indexed by the slave they are running on.
+  hashmap<SlaveID, hashset<Task*> > slaveTasks;
+
   std::list<Task> completedTasks;
 
   hashset<Offer*> offers; // Active offers for framework.
 
-  Resources resources; // Total resources (tasks + offers + executors).
+  // Total resources (tasks + offers + executors).
+  ResourceVector resources;
   hashmap<SlaveID, hashmap<ExecutorID, ExecutorInfo> > executors;
 
   // Contains a time of unfiltering for each slave we've filtered,
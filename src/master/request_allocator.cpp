@@ -0,0 +1,346 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <string>
+
+#include <glog/logging.h>
+
+#include "master/request_allocator.hpp"
+
+using std::list;
+using std::make_pair;
+using std::max;
+using std::multimap;
+using std::pair;
+using std::string;
+using std::vector;
+
+
+namespace mesos {
+namespace internal {
+namespace master {
+
+void RequestAllocator::initialize(Master* _master)
+{
+  master = _master;
+  initialized = true;
+}
+
+
+void RequestAllocator::frameworkAdded(Framework* framework)
+{
+  CHECK(initialized);
+
+  LOG(INFO) << "Added framework " << framework->id;
+
+  frameworks[framework->id] = framework;
+}
+
+
+void RequestAllocator::frameworkRemoved(Framework* framework)
+{
+  CHECK(initialized);
+
+  frameworks.erase(framework->id);
+  requests.erase(framework->id);
+
+  LOG(INFO) << "Removed framework " << framework->id;
+
+  // The master removes the framework's executors without telling us
+  // about the resources they were using.
+  foreachkey (const SlaveID& slaveId, framework->executors) {
+    update(slaveId);
+  }
+
+  allocate();
+}
+
+
+void RequestAllocator::slaveAdded(Slave* slave)
+{
+  CHECK(initialized);
+
+  LOG(INFO) << "Added slave " << slave->id
+            << " with " << slave->info.resources();
+
+  slaves[slave->id] = slave;
+
+  totalResources += slave->info.resources();
+
+  update(slave->id);
+  allocate();
+}
+
+
+void RequestAllocator::slaveRemoved(Slave* slave)
+{
+  CHECK(initialized);
+
+  LOG(INFO) << "Removed slave " << slave->id;
+
+  unindex(slave->id);
+  slaves.erase(slave->id);
+
+  totalResources -= slave->info.resources();
+}
+
+
+void RequestAllocator::resourcesRequested(
+    const FrameworkID& frameworkId,
+    const vector<ResourceRequest>& _requests)
+{
+  CHECK(initialized);
+
+  LOG(INFO) << "Received " << _requests.size()
+            << " resource requests from framework " << frameworkId;
+
+  if (!frameworks.contains(frameworkId)) {
+    LOG(WARNING) << "Ignoring resource requests from unknown framework "
+                 << frameworkId;
+    return;
+  }
+
+  foreach (const ResourceRequest& _request, _requests) {
+    Request request;
+    request.anySlave = !_request.has_slave_id();
+    request.slaveId = _request.slave_id();
+    request.resources = ResourceVector(_request.resources()).allocatable();
+
+    if (request.resources.size() == 0) {
+      LOG(WARNING) << "Ignoring resource request from framework "
+                   << frameworkId << " without any allocatable resources";
+      continue;
+    }
+
+    requests[frameworkId].push_back(request);
+  }
+
+  allocate();
+}
+
+
+void RequestAllocator::resourcesUnused(
+    const FrameworkID& frameworkId,
+    const SlaveID& slaveId,
+    const Resources& resources)
+{
+  CHECK(initialized);
+
+  if (resources.allocatable().size() > 0) {
+    VLOG(1) << "Framework " << frameworkId
+            << " left " << resources.allocatable()
+            << " unused on slave " << slaveId;
+  }
+
+  update(slaveId);
+  allocate();
+}
+
+
+void RequestAllocator::resourcesRecovered(
+    const FrameworkID& frameworkId,
+    const SlaveID& slaveId,
+    const Resources& resources)
+{
+  CHECK(initialized);
+
+  if (resources.allocatable().size() > 0) {
+    VLOG(1) << "Recovered " << resources.allocatable()
+            << " on slave " << slaveId
+            << " from framework " << frameworkId;
+  }
+
+  update(slaveId);
+  allocate();
+}
+
+
+void RequestAllocator::offersRevived(Framework* framework)
+{
+  CHECK(initialized);
+
+  // Filters don't apply to resources a framework asked for, so there
+  // is nothing to revive (a framework gets offers by requesting them).
+  VLOG(1) << "Ignoring revive offers from framework " << framework->id;
+}
+
+
+void RequestAllocator::timerTick()
+{
+  CHECK(initialized);
+
+  // Not every change to a slave's resources gets reported to the
+  // allocator (e.g., a slave re-registering with running tasks), so
+  // resynchronize every slave each tick.
+  foreachkey (const SlaveID& slaveId, slaves) {
+    update(slaveId);
+  }
+
+  allocate();
+}
+
+
+double RequestAllocator::share(Framework* framework)
+{
+  double share = 0;
+
+  for (uint32_t id = 0; id < totalResources.scalarsSize(); id++) {
+    double total = totalResources.scalar(id);
+    if (total > 0) {
+      share = max(share, framework->resources.scalar(id) / total);
+    }
+  }
+
+  return share;
+}
+
+
+void RequestAllocator::update(const SlaveID& slaveId)
+{
+  if (slaves.contains(slaveId) && slaves[slaveId]->active) {
+    index(slaveId, slaves[slaveId]->resourcesFree().allocatable());
+  } else {
+    unindex(slaveId);
+  }
+}
+
+
+void RequestAllocator::index(
+    const SlaveID& slaveId,
+    const ResourceVector& resources)
+{
+  unindex(slaveId);
+
+  freeResources[slaveId] = resources;
+  const double cpus = resources.scalar(ResourceVector::CPUS);
+  slavesByCpus.insert(make_pair(cpus, slaveId));
+}
+
+
+void RequestAllocator::unindex(const SlaveID& slaveId)
+{
+  if (!freeResources.contains(slaveId)) {
+    return;
+  }
+
+  const double cpus = freeResources[slaveId].scalar(ResourceVector::CPUS);
+
+  pair<multimap<double, SlaveID>::iterator,
+       multimap<double, SlaveID>::iterator> range =
+    slavesByCpus.equal_range(cpus);
+
+  for (multimap<double, SlaveID>::iterator it = range.first;
+       it != range.second; ++it) {
+    if (it->second == slaveId) {
+      slavesByCpus.erase(it);
+      break;
+    }
+  }
+
+  freeResources.erase(slaveId);
+}
+
+
+Slave* RequestAllocator::match(const Request& request)
+{
+  if (!request.anySlave) {
+    if (freeResources.contains(request.slaveId) &&
+        request.resources <= freeResources[request.slaveId]) {
+      return slaves[request.slaveId];
+    }
+    return NULL;
+  }
+
+  // Every slave before this one has too few cpus.
+  multimap<double, SlaveID>::const_iterator it =
+    slavesByCpus.lower_bound(request.resources.scalar(ResourceVector::CPUS));
+
+  for (; it != slavesByCpus.end(); ++it) {
+    if (request.resources <= freeResources[it->second]) {
+      return slaves[it->second];
+    }
+  }
+
+  return NULL;
+}
+
+
+void RequestAllocator::allocate()
+{
+  if (requests.empty() || slavesByCpus.empty()) {
+    return;
+  }
+
+  // Get the (active) frameworks with outstanding requests in the
+  // order to serve them (ties are broken by id).
+  multimap<pair<double, string>, Framework*> ordering;
+  foreachkey (const FrameworkID& frameworkId, requests) {
+    Framework* framework = frameworks[frameworkId];
+    if (framework->active) {
+      pair<double, string> key(share(framework), frameworkId.value());
+      ordering.insert(make_pair(key, framework));
+    }
+  }
+
+  foreachvalue (Framework* framework, ordering) {
+    hashmap<Slave*, ResourceVector> offered;
+
+    list<Request>& pending = requests[framework->id];
+    list<Request>::iterator it = pending.begin();
+    while (it != pending.end()) {
+      Slave* slave = match(*it);
+      if (slave != NULL) {
+        VLOG(1) << "Offering " << it->resources
+                << " on slave " << slave->id
+                << " to framework " << framework->id;
+        offered[slave] += it->resources;
+        index(slave->id, freeResources[slave->id] - it->resources);
+        pending.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+
+    if (pending.empty()) {
+      requests.erase(framework->id);
+    }
+
+    if (offered.size() > 0) {
+      hashmap<Slave*, Resources> offerable;
+      foreachpair (Slave* slave, const ResourceVector& resources, offered) {
+        offerable[slave] = resources.resources();
+      }
+
+      master->makeOffers(framework, offerable);
+
+      // Pick up the offered resources from the master's view.
+      foreachkey (Slave* slave, offerable) {
+        update(slave->id);
+      }
+    }
+
+    if (slavesByCpus.empty()) {
+      break;
+    }
+  }
+}
+
+} // namespace master {
+} // namespace internal {
+} // namespace mesos {
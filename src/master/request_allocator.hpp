@@ -0,0 +1,138 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REQUEST_ALLOCATOR_HPP__
+#define __REQUEST_ALLOCATOR_HPP__
+
+#include <list>
+#include <map>
+#include <vector>
+
+#include "common/hashmap.hpp"
+#include "common/resource_vector.hpp"
+
+#include "master/allocator.hpp"
+
+
+namespace mesos {
+namespace internal {
+namespace master {
+
+// Only offers resources to frameworks that have asked for them (see
+// SchedulerDriver::requestResources) rather than pushing the free
+// resources to every framework. Each ResourceRequest a framework
+// makes gets queued until there is a slave with enough free resources
+// (either the slave in the request or, if no slave was specified, any
+// slave) and then gets offered exactly the resources it asked for.
+// Frameworks with outstanding requests are served in order of their
+// dominant share and each framework's requests are served in the
+// order they were made. To find a slave for a request quickly the
+// slaves are kept in an index ordered by their free cpus, so matching
+// a request starts at the slaves that have just enough cpus (i.e.,
+// best fit on cpus) and only needs to check the other resources.
+class RequestAllocator : public Allocator
+{
+public:
+  RequestAllocator(): initialized(false) {}
+
+  virtual ~RequestAllocator() {}
+
+  virtual void initialize(Master* _master);
+
+  virtual void frameworkAdded(Framework* framework);
+
+  virtual void frameworkRemoved(Framework* framework);
+
+  virtual void slaveAdded(Slave* slave);
+
+  virtual void slaveRemoved(Slave* slave);
+
+  virtual void resourcesRequested(
+      const FrameworkID& frameworkId,
+      const std::vector<ResourceRequest>& requests);
+
+  virtual void resourcesUnused(
+    const FrameworkID& frameworkId,
+    const SlaveID& slaveId,
+    const Resources& resources);
+
+  virtual void resourcesRecovered(
+    const FrameworkID& frameworkId,
+    const SlaveID& slaveId,
+    const Resources& resources);
+
+  virtual void offersRevived(Framework* framework);
+
+  virtual void timerTick();
+
+private:
+  // A request that has not been satisfied yet.
+  struct Request
+  {
+    bool anySlave; // True if the request did not specify a slave.
+    SlaveID slaveId;
+    ResourceVector resources;
+  };
+
+  // Returns the dominant share of a framework.
+  double share(Framework* framework);
+
+  // Updates the free resources of a slave (from the master's view of
+  // the slave) and its place in the index.
+  void update(const SlaveID& slaveId);
+
+  // Sets the free resources of a slave and its place in the index.
+  void index(const SlaveID& slaveId, const ResourceVector& resources);
+
+  // Removes a slave from the index.
+  void unindex(const SlaveID& slaveId);
+
+  // Returns a slave with enough free resources for the request, or
+  // NULL if there is no such slave right now.
+  Slave* match(const Request& request);
+
+  // Offers resources for as many of the outstanding requests as
+  // possible.
+  void allocate();
+
+  bool initialized;
+
+  Master* master;
+
+  ResourceVector totalResources;
+
+  hashmap<FrameworkID, Framework*> frameworks;
+
+  hashmap<SlaveID, Slave*> slaves;
+
+  // Outstanding requests of each framework (in the order they were
+  // made). Frameworks without any outstanding requests are not in
+  // here.
+  hashmap<FrameworkID, std::list<Request> > requests;
+
+  // The free (allocatable) resources of each active slave, and the
+  // slaves indexed by their free cpus.
+  hashmap<SlaveID, ResourceVector> freeResources;
+  std::multimap<double, SlaveID> slavesByCpus;
+};
+
+} // namespace master {
+} // namespace internal {
+} // namespace mesos {
+
+#endif // __REQUEST_ALLOCATOR_HPP__
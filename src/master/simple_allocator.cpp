@@ -22,6 +22,9 @@
 
 #include <algorithm>
 
+#include <process/process.hpp>
+#include <process/timer.hpp>
+
 #include "common/utils.hpp"
 
 #include "master/simple_allocator.hpp"
@@ -30,6 +33,8 @@ using std::max;
 using std::sort;
 using std::vector;
 
+using process::Clock;
+
 
 namespace mesos {
 namespace internal {
@@ -39,6 +44,17 @@ void SimpleAllocator::initialize(Master* _master)
 {
   master = _master;
   initialized = true;
+
+  allocationInterval =
+    master->conf.get<double>("allocation_interval", 0.0);
+
+  int threshold = master->conf.get<int>("allocation_dirty_threshold", 100);
+  if (threshold < 0) {
+    LOG(FATAL) << "Expecting a non-negative --allocation_dirty_threshold"
+               << " (got " << threshold << ")";
+  }
+
+  allocationDirtyThreshold = threshold;
 }
 
 
@@ -46,7 +62,8 @@ void SimpleAllocator::frameworkAdded(Framework* framework)
 {
   CHECK(initialized);
   LOG(INFO) << "Added framework " << framework->id;
-  makeNewOffers();
+  dirtyFrameworks.insert(framework->id);
+  scheduleAllocation();
 }
 
 
@@ -60,7 +77,9 @@ void SimpleAllocator::frameworkRemoved(Framework* framework)
 
   LOG(INFO) << "Removed framework " << framework->id;
 
-  makeNewOffers();
+  // The allocation ordering changed, so look at every slave again.
+  dirtyFrameworks.insert(framework->id);
+  scheduleAllocation();
 }
 
 
@@ -72,7 +91,8 @@ void SimpleAllocator::slaveAdded(Slave* slave)
             << " with " << slave->info.resources();
 
   totalResources += slave->info.resources();
-  makeNewOffers(slave);
+  dirtySlaves.insert(slave->id);
+  scheduleAllocation();
 }
 
 
@@ -84,6 +104,7 @@ void SimpleAllocator::slaveRemoved(Slave* slave)
 
   totalResources -= slave->info.resources();
   refusers.remove(slave->id);
+  dirtySlaves.erase(slave->id);
 }
 
 
@@ -111,7 +132,8 @@ void SimpleAllocator::resourcesUnused(
     refusers.put(slaveId, frameworkId);
   }
 
-  makeNewOffers();
+  dirtySlaves.insert(slaveId);
+  scheduleAllocation();
 }
 
 
@@ -129,7 +151,8 @@ void SimpleAllocator::resourcesRecovered(
     refusers.remove(slaveId);
   }
 
-  makeNewOffers();
+  dirtySlaves.insert(slaveId);
+  scheduleAllocation();
 }
 
 
@@ -144,22 +167,65 @@ void SimpleAllocator::offersRevived(Framework* framework)
   // decisions.
   LOG(INFO) << "Filters removed for framework " << framework->id;
 
-  makeNewOffers();
+  dirtyFrameworks.insert(framework->id);
+  scheduleAllocation();
 }
 
 
 void SimpleAllocator::timerTick()
 {
   CHECK(initialized);
+
+  // Filters might have expired on any slave, so look at all of them
+  // (which takes care of anything that was dirty too).
+  dirtySlaves.clear();
+  dirtyFrameworks.clear();
   makeNewOffers();
 }
 
 
+void SimpleAllocator::allocate()
+{
+  CHECK(initialized);
+
+  allocationPending = false;
+
+  if (dirtyFrameworks.size() > 0) {
+    dirtySlaves.clear();
+    dirtyFrameworks.clear();
+    makeNewOffers();
+  } else if (dirtySlaves.size() > 0) {
+    vector<Slave*> slaves;
+    foreach (const SlaveID& slaveId, dirtySlaves) {
+      Slave* slave = master->getSlave(slaveId);
+      if (slave != NULL) {
+        slaves.push_back(slave);
+      }
+    }
+    dirtySlaves.clear();
+    makeNewOffers(slaves);
+  }
+}
+
+
+void SimpleAllocator::scheduleAllocation()
+{
+  if (allocationInterval <= 0 ||
+      dirtySlaves.size() + dirtyFrameworks.size() >=
+      allocationDirtyThreshold) {
+    allocate();
+  } else if (!allocationPending) {
+    allocationPending = true;
+    delay(allocationInterval, master->self(), &Master::allocate);
+  }
+}
+
+
 namespace {
 
 struct DominantShareComparator
 {
-  DominantShareComparator(const Resources& _resources)
+  DominantShareComparator(const ResourceVector& _resources)
     : resources(_resources) {}
 
   bool operator () (Framework* framework1, Framework* framework2)
@@ -171,19 +237,12 @@ struct DominantShareComparator
     // currently does not take into account resources that are not
     // scalars.
 
-    foreach (const Resource& resource, resources) {
-      if (resource.type() == Resource::SCALAR) {
-        double total = resource.scalar().value();
-
-        if (total > 0) {
-          Resource::Scalar none;
-          const Resource::Scalar& scalar1 =
-            framework1->resources.get(resource.name(), none);
-          const Resource::Scalar& scalar2 =
-            framework2->resources.get(resource.name(), none);
-          share1 = max(share1, scalar1.value() / total);
-          share2 = max(share2, scalar2.value() / total);
-        }
+    for (uint32_t id = 0; id < resources.scalarsSize(); id++) {
+      double total = resources.scalar(id);
+
+      if (total > 0) {
+        share1 = max(share1, framework1->resources.scalar(id) / total);
+        share2 = max(share2, framework2->resources.scalar(id) / total);
       }
     }
 
@@ -195,7 +254,7 @@ struct DominantShareComparator
     }
   }
 
-  Resources resources;
+  const ResourceVector& resources;
 };
 
 } // namespace {
@@ -220,18 +279,22 @@ void SimpleAllocator::makeNewOffers()
 }
 
 
-void SimpleAllocator::makeNewOffers(Slave* slave)
+void SimpleAllocator::makeNewOffers(const vector<Slave*>& slaves)
 {
   CHECK(initialized) << "Cannot make new offers before initialization!";
-  vector<Slave*> slaves;
-  slaves.push_back(slave);
-  makeNewOffers(slaves);
+
+  double start = Clock::now();
+
+  allocate(slaves);
+
+  master->stats.allocationRounds++;
+  master->stats.allocationSlavesExamined += slaves.size();
+  master->stats.allocationTime += Clock::now() - start;
 }
 
 
-void SimpleAllocator::makeNewOffers(const vector<Slave*>& slaves)
+void SimpleAllocator::allocate(const vector<Slave*>& slaves)
 {
-  CHECK(initialized) << "Cannot make new offers before initialization!";
   // Get an ordering of frameworks to send offers to
   vector<Framework*> ordering = getAllocationOrdering();
   if (ordering.empty()) {
@@ -243,7 +306,7 @@ void SimpleAllocator::makeNewOffers(const vector<Slave*>& slaves)
   hashmap<Slave*, Resources> available;
   foreach (Slave* slave, slaves) {
     if (slave->active) {
-      Resources resources = slave->resourcesFree().allocatable();
+      ResourceVector resources = slave->resourcesFree().allocatable();
 
       // TODO(benh): For now, only make offers when there is some cpu
       // and memory left. This is an artifact of the original code
@@ -257,14 +320,11 @@ void SimpleAllocator::makeNewOffers(const vector<Slave*>& slaves)
       // resources, rather than the master pushing resources out to
       // frameworks.
 
-      Resource::Scalar none;
-      Resource::Scalar cpus = resources.get("cpus", none);
-      Resource::Scalar mem = resources.get("mem", none);
-
-      if (cpus.value() >= MIN_CPUS && mem.value() > MIN_MEM) {
+      if (resources.scalar(ResourceVector::CPUS) >= MIN_CPUS &&
+          resources.scalar(ResourceVector::MEM) > MIN_MEM) {
         VLOG(1) << "Found available resources: " << resources
                 << " on slave " << slave->id;
-        available[slave] = resources;
+        available[slave] = resources.resources();
       }
     }
   }
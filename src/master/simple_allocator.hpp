@@ -22,7 +22,9 @@
 #include <vector>
 
 #include "common/hashmap.hpp"
+#include "common/hashset.hpp"
 #include "common/multihashmap.hpp"
+#include "common/resource_vector.hpp"
 
 #include "master/allocator.hpp"
 
@@ -31,10 +33,17 @@ namespace mesos {
 namespace internal {
 namespace master {
 
+// Rather than doing an allocation on every event, the slaves and
+// frameworks that changed get marked as dirty and a single allocation
+// gets done for all of them after --allocation_interval seconds (or as
+// soon as --allocation_dirty_threshold of them are dirty). An
+// allocation only looks at the dirty slaves, unless a framework
+// changed in which case every slave gets looked at.
 class SimpleAllocator : public Allocator
 {
 public:
-  SimpleAllocator(): initialized(false) {}
+  SimpleAllocator()
+    : initialized(false), allocationPending(false) {}
 
   virtual ~SimpleAllocator() {}
 
@@ -66,24 +75,41 @@ public:
 
   virtual void timerTick();
 
+  virtual void allocate();
+
 private:
+  // Does an allocation now or (if there is an allocation interval)
+  // makes sure one happens later.
+  void scheduleAllocation();
+
   // Get an ordering to consider frameworks in for launching tasks.
   std::vector<Framework*> getAllocationOrdering();
 
   // Look at the full state of the cluster and send out offers.
   void makeNewOffers();
 
-  // Make resource offers for just one slave.
-  void makeNewOffers(Slave* slave);
-
-  // Make resource offers for a subset of the slaves.
+  // Make resource offers for a subset of the slaves (accounting for
+  // the allocation in the master's statistics).
   void makeNewOffers(const std::vector<Slave*>& slaves);
 
+  // Does the work of makeNewOffers.
+  void allocate(const std::vector<Slave*>& slaves);
+
   bool initialized;
 
   Master* master;
 
-  Resources totalResources;
+  double allocationInterval;
+  size_t allocationDirtyThreshold;
+
+  // Whether an allocation has been delayed (see scheduleAllocation).
+  bool allocationPending;
+
+  // Slaves and frameworks that changed since the last allocation.
+  hashset<SlaveID> dirtySlaves;
+  hashset<FrameworkID> dirtyFrameworks;
+
+  ResourceVector totalResources;
 
   // Remember which frameworks refused each slave "recently"; this is
   // cleared when the slave's free resources go up or when everyone
@@ -32,6 +32,12 @@ const ::google::protobuf::Descriptor* Action_Truncate_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Action_Truncate_reflection_ = NULL;
 const ::google::protobuf::EnumDescriptor* Action_Type_descriptor_ = NULL;
+const ::google::protobuf::Descriptor* Checkpoint_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Checkpoint_reflection_ = NULL;
+const ::google::protobuf::Descriptor* Checkpoint_Range_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Checkpoint_Range_reflection_ = NULL;
 const ::google::protobuf::Descriptor* Record_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Record_reflection_ = NULL;
@@ -48,6 +54,12 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* WriteResponse_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   WriteResponse_reflection_ = NULL;
+const ::google::protobuf::Descriptor* BatchWriteRequest_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  BatchWriteRequest_reflection_ = NULL;
+const ::google::protobuf::Descriptor* BatchWriteResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  BatchWriteResponse_reflection_ = NULL;
 const ::google::protobuf::Descriptor* LearnRequest_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   LearnRequest_reflection_ = NULL;
@@ -57,6 +69,12 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* LearnedMessage_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   LearnedMessage_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CatchupRequest_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CatchupRequest_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CatchupResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CatchupResponse_reflection_ = NULL;
 
 }  // namespace
 
@@ -150,11 +168,47 @@ void protobuf_AssignDesc_log_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Action_Truncate));
   Action_Type_descriptor_ = Action_descriptor_->enum_type(0);
-  Record_descriptor_ = file->message_type(2);
-  static const int Record_offsets_[3] = {
+  Checkpoint_descriptor_ = file->message_type(2);
+  static const int Checkpoint_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint, coordinator_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint, begin_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint, end_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint, holes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint, unlearned_),
+  };
+  Checkpoint_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Checkpoint_descriptor_,
+      Checkpoint::default_instance_,
+      Checkpoint_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Checkpoint));
+  Checkpoint_Range_descriptor_ = Checkpoint_descriptor_->nested_type(0);
+  static const int Checkpoint_Range_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint_Range, from_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint_Range, to_),
+  };
+  Checkpoint_Range_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Checkpoint_Range_descriptor_,
+      Checkpoint_Range::default_instance_,
+      Checkpoint_Range_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint_Range, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Checkpoint_Range, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Checkpoint_Range));
+  Record_descriptor_ = file->message_type(3);
+  static const int Record_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Record, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Record, promise_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Record, action_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Record, checkpoint_),
   };
   Record_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -168,7 +222,7 @@ void protobuf_AssignDesc_log_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Record));
   Record_Type_descriptor_ = Record_descriptor_->enum_type(0);
-  PromiseRequest_descriptor_ = file->message_type(3);
+  PromiseRequest_descriptor_ = file->message_type(4);
   static const int PromiseRequest_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PromiseRequest, id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PromiseRequest, position_),
@@ -184,7 +238,7 @@ void protobuf_AssignDesc_log_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(PromiseRequest));
-  PromiseResponse_descriptor_ = file->message_type(4);
+  PromiseResponse_descriptor_ = file->message_type(5);
   static const int PromiseResponse_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PromiseResponse, okay_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PromiseResponse, id_),
@@ -202,7 +256,7 @@ void protobuf_AssignDesc_log_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(PromiseResponse));
-  WriteRequest_descriptor_ = file->message_type(5);
+  WriteRequest_descriptor_ = file->message_type(6);
   static const int WriteRequest_offsets_[7] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WriteRequest, id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WriteRequest, position_),
@@ -223,7 +277,7 @@ void protobuf_AssignDesc_log_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(WriteRequest));
-  WriteResponse_descriptor_ = file->message_type(6);
+  WriteResponse_descriptor_ = file->message_type(7);
   static const int WriteResponse_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WriteResponse, okay_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WriteResponse, id_),
@@ -240,7 +294,41 @@ void protobuf_AssignDesc_log_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(WriteResponse));
-  LearnRequest_descriptor_ = file->message_type(7);
+  BatchWriteRequest_descriptor_ = file->message_type(8);
+  static const int BatchWriteRequest_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchWriteRequest, id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchWriteRequest, writes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchWriteRequest, learned_),
+  };
+  BatchWriteRequest_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      BatchWriteRequest_descriptor_,
+      BatchWriteRequest::default_instance_,
+      BatchWriteRequest_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchWriteRequest, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchWriteRequest, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(BatchWriteRequest));
+  BatchWriteResponse_descriptor_ = file->message_type(9);
+  static const int BatchWriteResponse_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchWriteResponse, okay_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchWriteResponse, id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchWriteResponse, positions_),
+  };
+  BatchWriteResponse_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      BatchWriteResponse_descriptor_,
+      BatchWriteResponse::default_instance_,
+      BatchWriteResponse_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchWriteResponse, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchWriteResponse, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(BatchWriteResponse));
+  LearnRequest_descriptor_ = file->message_type(10);
   static const int LearnRequest_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LearnRequest, position_),
   };
@@ -255,7 +343,7 @@ void protobuf_AssignDesc_log_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(LearnRequest));
-  LearnResponse_descriptor_ = file->message_type(8);
+  LearnResponse_descriptor_ = file->message_type(11);
   static const int LearnResponse_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LearnResponse, okay_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LearnResponse, action_),
@@ -271,7 +359,7 @@ void protobuf_AssignDesc_log_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(LearnResponse));
-  LearnedMessage_descriptor_ = file->message_type(9);
+  LearnedMessage_descriptor_ = file->message_type(12);
   static const int LearnedMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LearnedMessage, action_),
   };
@@ -286,6 +374,39 @@ void protobuf_AssignDesc_log_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(LearnedMessage));
+  CatchupRequest_descriptor_ = file->message_type(13);
+  static const int CatchupRequest_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CatchupRequest, id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CatchupRequest, from_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CatchupRequest, to_),
+  };
+  CatchupRequest_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CatchupRequest_descriptor_,
+      CatchupRequest::default_instance_,
+      CatchupRequest_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CatchupRequest, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CatchupRequest, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CatchupRequest));
+  CatchupResponse_descriptor_ = file->message_type(14);
+  static const int CatchupResponse_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CatchupResponse, id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CatchupResponse, actions_),
+  };
+  CatchupResponse_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CatchupResponse_descriptor_,
+      CatchupResponse::default_instance_,
+      CatchupResponse_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CatchupResponse, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CatchupResponse, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CatchupResponse));
 }
 
 namespace {
@@ -308,6 +429,10 @@ void protobuf_RegisterTypes(const ::std::string&) {
     Action_Append_descriptor_, &Action_Append::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Action_Truncate_descriptor_, &Action_Truncate::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Checkpoint_descriptor_, &Checkpoint::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Checkpoint_Range_descriptor_, &Checkpoint_Range::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Record_descriptor_, &Record::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -318,12 +443,20 @@ void protobuf_RegisterTypes(const ::std::string&) {
     WriteRequest_descriptor_, &WriteRequest::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     WriteResponse_descriptor_, &WriteResponse::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    BatchWriteRequest_descriptor_, &BatchWriteRequest::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    BatchWriteResponse_descriptor_, &BatchWriteResponse::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     LearnRequest_descriptor_, &LearnRequest::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     LearnResponse_descriptor_, &LearnResponse::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     LearnedMessage_descriptor_, &LearnedMessage::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CatchupRequest_descriptor_, &CatchupRequest::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CatchupResponse_descriptor_, &CatchupResponse::default_instance());
 }
 
 }  // namespace
@@ -339,6 +472,10 @@ void protobuf_ShutdownFile_log_2eproto() {
   delete Action_Append_reflection_;
   delete Action_Truncate::default_instance_;
   delete Action_Truncate_reflection_;
+  delete Checkpoint::default_instance_;
+  delete Checkpoint_reflection_;
+  delete Checkpoint_Range::default_instance_;
+  delete Checkpoint_Range_reflection_;
   delete Record::default_instance_;
   delete Record_reflection_;
   delete PromiseRequest::default_instance_;
@@ -349,12 +486,20 @@ void protobuf_ShutdownFile_log_2eproto() {
   delete WriteRequest_reflection_;
   delete WriteResponse::default_instance_;
   delete WriteResponse_reflection_;
+  delete BatchWriteRequest::default_instance_;
+  delete BatchWriteRequest_reflection_;
+  delete BatchWriteResponse::default_instance_;
+  delete BatchWriteResponse_reflection_;
   delete LearnRequest::default_instance_;
   delete LearnRequest_reflection_;
   delete LearnResponse::default_instance_;
   delete LearnResponse_reflection_;
   delete LearnedMessage::default_instance_;
   delete LearnedMessage_reflection_;
+  delete CatchupRequest::default_instance_;
+  delete CatchupRequest_reflection_;
+  delete CatchupResponse::default_instance_;
+  delete CatchupResponse_reflection_;
 }
 
 void protobuf_AddDesc_log_2eproto() {
@@ -375,27 +520,42 @@ void protobuf_AddDesc_log_2eproto() {
     "Action.Truncate\032\005\n\003Nop\032&\n\006Append\022\r\n\005byte"
     "s\030\001 \002(\014\022\r\n\005cksum\030\002 \001(\014\032\026\n\010Truncate\022\n\n\002to"
     "\030\001 \002(\004\")\n\004Type\022\007\n\003NOP\020\001\022\n\n\006APPEND\020\002\022\014\n\010T"
-    "RUNCATE\020\003\"\262\001\n\006Record\022-\n\004type\030\001 \002(\0162\037.mes"
-    "os.internal.log.Record.Type\022,\n\007promise\030\002"
-    " \001(\0132\033.mesos.internal.log.Promise\022*\n\006act"
-    "ion\030\003 \001(\0132\032.mesos.internal.log.Action\"\037\n"
-    "\004Type\022\013\n\007PROMISE\020\001\022\n\n\006ACTION\020\002\".\n\016Promis"
-    "eRequest\022\n\n\002id\030\001 \002(\004\022\020\n\010position\030\002 \001(\004\"i"
-    "\n\017PromiseResponse\022\014\n\004okay\030\001 \002(\010\022\n\n\002id\030\002 "
-    "\002(\004\022\020\n\010position\030\004 \001(\004\022*\n\006action\030\003 \001(\0132\032."
-    "mesos.internal.log.Action\"\203\002\n\014WriteReque"
-    "st\022\n\n\002id\030\001 \002(\004\022\020\n\010position\030\002 \002(\004\022\017\n\007lear"
-    "ned\030\003 \001(\010\022-\n\004type\030\004 \002(\0162\037.mesos.internal"
-    ".log.Action.Type\022+\n\003nop\030\005 \001(\0132\036.mesos.in"
-    "ternal.log.Action.Nop\0221\n\006append\030\006 \001(\0132!."
-    "mesos.internal.log.Action.Append\0225\n\010trun"
-    "cate\030\007 \001(\0132#.mesos.internal.log.Action.T"
-    "runcate\";\n\rWriteResponse\022\014\n\004okay\030\001 \002(\010\022\n"
-    "\n\002id\030\002 \002(\004\022\020\n\010position\030\003 \002(\004\" \n\014LearnReq"
-    "uest\022\020\n\010position\030\001 \002(\004\"I\n\rLearnResponse\022"
-    "\014\n\004okay\030\001 \002(\010\022*\n\006action\030\002 \001(\0132\032.mesos.in"
-    "ternal.log.Action\"<\n\016LearnedMessage\022*\n\006a"
-    "ction\030\001 \002(\0132\032.mesos.internal.log.Action", 1279);
+    "RUNCATE\020\003\"\316\001\n\nCheckpoint\022\023\n\013coordinator\030"
+    "\001 \002(\004\022\r\n\005begin\030\002 \002(\004\022\013\n\003end\030\003 \002(\004\0223\n\005hol"
+    "es\030\004 \003(\0132$.mesos.internal.log.Checkpoint"
+    ".Range\0227\n\tunlearned\030\005 \003(\0132$.mesos.intern"
+    "al.log.Checkpoint.Range\032!\n\005Range\022\014\n\004from"
+    "\030\001 \002(\004\022\n\n\002to\030\002 \002(\004\"\366\001\n\006Record\022-\n\004type\030\001 "
+    "\002(\0162\037.mesos.internal.log.Record.Type\022,\n\007"
+    "promise\030\002 \001(\0132\033.mesos.internal.log.Promi"
+    "se\022*\n\006action\030\003 \001(\0132\032.mesos.internal.log."
+    "Action\0222\n\ncheckpoint\030\004 \001(\0132\036.mesos.inter"
+    "nal.log.Checkpoint\"/\n\004Type\022\013\n\007PROMISE\020\001\022"
+    "\n\n\006ACTION\020\002\022\016\n\nCHECKPOINT\020\003\".\n\016PromiseRe"
+    "quest\022\n\n\002id\030\001 \002(\004\022\020\n\010position\030\002 \001(\004\"i\n\017P"
+    "romiseResponse\022\014\n\004okay\030\001 \002(\010\022\n\n\002id\030\002 \002(\004"
+    "\022\020\n\010position\030\004 \001(\004\022*\n\006action\030\003 \001(\0132\032.mes"
+    "os.internal.log.Action\"\203\002\n\014WriteRequest\022"
+    "\n\n\002id\030\001 \002(\004\022\020\n\010position\030\002 \002(\004\022\017\n\007learned"
+    "\030\003 \001(\010\022-\n\004type\030\004 \002(\0162\037.mesos.internal.lo"
+    "g.Action.Type\022+\n\003nop\030\005 \001(\0132\036.mesos.inter"
+    "nal.log.Action.Nop\0221\n\006append\030\006 \001(\0132!.mes"
+    "os.internal.log.Action.Append\0225\n\010truncat"
+    "e\030\007 \001(\0132#.mesos.internal.log.Action.Trun"
+    "cate\";\n\rWriteResponse\022\014\n\004okay\030\001 \002(\010\022\n\n\002i"
+    "d\030\002 \002(\004\022\020\n\010position\030\003 \002(\004\"b\n\021BatchWriteR"
+    "equest\022\n\n\002id\030\001 \002(\004\0220\n\006writes\030\002 \003(\0132 .mes"
+    "os.internal.log.WriteRequest\022\017\n\007learned\030"
+    "\003 \003(\004\"A\n\022BatchWriteResponse\022\014\n\004okay\030\001 \002("
+    "\010\022\n\n\002id\030\002 \002(\004\022\021\n\tpositions\030\003 \003(\004\" \n\014Lear"
+    "nRequest\022\020\n\010position\030\001 \002(\004\"I\n\rLearnRespo"
+    "nse\022\014\n\004okay\030\001 \002(\010\022*\n\006action\030\002 \001(\0132\032.meso"
+    "s.internal.log.Action\"<\n\016LearnedMessage\022"
+    "*\n\006action\030\001 \002(\0132\032.mesos.internal.log.Act"
+    "ion\"6\n\016CatchupRequest\022\n\n\002id\030\001 \002(\004\022\014\n\004fro"
+    "m\030\002 \002(\004\022\n\n\002to\030\003 \002(\004\"J\n\017CatchupResponse\022\n"
+    "\n\002id\030\001 \002(\004\022+\n\007actions\030\002 \003(\0132\032.mesos.inte"
+    "rnal.log.Action", 1855);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "log.proto", &protobuf_RegisterTypes);
   Promise::default_instance_ = new Promise();
@@ -403,27 +563,39 @@ void protobuf_AddDesc_log_2eproto() {
   Action_Nop::default_instance_ = new Action_Nop();
   Action_Append::default_instance_ = new Action_Append();
   Action_Truncate::default_instance_ = new Action_Truncate();
+  Checkpoint::default_instance_ = new Checkpoint();
+  Checkpoint_Range::default_instance_ = new Checkpoint_Range();
   Record::default_instance_ = new Record();
   PromiseRequest::default_instance_ = new PromiseRequest();
   PromiseResponse::default_instance_ = new PromiseResponse();
   WriteRequest::default_instance_ = new WriteRequest();
   WriteResponse::default_instance_ = new WriteResponse();
+  BatchWriteRequest::default_instance_ = new BatchWriteRequest();
+  BatchWriteResponse::default_instance_ = new BatchWriteResponse();
   LearnRequest::default_instance_ = new LearnRequest();
   LearnResponse::default_instance_ = new LearnResponse();
   LearnedMessage::default_instance_ = new LearnedMessage();
+  CatchupRequest::default_instance_ = new CatchupRequest();
+  CatchupResponse::default_instance_ = new CatchupResponse();
   Promise::default_instance_->InitAsDefaultInstance();
   Action::default_instance_->InitAsDefaultInstance();
   Action_Nop::default_instance_->InitAsDefaultInstance();
   Action_Append::default_instance_->InitAsDefaultInstance();
   Action_Truncate::default_instance_->InitAsDefaultInstance();
+  Checkpoint::default_instance_->InitAsDefaultInstance();
+  Checkpoint_Range::default_instance_->InitAsDefaultInstance();
   Record::default_instance_->InitAsDefaultInstance();
   PromiseRequest::default_instance_->InitAsDefaultInstance();
   PromiseResponse::default_instance_->InitAsDefaultInstance();
   WriteRequest::default_instance_->InitAsDefaultInstance();
   WriteResponse::default_instance_->InitAsDefaultInstance();
+  BatchWriteRequest::default_instance_->InitAsDefaultInstance();
+  BatchWriteResponse::default_instance_->InitAsDefaultInstance();
   LearnRequest::default_instance_->InitAsDefaultInstance();
   LearnResponse::default_instance_->InitAsDefaultInstance();
   LearnedMessage::default_instance_->InitAsDefaultInstance();
+  CatchupRequest::default_instance_->InitAsDefaultInstance();
+  CatchupResponse::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_log_2eproto);
 }
 
@@ -1810,149 +1982,100 @@ void Action::Swap(Action* other) {
 
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* Record_Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Record_Type_descriptor_;
-}
-bool Record_Type_IsValid(int value) {
-  switch(value) {
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
-  }
-}
-
 #ifndef _MSC_VER
-const Record_Type Record::PROMISE;
-const Record_Type Record::ACTION;
-const Record_Type Record::Type_MIN;
-const Record_Type Record::Type_MAX;
-const int Record::Type_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Record::kTypeFieldNumber;
-const int Record::kPromiseFieldNumber;
-const int Record::kActionFieldNumber;
+const int Checkpoint_Range::kFromFieldNumber;
+const int Checkpoint_Range::kToFieldNumber;
 #endif  // !_MSC_VER
 
-Record::Record()
+Checkpoint_Range::Checkpoint_Range()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void Record::InitAsDefaultInstance() {
-  promise_ = const_cast< ::mesos::internal::log::Promise*>(&::mesos::internal::log::Promise::default_instance());
-  action_ = const_cast< ::mesos::internal::log::Action*>(&::mesos::internal::log::Action::default_instance());
+void Checkpoint_Range::InitAsDefaultInstance() {
 }
 
-Record::Record(const Record& from)
+Checkpoint_Range::Checkpoint_Range(const Checkpoint_Range& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void Record::SharedCtor() {
+void Checkpoint_Range::SharedCtor() {
   _cached_size_ = 0;
-  type_ = 1;
-  promise_ = NULL;
-  action_ = NULL;
+  from_ = GOOGLE_ULONGLONG(0);
+  to_ = GOOGLE_ULONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Record::~Record() {
+Checkpoint_Range::~Checkpoint_Range() {
   SharedDtor();
 }
 
-void Record::SharedDtor() {
+void Checkpoint_Range::SharedDtor() {
   if (this != default_instance_) {
-    delete promise_;
-    delete action_;
   }
 }
 
-void Record::SetCachedSize(int size) const {
+void Checkpoint_Range::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Record::descriptor() {
+const ::google::protobuf::Descriptor* Checkpoint_Range::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Record_descriptor_;
+  return Checkpoint_Range_descriptor_;
 }
 
-const Record& Record::default_instance() {
+const Checkpoint_Range& Checkpoint_Range::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
 }
 
-Record* Record::default_instance_ = NULL;
+Checkpoint_Range* Checkpoint_Range::default_instance_ = NULL;
 
-Record* Record::New() const {
-  return new Record;
+Checkpoint_Range* Checkpoint_Range::New() const {
+  return new Checkpoint_Range;
 }
 
-void Record::Clear() {
+void Checkpoint_Range::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 1;
-    if (_has_bit(1)) {
-      if (promise_ != NULL) promise_->::mesos::internal::log::Promise::Clear();
-    }
-    if (_has_bit(2)) {
-      if (action_ != NULL) action_->::mesos::internal::log::Action::Clear();
-    }
+    from_ = GOOGLE_ULONGLONG(0);
+    to_ = GOOGLE_ULONGLONG(0);
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Record::MergePartialFromCodedStream(
+bool Checkpoint_Range::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .mesos.internal.log.Record.Type type = 1;
+      // required uint64 from = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::mesos::internal::log::Record_Type_IsValid(value)) {
-            set_type(static_cast< ::mesos::internal::log::Record_Type >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(1, value);
-          }
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &from_)));
+          _set_bit(0);
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(18)) goto parse_promise;
+        if (input->ExpectTag(16)) goto parse_to;
         break;
       }
       
-      // optional .mesos.internal.log.Promise promise = 2;
+      // required uint64 to = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_promise:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_promise()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_action;
-        break;
-      }
-      
-      // optional .mesos.internal.log.Action action = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_action:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_action()));
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_to:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &to_)));
+          _set_bit(1);
         } else {
           goto handle_uninterpreted;
         }
@@ -1976,24 +2099,16 @@ bool Record::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void Record::SerializeWithCachedSizes(
+void Checkpoint_Range::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .mesos.internal.log.Record.Type type = 1;
+  // required uint64 from = 1;
   if (_has_bit(0)) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->from(), output);
   }
   
-  // optional .mesos.internal.log.Promise promise = 2;
+  // required uint64 to = 2;
   if (_has_bit(1)) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->promise(), output);
-  }
-  
-  // optional .mesos.internal.log.Action action = 3;
-  if (_has_bit(2)) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->action(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->to(), output);
   }
   
   if (!unknown_fields().empty()) {
@@ -2002,26 +2117,16 @@ void Record::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* Record::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Checkpoint_Range::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required .mesos.internal.log.Record.Type type = 1;
+  // required uint64 from = 1;
   if (_has_bit(0)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->from(), target);
   }
   
-  // optional .mesos.internal.log.Promise promise = 2;
+  // required uint64 to = 2;
   if (_has_bit(1)) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->promise(), target);
-  }
-  
-  // optional .mesos.internal.log.Action action = 3;
-  if (_has_bit(2)) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->action(), target);
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->to(), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -2031,28 +2136,22 @@ void Record::SerializeWithCachedSizes(
   return target;
 }
 
-int Record::ByteSize() const {
+int Checkpoint_Range::ByteSize() const {
   int total_size = 0;
   
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .mesos.internal.log.Record.Type type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
-    
-    // optional .mesos.internal.log.Promise promise = 2;
-    if (has_promise()) {
+    // required uint64 from = 1;
+    if (has_from()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->promise());
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->from());
     }
     
-    // optional .mesos.internal.log.Action action = 3;
-    if (has_action()) {
+    // required uint64 to = 2;
+    if (has_to()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->action());
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->to());
     }
     
   }
@@ -2067,10 +2166,10 @@ int Record::ByteSize() const {
   return total_size;
 }
 
-void Record::MergeFrom(const ::google::protobuf::Message& from) {
+void Checkpoint_Range::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Record* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Record*>(
+  const Checkpoint_Range* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Checkpoint_Range*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -2079,195 +2178,255 @@ void Record::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void Record::MergeFrom(const Record& from) {
+void Checkpoint_Range::MergeFrom(const Checkpoint_Range& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from._has_bit(0)) {
-      set_type(from.type());
+      set_from(from.from());
     }
     if (from._has_bit(1)) {
-      mutable_promise()->::mesos::internal::log::Promise::MergeFrom(from.promise());
-    }
-    if (from._has_bit(2)) {
-      mutable_action()->::mesos::internal::log::Action::MergeFrom(from.action());
+      set_to(from.to());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Record::CopyFrom(const ::google::protobuf::Message& from) {
+void Checkpoint_Range::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Record::CopyFrom(const Record& from) {
+void Checkpoint_Range::CopyFrom(const Checkpoint_Range& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Record::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+bool Checkpoint_Range::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
   
-  if (has_promise()) {
-    if (!this->promise().IsInitialized()) return false;
-  }
-  if (has_action()) {
-    if (!this->action().IsInitialized()) return false;
-  }
   return true;
 }
 
-void Record::Swap(Record* other) {
+void Checkpoint_Range::Swap(Checkpoint_Range* other) {
   if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(promise_, other->promise_);
-    std::swap(action_, other->action_);
+    std::swap(from_, other->from_);
+    std::swap(to_, other->to_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Record::GetMetadata() const {
+::google::protobuf::Metadata Checkpoint_Range::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Record_descriptor_;
-  metadata.reflection = Record_reflection_;
+  metadata.descriptor = Checkpoint_Range_descriptor_;
+  metadata.reflection = Checkpoint_Range_reflection_;
   return metadata;
 }
 
 
-// ===================================================================
+// -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int PromiseRequest::kIdFieldNumber;
-const int PromiseRequest::kPositionFieldNumber;
+const int Checkpoint::kCoordinatorFieldNumber;
+const int Checkpoint::kBeginFieldNumber;
+const int Checkpoint::kEndFieldNumber;
+const int Checkpoint::kHolesFieldNumber;
+const int Checkpoint::kUnlearnedFieldNumber;
 #endif  // !_MSC_VER
 
-PromiseRequest::PromiseRequest()
+Checkpoint::Checkpoint()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void PromiseRequest::InitAsDefaultInstance() {
+void Checkpoint::InitAsDefaultInstance() {
 }
 
-PromiseRequest::PromiseRequest(const PromiseRequest& from)
+Checkpoint::Checkpoint(const Checkpoint& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void PromiseRequest::SharedCtor() {
+void Checkpoint::SharedCtor() {
   _cached_size_ = 0;
-  id_ = GOOGLE_ULONGLONG(0);
-  position_ = GOOGLE_ULONGLONG(0);
+  coordinator_ = GOOGLE_ULONGLONG(0);
+  begin_ = GOOGLE_ULONGLONG(0);
+  end_ = GOOGLE_ULONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-PromiseRequest::~PromiseRequest() {
+Checkpoint::~Checkpoint() {
   SharedDtor();
 }
 
-void PromiseRequest::SharedDtor() {
+void Checkpoint::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void PromiseRequest::SetCachedSize(int size) const {
+void Checkpoint::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* PromiseRequest::descriptor() {
+const ::google::protobuf::Descriptor* Checkpoint::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return PromiseRequest_descriptor_;
+  return Checkpoint_descriptor_;
 }
 
-const PromiseRequest& PromiseRequest::default_instance() {
+const Checkpoint& Checkpoint::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
 }
 
-PromiseRequest* PromiseRequest::default_instance_ = NULL;
+Checkpoint* Checkpoint::default_instance_ = NULL;
 
-PromiseRequest* PromiseRequest::New() const {
-  return new PromiseRequest;
+Checkpoint* Checkpoint::New() const {
+  return new Checkpoint;
 }
 
-void PromiseRequest::Clear() {
+void Checkpoint::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    id_ = GOOGLE_ULONGLONG(0);
-    position_ = GOOGLE_ULONGLONG(0);
+    coordinator_ = GOOGLE_ULONGLONG(0);
+    begin_ = GOOGLE_ULONGLONG(0);
+    end_ = GOOGLE_ULONGLONG(0);
   }
+  holes_.Clear();
+  unlearned_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool PromiseRequest::MergePartialFromCodedStream(
+bool Checkpoint::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint64 id = 1;
+      // required uint64 coordinator = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &id_)));
+                 input, &coordinator_)));
           _set_bit(0);
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(16)) goto parse_position;
+        if (input->ExpectTag(16)) goto parse_begin;
         break;
       }
       
-      // optional uint64 position = 2;
+      // required uint64 begin = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_position:
+         parse_begin:
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &position_)));
+                 input, &begin_)));
           _set_bit(1);
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectAtEnd()) return true;
+        if (input->ExpectTag(24)) goto parse_end;
         break;
       }
       
-      default: {
-      handle_uninterpreted:
+      // required uint64 end = 3;
+      case 3: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_end:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &end_)));
+          _set_bit(2);
+        } else {
+          goto handle_uninterpreted;
         }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
+        if (input->ExpectTag(34)) goto parse_holes;
         break;
       }
-    }
-  }
-  return true;
-#undef DO_
+      
+      // repeated .mesos.internal.log.Checkpoint.Range holes = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_holes:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_holes()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_holes;
+        if (input->ExpectTag(42)) goto parse_unlearned;
+        break;
+      }
+      
+      // repeated .mesos.internal.log.Checkpoint.Range unlearned = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_unlearned:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_unlearned()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(42)) goto parse_unlearned;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
 }
 
-void PromiseRequest::SerializeWithCachedSizes(
+void Checkpoint::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required uint64 id = 1;
+  // required uint64 coordinator = 1;
   if (_has_bit(0)) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->id(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->coordinator(), output);
   }
   
-  // optional uint64 position = 2;
+  // required uint64 begin = 2;
   if (_has_bit(1)) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->position(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->begin(), output);
+  }
+  
+  // required uint64 end = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->end(), output);
+  }
+  
+  // repeated .mesos.internal.log.Checkpoint.Range holes = 4;
+  for (int i = 0; i < this->holes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->holes(i), output);
+  }
+  
+  // repeated .mesos.internal.log.Checkpoint.Range unlearned = 5;
+  for (int i = 0; i < this->unlearned_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->unlearned(i), output);
   }
   
   if (!unknown_fields().empty()) {
@@ -2276,16 +2435,35 @@ void PromiseRequest::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* PromiseRequest::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Checkpoint::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required uint64 id = 1;
+  // required uint64 coordinator = 1;
   if (_has_bit(0)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->id(), target);
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->coordinator(), target);
   }
   
-  // optional uint64 position = 2;
+  // required uint64 begin = 2;
   if (_has_bit(1)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->position(), target);
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->begin(), target);
+  }
+  
+  // required uint64 end = 3;
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->end(), target);
+  }
+  
+  // repeated .mesos.internal.log.Checkpoint.Range holes = 4;
+  for (int i = 0; i < this->holes_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->holes(i), target);
+  }
+  
+  // repeated .mesos.internal.log.Checkpoint.Range unlearned = 5;
+  for (int i = 0; i < this->unlearned_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        5, this->unlearned(i), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -2295,25 +2473,48 @@ void PromiseRequest::SerializeWithCachedSizes(
   return target;
 }
 
-int PromiseRequest::ByteSize() const {
+int Checkpoint::ByteSize() const {
   int total_size = 0;
   
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint64 id = 1;
-    if (has_id()) {
+    // required uint64 coordinator = 1;
+    if (has_coordinator()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->id());
+          this->coordinator());
     }
     
-    // optional uint64 position = 2;
-    if (has_position()) {
+    // required uint64 begin = 2;
+    if (has_begin()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->position());
+          this->begin());
+    }
+    
+    // required uint64 end = 3;
+    if (has_end()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->end());
     }
     
   }
+  // repeated .mesos.internal.log.Checkpoint.Range holes = 4;
+  total_size += 1 * this->holes_size();
+  for (int i = 0; i < this->holes_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->holes(i));
+  }
+  
+  // repeated .mesos.internal.log.Checkpoint.Range unlearned = 5;
+  total_size += 1 * this->unlearned_size();
+  for (int i = 0; i < this->unlearned_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->unlearned(i));
+  }
+  
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -2325,10 +2526,10 @@ int PromiseRequest::ByteSize() const {
   return total_size;
 }
 
-void PromiseRequest::MergeFrom(const ::google::protobuf::Message& from) {
+void Checkpoint::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const PromiseRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const PromiseRequest*>(
+  const Checkpoint* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Checkpoint*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -2337,162 +2538,210 @@ void PromiseRequest::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void PromiseRequest::MergeFrom(const PromiseRequest& from) {
+void Checkpoint::MergeFrom(const Checkpoint& from) {
   GOOGLE_CHECK_NE(&from, this);
+  holes_.MergeFrom(from.holes_);
+  unlearned_.MergeFrom(from.unlearned_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from._has_bit(0)) {
-      set_id(from.id());
+      set_coordinator(from.coordinator());
     }
     if (from._has_bit(1)) {
-      set_position(from.position());
+      set_begin(from.begin());
+    }
+    if (from._has_bit(2)) {
+      set_end(from.end());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void PromiseRequest::CopyFrom(const ::google::protobuf::Message& from) {
+void Checkpoint::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void PromiseRequest::CopyFrom(const PromiseRequest& from) {
+void Checkpoint::CopyFrom(const Checkpoint& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PromiseRequest::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+bool Checkpoint::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
   
+  for (int i = 0; i < holes_size(); i++) {
+    if (!this->holes(i).IsInitialized()) return false;
+  }
+  for (int i = 0; i < unlearned_size(); i++) {
+    if (!this->unlearned(i).IsInitialized()) return false;
+  }
   return true;
 }
 
-void PromiseRequest::Swap(PromiseRequest* other) {
+void Checkpoint::Swap(Checkpoint* other) {
   if (other != this) {
-    std::swap(id_, other->id_);
-    std::swap(position_, other->position_);
+    std::swap(coordinator_, other->coordinator_);
+    std::swap(begin_, other->begin_);
+    std::swap(end_, other->end_);
+    holes_.Swap(&other->holes_);
+    unlearned_.Swap(&other->unlearned_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata PromiseRequest::GetMetadata() const {
+::google::protobuf::Metadata Checkpoint::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = PromiseRequest_descriptor_;
-  metadata.reflection = PromiseRequest_reflection_;
+  metadata.descriptor = Checkpoint_descriptor_;
+  metadata.reflection = Checkpoint_reflection_;
   return metadata;
 }
 
 
 // ===================================================================
 
+const ::google::protobuf::EnumDescriptor* Record_Type_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Record_Type_descriptor_;
+}
+bool Record_Type_IsValid(int value) {
+  switch(value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
 #ifndef _MSC_VER
-const int PromiseResponse::kOkayFieldNumber;
-const int PromiseResponse::kIdFieldNumber;
-const int PromiseResponse::kPositionFieldNumber;
-const int PromiseResponse::kActionFieldNumber;
+const Record_Type Record::PROMISE;
+const Record_Type Record::ACTION;
+const Record_Type Record::CHECKPOINT;
+const Record_Type Record::Type_MIN;
+const Record_Type Record::Type_MAX;
+const int Record::Type_ARRAYSIZE;
+#endif  // _MSC_VER
+#ifndef _MSC_VER
+const int Record::kTypeFieldNumber;
+const int Record::kPromiseFieldNumber;
+const int Record::kActionFieldNumber;
+const int Record::kCheckpointFieldNumber;
 #endif  // !_MSC_VER
 
-PromiseResponse::PromiseResponse()
+Record::Record()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void PromiseResponse::InitAsDefaultInstance() {
+void Record::InitAsDefaultInstance() {
+  promise_ = const_cast< ::mesos::internal::log::Promise*>(&::mesos::internal::log::Promise::default_instance());
   action_ = const_cast< ::mesos::internal::log::Action*>(&::mesos::internal::log::Action::default_instance());
+  checkpoint_ = const_cast< ::mesos::internal::log::Checkpoint*>(&::mesos::internal::log::Checkpoint::default_instance());
 }
 
-PromiseResponse::PromiseResponse(const PromiseResponse& from)
+Record::Record(const Record& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void PromiseResponse::SharedCtor() {
+void Record::SharedCtor() {
   _cached_size_ = 0;
-  okay_ = false;
-  id_ = GOOGLE_ULONGLONG(0);
-  position_ = GOOGLE_ULONGLONG(0);
+  type_ = 1;
+  promise_ = NULL;
   action_ = NULL;
+  checkpoint_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-PromiseResponse::~PromiseResponse() {
+Record::~Record() {
   SharedDtor();
 }
 
-void PromiseResponse::SharedDtor() {
+void Record::SharedDtor() {
   if (this != default_instance_) {
+    delete promise_;
     delete action_;
+    delete checkpoint_;
   }
 }
 
-void PromiseResponse::SetCachedSize(int size) const {
+void Record::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* PromiseResponse::descriptor() {
+const ::google::protobuf::Descriptor* Record::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return PromiseResponse_descriptor_;
+  return Record_descriptor_;
 }
 
-const PromiseResponse& PromiseResponse::default_instance() {
+const Record& Record::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
 }
 
-PromiseResponse* PromiseResponse::default_instance_ = NULL;
+Record* Record::default_instance_ = NULL;
 
-PromiseResponse* PromiseResponse::New() const {
-  return new PromiseResponse;
+Record* Record::New() const {
+  return new Record;
 }
 
-void PromiseResponse::Clear() {
+void Record::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    okay_ = false;
-    id_ = GOOGLE_ULONGLONG(0);
-    position_ = GOOGLE_ULONGLONG(0);
-    if (_has_bit(3)) {
+    type_ = 1;
+    if (_has_bit(1)) {
+      if (promise_ != NULL) promise_->::mesos::internal::log::Promise::Clear();
+    }
+    if (_has_bit(2)) {
       if (action_ != NULL) action_->::mesos::internal::log::Action::Clear();
     }
+    if (_has_bit(3)) {
+      if (checkpoint_ != NULL) checkpoint_->::mesos::internal::log::Checkpoint::Clear();
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool PromiseResponse::MergePartialFromCodedStream(
+bool Record::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required bool okay = 1;
+      // required .mesos.internal.log.Record.Type type = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          int value;
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &okay_)));
-          _set_bit(0);
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::mesos::internal::log::Record_Type_IsValid(value)) {
+            set_type(static_cast< ::mesos::internal::log::Record_Type >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(1, value);
+          }
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(16)) goto parse_id;
+        if (input->ExpectTag(18)) goto parse_promise;
         break;
       }
       
-      // required uint64 id = 2;
+      // optional .mesos.internal.log.Promise promise = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &id_)));
-          _set_bit(1);
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_promise:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_promise()));
         } else {
           goto handle_uninterpreted;
         }
@@ -2510,19 +2759,17 @@ bool PromiseResponse::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(32)) goto parse_position;
+        if (input->ExpectTag(34)) goto parse_checkpoint;
         break;
       }
       
-      // optional uint64 position = 4;
+      // optional .mesos.internal.log.Checkpoint checkpoint = 4;
       case 4: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_position:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &position_)));
-          _set_bit(2);
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_checkpoint:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_checkpoint()));
         } else {
           goto handle_uninterpreted;
         }
@@ -2546,27 +2793,30 @@ bool PromiseResponse::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void PromiseResponse::SerializeWithCachedSizes(
+void Record::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required bool okay = 1;
+  // required .mesos.internal.log.Record.Type type = 1;
   if (_has_bit(0)) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->okay(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->type(), output);
   }
   
-  // required uint64 id = 2;
+  // optional .mesos.internal.log.Promise promise = 2;
   if (_has_bit(1)) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->id(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->promise(), output);
   }
   
   // optional .mesos.internal.log.Action action = 3;
-  if (_has_bit(3)) {
+  if (_has_bit(2)) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
       3, this->action(), output);
   }
   
-  // optional uint64 position = 4;
-  if (_has_bit(2)) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->position(), output);
+  // optional .mesos.internal.log.Checkpoint checkpoint = 4;
+  if (_has_bit(3)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->checkpoint(), output);
   }
   
   if (!unknown_fields().empty()) {
@@ -2575,29 +2825,34 @@ void PromiseResponse::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* PromiseResponse::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Record::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required bool okay = 1;
+  // required .mesos.internal.log.Record.Type type = 1;
   if (_has_bit(0)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->okay(), target);
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->type(), target);
   }
   
-  // required uint64 id = 2;
+  // optional .mesos.internal.log.Promise promise = 2;
   if (_has_bit(1)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->id(), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->promise(), target);
   }
   
   // optional .mesos.internal.log.Action action = 3;
-  if (_has_bit(3)) {
+  if (_has_bit(2)) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
         3, this->action(), target);
   }
   
-  // optional uint64 position = 4;
-  if (_has_bit(2)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->position(), target);
-  }
+  // optional .mesos.internal.log.Checkpoint checkpoint = 4;
+  if (_has_bit(3)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->checkpoint(), target);
+  }
   
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
@@ -2606,27 +2861,21 @@ void PromiseResponse::SerializeWithCachedSizes(
   return target;
 }
 
-int PromiseResponse::ByteSize() const {
+int Record::ByteSize() const {
   int total_size = 0;
   
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required bool okay = 1;
-    if (has_okay()) {
-      total_size += 1 + 1;
-    }
-    
-    // required uint64 id = 2;
-    if (has_id()) {
+    // required .mesos.internal.log.Record.Type type = 1;
+    if (has_type()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->id());
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
     }
     
-    // optional uint64 position = 4;
-    if (has_position()) {
+    // optional .mesos.internal.log.Promise promise = 2;
+    if (has_promise()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->position());
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->promise());
     }
     
     // optional .mesos.internal.log.Action action = 3;
@@ -2636,6 +2885,13 @@ int PromiseResponse::ByteSize() const {
           this->action());
     }
     
+    // optional .mesos.internal.log.Checkpoint checkpoint = 4;
+    if (has_checkpoint()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->checkpoint());
+    }
+    
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -2648,10 +2904,10 @@ int PromiseResponse::ByteSize() const {
   return total_size;
 }
 
-void PromiseResponse::MergeFrom(const ::google::protobuf::Message& from) {
+void Record::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const PromiseResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const PromiseResponse*>(
+  const Record* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Record*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -2660,63 +2916,69 @@ void PromiseResponse::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void PromiseResponse::MergeFrom(const PromiseResponse& from) {
+void Record::MergeFrom(const Record& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from._has_bit(0)) {
-      set_okay(from.okay());
+      set_type(from.type());
     }
     if (from._has_bit(1)) {
-      set_id(from.id());
+      mutable_promise()->::mesos::internal::log::Promise::MergeFrom(from.promise());
     }
     if (from._has_bit(2)) {
-      set_position(from.position());
+      mutable_action()->::mesos::internal::log::Action::MergeFrom(from.action());
     }
     if (from._has_bit(3)) {
-      mutable_action()->::mesos::internal::log::Action::MergeFrom(from.action());
+      mutable_checkpoint()->::mesos::internal::log::Checkpoint::MergeFrom(from.checkpoint());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void PromiseResponse::CopyFrom(const ::google::protobuf::Message& from) {
+void Record::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void PromiseResponse::CopyFrom(const PromiseResponse& from) {
+void Record::CopyFrom(const Record& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PromiseResponse::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+bool Record::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
   
+  if (has_promise()) {
+    if (!this->promise().IsInitialized()) return false;
+  }
   if (has_action()) {
     if (!this->action().IsInitialized()) return false;
   }
+  if (has_checkpoint()) {
+    if (!this->checkpoint().IsInitialized()) return false;
+  }
   return true;
 }
 
-void PromiseResponse::Swap(PromiseResponse* other) {
+void Record::Swap(Record* other) {
   if (other != this) {
-    std::swap(okay_, other->okay_);
-    std::swap(id_, other->id_);
-    std::swap(position_, other->position_);
+    std::swap(type_, other->type_);
+    std::swap(promise_, other->promise_);
     std::swap(action_, other->action_);
+    std::swap(checkpoint_, other->checkpoint_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata PromiseResponse::GetMetadata() const {
+::google::protobuf::Metadata Record::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = PromiseResponse_descriptor_;
-  metadata.reflection = PromiseResponse_reflection_;
+  metadata.descriptor = Record_descriptor_;
+  metadata.reflection = Record_reflection_;
   return metadata;
 }
 
@@ -2724,97 +2986,70 @@ void PromiseResponse::Swap(PromiseResponse* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int WriteRequest::kIdFieldNumber;
-const int WriteRequest::kPositionFieldNumber;
-const int WriteRequest::kLearnedFieldNumber;
-const int WriteRequest::kTypeFieldNumber;
-const int WriteRequest::kNopFieldNumber;
-const int WriteRequest::kAppendFieldNumber;
-const int WriteRequest::kTruncateFieldNumber;
+const int PromiseRequest::kIdFieldNumber;
+const int PromiseRequest::kPositionFieldNumber;
 #endif  // !_MSC_VER
 
-WriteRequest::WriteRequest()
+PromiseRequest::PromiseRequest()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void WriteRequest::InitAsDefaultInstance() {
-  nop_ = const_cast< ::mesos::internal::log::Action_Nop*>(&::mesos::internal::log::Action_Nop::default_instance());
-  append_ = const_cast< ::mesos::internal::log::Action_Append*>(&::mesos::internal::log::Action_Append::default_instance());
-  truncate_ = const_cast< ::mesos::internal::log::Action_Truncate*>(&::mesos::internal::log::Action_Truncate::default_instance());
+void PromiseRequest::InitAsDefaultInstance() {
 }
 
-WriteRequest::WriteRequest(const WriteRequest& from)
+PromiseRequest::PromiseRequest(const PromiseRequest& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void WriteRequest::SharedCtor() {
+void PromiseRequest::SharedCtor() {
   _cached_size_ = 0;
   id_ = GOOGLE_ULONGLONG(0);
   position_ = GOOGLE_ULONGLONG(0);
-  learned_ = false;
-  type_ = 1;
-  nop_ = NULL;
-  append_ = NULL;
-  truncate_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-WriteRequest::~WriteRequest() {
+PromiseRequest::~PromiseRequest() {
   SharedDtor();
 }
 
-void WriteRequest::SharedDtor() {
+void PromiseRequest::SharedDtor() {
   if (this != default_instance_) {
-    delete nop_;
-    delete append_;
-    delete truncate_;
   }
 }
 
-void WriteRequest::SetCachedSize(int size) const {
+void PromiseRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* WriteRequest::descriptor() {
+const ::google::protobuf::Descriptor* PromiseRequest::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return WriteRequest_descriptor_;
+  return PromiseRequest_descriptor_;
 }
 
-const WriteRequest& WriteRequest::default_instance() {
+const PromiseRequest& PromiseRequest::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
 }
 
-WriteRequest* WriteRequest::default_instance_ = NULL;
+PromiseRequest* PromiseRequest::default_instance_ = NULL;
 
-WriteRequest* WriteRequest::New() const {
-  return new WriteRequest;
+PromiseRequest* PromiseRequest::New() const {
+  return new PromiseRequest;
 }
 
-void WriteRequest::Clear() {
+void PromiseRequest::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     id_ = GOOGLE_ULONGLONG(0);
     position_ = GOOGLE_ULONGLONG(0);
-    learned_ = false;
-    type_ = 1;
-    if (_has_bit(4)) {
-      if (nop_ != NULL) nop_->::mesos::internal::log::Action_Nop::Clear();
-    }
-    if (_has_bit(5)) {
-      if (append_ != NULL) append_->::mesos::internal::log::Action_Append::Clear();
-    }
-    if (_has_bit(6)) {
-      if (truncate_ != NULL) truncate_->::mesos::internal::log::Action_Truncate::Clear();
-    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool WriteRequest::MergePartialFromCodedStream(
+bool PromiseRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
@@ -2835,7 +3070,7 @@ bool WriteRequest::MergePartialFromCodedStream(
         break;
       }
       
-      // required uint64 position = 2;
+      // optional uint64 position = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
@@ -2847,85 +3082,6 @@ bool WriteRequest::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(24)) goto parse_learned;
-        break;
-      }
-      
-      // optional bool learned = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_learned:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &learned_)));
-          _set_bit(2);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_type;
-        break;
-      }
-      
-      // required .mesos.internal.log.Action.Type type = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::mesos::internal::log::Action_Type_IsValid(value)) {
-            set_type(static_cast< ::mesos::internal::log::Action_Type >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(4, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_nop;
-        break;
-      }
-      
-      // optional .mesos.internal.log.Action.Nop nop = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_nop:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_nop()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_append;
-        break;
-      }
-      
-      // optional .mesos.internal.log.Action.Append append = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_append:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_append()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_truncate;
-        break;
-      }
-      
-      // optional .mesos.internal.log.Action.Truncate truncate = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_truncate:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_truncate()));
-        } else {
-          goto handle_uninterpreted;
-        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -2946,95 +3102,1710 @@ bool WriteRequest::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void WriteRequest::SerializeWithCachedSizes(
+void PromiseRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
   // required uint64 id = 1;
   if (_has_bit(0)) {
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->id(), output);
   }
   
-  // required uint64 position = 2;
+  // optional uint64 position = 2;
   if (_has_bit(1)) {
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->position(), output);
   }
   
-  // optional bool learned = 3;
-  if (_has_bit(2)) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->learned(), output);
-  }
-  
-  // required .mesos.internal.log.Action.Type type = 4;
-  if (_has_bit(3)) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      4, this->type(), output);
-  }
-  
-  // optional .mesos.internal.log.Action.Nop nop = 5;
-  if (_has_bit(4)) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->nop(), output);
-  }
-  
-  // optional .mesos.internal.log.Action.Append append = 6;
-  if (_has_bit(5)) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->append(), output);
-  }
-  
-  // optional .mesos.internal.log.Action.Truncate truncate = 7;
-  if (_has_bit(6)) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->truncate(), output);
-  }
-  
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
 }
 
-::google::protobuf::uint8* WriteRequest::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* PromiseRequest::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
   // required uint64 id = 1;
   if (_has_bit(0)) {
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->id(), target);
   }
   
-  // required uint64 position = 2;
+  // optional uint64 position = 2;
   if (_has_bit(1)) {
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->position(), target);
   }
   
-  // optional bool learned = 3;
-  if (_has_bit(2)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->learned(), target);
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
   }
-  
+  return target;
+}
+
+int PromiseRequest::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint64 id = 1;
+    if (has_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->id());
+    }
+    
+    // optional uint64 position = 2;
+    if (has_position()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->position());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void PromiseRequest::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const PromiseRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const PromiseRequest*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void PromiseRequest::MergeFrom(const PromiseRequest& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_id(from.id());
+    }
+    if (from._has_bit(1)) {
+      set_position(from.position());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void PromiseRequest::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PromiseRequest::CopyFrom(const PromiseRequest& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PromiseRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+  
+  return true;
+}
+
+void PromiseRequest::Swap(PromiseRequest* other) {
+  if (other != this) {
+    std::swap(id_, other->id_);
+    std::swap(position_, other->position_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata PromiseRequest::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = PromiseRequest_descriptor_;
+  metadata.reflection = PromiseRequest_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int PromiseResponse::kOkayFieldNumber;
+const int PromiseResponse::kIdFieldNumber;
+const int PromiseResponse::kPositionFieldNumber;
+const int PromiseResponse::kActionFieldNumber;
+#endif  // !_MSC_VER
+
+PromiseResponse::PromiseResponse()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void PromiseResponse::InitAsDefaultInstance() {
+  action_ = const_cast< ::mesos::internal::log::Action*>(&::mesos::internal::log::Action::default_instance());
+}
+
+PromiseResponse::PromiseResponse(const PromiseResponse& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void PromiseResponse::SharedCtor() {
+  _cached_size_ = 0;
+  okay_ = false;
+  id_ = GOOGLE_ULONGLONG(0);
+  position_ = GOOGLE_ULONGLONG(0);
+  action_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+PromiseResponse::~PromiseResponse() {
+  SharedDtor();
+}
+
+void PromiseResponse::SharedDtor() {
+  if (this != default_instance_) {
+    delete action_;
+  }
+}
+
+void PromiseResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* PromiseResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return PromiseResponse_descriptor_;
+}
+
+const PromiseResponse& PromiseResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
+}
+
+PromiseResponse* PromiseResponse::default_instance_ = NULL;
+
+PromiseResponse* PromiseResponse::New() const {
+  return new PromiseResponse;
+}
+
+void PromiseResponse::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    okay_ = false;
+    id_ = GOOGLE_ULONGLONG(0);
+    position_ = GOOGLE_ULONGLONG(0);
+    if (_has_bit(3)) {
+      if (action_ != NULL) action_->::mesos::internal::log::Action::Clear();
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool PromiseResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required bool okay = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &okay_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_id;
+        break;
+      }
+      
+      // required uint64 id = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_id:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &id_)));
+          _set_bit(1);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_action;
+        break;
+      }
+      
+      // optional .mesos.internal.log.Action action = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_action:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_action()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_position;
+        break;
+      }
+      
+      // optional uint64 position = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_position:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &position_)));
+          _set_bit(2);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void PromiseResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required bool okay = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->okay(), output);
+  }
+  
+  // required uint64 id = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->id(), output);
+  }
+  
+  // optional .mesos.internal.log.Action action = 3;
+  if (_has_bit(3)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->action(), output);
+  }
+  
+  // optional uint64 position = 4;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->position(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* PromiseResponse::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required bool okay = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->okay(), target);
+  }
+  
+  // required uint64 id = 2;
+  if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->id(), target);
+  }
+  
+  // optional .mesos.internal.log.Action action = 3;
+  if (_has_bit(3)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->action(), target);
+  }
+  
+  // optional uint64 position = 4;
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->position(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int PromiseResponse::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required bool okay = 1;
+    if (has_okay()) {
+      total_size += 1 + 1;
+    }
+    
+    // required uint64 id = 2;
+    if (has_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->id());
+    }
+    
+    // optional uint64 position = 4;
+    if (has_position()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->position());
+    }
+    
+    // optional .mesos.internal.log.Action action = 3;
+    if (has_action()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->action());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void PromiseResponse::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const PromiseResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const PromiseResponse*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void PromiseResponse::MergeFrom(const PromiseResponse& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_okay(from.okay());
+    }
+    if (from._has_bit(1)) {
+      set_id(from.id());
+    }
+    if (from._has_bit(2)) {
+      set_position(from.position());
+    }
+    if (from._has_bit(3)) {
+      mutable_action()->::mesos::internal::log::Action::MergeFrom(from.action());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void PromiseResponse::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PromiseResponse::CopyFrom(const PromiseResponse& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PromiseResponse::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+  
+  if (has_action()) {
+    if (!this->action().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void PromiseResponse::Swap(PromiseResponse* other) {
+  if (other != this) {
+    std::swap(okay_, other->okay_);
+    std::swap(id_, other->id_);
+    std::swap(position_, other->position_);
+    std::swap(action_, other->action_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata PromiseResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = PromiseResponse_descriptor_;
+  metadata.reflection = PromiseResponse_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int WriteRequest::kIdFieldNumber;
+const int WriteRequest::kPositionFieldNumber;
+const int WriteRequest::kLearnedFieldNumber;
+const int WriteRequest::kTypeFieldNumber;
+const int WriteRequest::kNopFieldNumber;
+const int WriteRequest::kAppendFieldNumber;
+const int WriteRequest::kTruncateFieldNumber;
+#endif  // !_MSC_VER
+
+WriteRequest::WriteRequest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void WriteRequest::InitAsDefaultInstance() {
+  nop_ = const_cast< ::mesos::internal::log::Action_Nop*>(&::mesos::internal::log::Action_Nop::default_instance());
+  append_ = const_cast< ::mesos::internal::log::Action_Append*>(&::mesos::internal::log::Action_Append::default_instance());
+  truncate_ = const_cast< ::mesos::internal::log::Action_Truncate*>(&::mesos::internal::log::Action_Truncate::default_instance());
+}
+
+WriteRequest::WriteRequest(const WriteRequest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void WriteRequest::SharedCtor() {
+  _cached_size_ = 0;
+  id_ = GOOGLE_ULONGLONG(0);
+  position_ = GOOGLE_ULONGLONG(0);
+  learned_ = false;
+  type_ = 1;
+  nop_ = NULL;
+  append_ = NULL;
+  truncate_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+WriteRequest::~WriteRequest() {
+  SharedDtor();
+}
+
+void WriteRequest::SharedDtor() {
+  if (this != default_instance_) {
+    delete nop_;
+    delete append_;
+    delete truncate_;
+  }
+}
+
+void WriteRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* WriteRequest::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return WriteRequest_descriptor_;
+}
+
+const WriteRequest& WriteRequest::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
+}
+
+WriteRequest* WriteRequest::default_instance_ = NULL;
+
+WriteRequest* WriteRequest::New() const {
+  return new WriteRequest;
+}
+
+void WriteRequest::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    id_ = GOOGLE_ULONGLONG(0);
+    position_ = GOOGLE_ULONGLONG(0);
+    learned_ = false;
+    type_ = 1;
+    if (_has_bit(4)) {
+      if (nop_ != NULL) nop_->::mesos::internal::log::Action_Nop::Clear();
+    }
+    if (_has_bit(5)) {
+      if (append_ != NULL) append_->::mesos::internal::log::Action_Append::Clear();
+    }
+    if (_has_bit(6)) {
+      if (truncate_ != NULL) truncate_->::mesos::internal::log::Action_Truncate::Clear();
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool WriteRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint64 id = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &id_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_position;
+        break;
+      }
+      
+      // required uint64 position = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_position:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &position_)));
+          _set_bit(1);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_learned;
+        break;
+      }
+      
+      // optional bool learned = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_learned:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &learned_)));
+          _set_bit(2);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_type;
+        break;
+      }
+      
+      // required .mesos.internal.log.Action.Type type = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_type:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::mesos::internal::log::Action_Type_IsValid(value)) {
+            set_type(static_cast< ::mesos::internal::log::Action_Type >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(4, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(42)) goto parse_nop;
+        break;
+      }
+      
+      // optional .mesos.internal.log.Action.Nop nop = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_nop:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_nop()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(50)) goto parse_append;
+        break;
+      }
+      
+      // optional .mesos.internal.log.Action.Append append = 6;
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_append:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_append()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(58)) goto parse_truncate;
+        break;
+      }
+      
+      // optional .mesos.internal.log.Action.Truncate truncate = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_truncate:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_truncate()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void WriteRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required uint64 id = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->id(), output);
+  }
+  
+  // required uint64 position = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->position(), output);
+  }
+  
+  // optional bool learned = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->learned(), output);
+  }
+  
+  // required .mesos.internal.log.Action.Type type = 4;
+  if (_has_bit(3)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      4, this->type(), output);
+  }
+  
+  // optional .mesos.internal.log.Action.Nop nop = 5;
+  if (_has_bit(4)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->nop(), output);
+  }
+  
+  // optional .mesos.internal.log.Action.Append append = 6;
+  if (_has_bit(5)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, this->append(), output);
+  }
+  
+  // optional .mesos.internal.log.Action.Truncate truncate = 7;
+  if (_has_bit(6)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, this->truncate(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* WriteRequest::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required uint64 id = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->id(), target);
+  }
+  
+  // required uint64 position = 2;
+  if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->position(), target);
+  }
+  
+  // optional bool learned = 3;
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->learned(), target);
+  }
+  
   // required .mesos.internal.log.Action.Type type = 4;
   if (_has_bit(3)) {
     target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
       4, this->type(), target);
   }
   
-  // optional .mesos.internal.log.Action.Nop nop = 5;
-  if (_has_bit(4)) {
+  // optional .mesos.internal.log.Action.Nop nop = 5;
+  if (_has_bit(4)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        5, this->nop(), target);
+  }
+  
+  // optional .mesos.internal.log.Action.Append append = 6;
+  if (_has_bit(5)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        6, this->append(), target);
+  }
+  
+  // optional .mesos.internal.log.Action.Truncate truncate = 7;
+  if (_has_bit(6)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        7, this->truncate(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int WriteRequest::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint64 id = 1;
+    if (has_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->id());
+    }
+    
+    // required uint64 position = 2;
+    if (has_position()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->position());
+    }
+    
+    // optional bool learned = 3;
+    if (has_learned()) {
+      total_size += 1 + 1;
+    }
+    
+    // required .mesos.internal.log.Action.Type type = 4;
+    if (has_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+    }
+    
+    // optional .mesos.internal.log.Action.Nop nop = 5;
+    if (has_nop()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->nop());
+    }
+    
+    // optional .mesos.internal.log.Action.Append append = 6;
+    if (has_append()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->append());
+    }
+    
+    // optional .mesos.internal.log.Action.Truncate truncate = 7;
+    if (has_truncate()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->truncate());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void WriteRequest::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const WriteRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const WriteRequest*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void WriteRequest::MergeFrom(const WriteRequest& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_id(from.id());
+    }
+    if (from._has_bit(1)) {
+      set_position(from.position());
+    }
+    if (from._has_bit(2)) {
+      set_learned(from.learned());
+    }
+    if (from._has_bit(3)) {
+      set_type(from.type());
+    }
+    if (from._has_bit(4)) {
+      mutable_nop()->::mesos::internal::log::Action_Nop::MergeFrom(from.nop());
+    }
+    if (from._has_bit(5)) {
+      mutable_append()->::mesos::internal::log::Action_Append::MergeFrom(from.append());
+    }
+    if (from._has_bit(6)) {
+      mutable_truncate()->::mesos::internal::log::Action_Truncate::MergeFrom(from.truncate());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void WriteRequest::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void WriteRequest::CopyFrom(const WriteRequest& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000000b) != 0x0000000b) return false;
+  
+  if (has_append()) {
+    if (!this->append().IsInitialized()) return false;
+  }
+  if (has_truncate()) {
+    if (!this->truncate().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void WriteRequest::Swap(WriteRequest* other) {
+  if (other != this) {
+    std::swap(id_, other->id_);
+    std::swap(position_, other->position_);
+    std::swap(learned_, other->learned_);
+    std::swap(type_, other->type_);
+    std::swap(nop_, other->nop_);
+    std::swap(append_, other->append_);
+    std::swap(truncate_, other->truncate_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata WriteRequest::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = WriteRequest_descriptor_;
+  metadata.reflection = WriteRequest_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int WriteResponse::kOkayFieldNumber;
+const int WriteResponse::kIdFieldNumber;
+const int WriteResponse::kPositionFieldNumber;
+#endif  // !_MSC_VER
+
+WriteResponse::WriteResponse()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void WriteResponse::InitAsDefaultInstance() {
+}
+
+WriteResponse::WriteResponse(const WriteResponse& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void WriteResponse::SharedCtor() {
+  _cached_size_ = 0;
+  okay_ = false;
+  id_ = GOOGLE_ULONGLONG(0);
+  position_ = GOOGLE_ULONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+WriteResponse::~WriteResponse() {
+  SharedDtor();
+}
+
+void WriteResponse::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void WriteResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* WriteResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return WriteResponse_descriptor_;
+}
+
+const WriteResponse& WriteResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
+}
+
+WriteResponse* WriteResponse::default_instance_ = NULL;
+
+WriteResponse* WriteResponse::New() const {
+  return new WriteResponse;
+}
+
+void WriteResponse::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    okay_ = false;
+    id_ = GOOGLE_ULONGLONG(0);
+    position_ = GOOGLE_ULONGLONG(0);
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool WriteResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required bool okay = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &okay_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_id;
+        break;
+      }
+      
+      // required uint64 id = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_id:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &id_)));
+          _set_bit(1);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_position;
+        break;
+      }
+      
+      // required uint64 position = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_position:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &position_)));
+          _set_bit(2);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void WriteResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required bool okay = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->okay(), output);
+  }
+  
+  // required uint64 id = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->id(), output);
+  }
+  
+  // required uint64 position = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->position(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* WriteResponse::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required bool okay = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->okay(), target);
+  }
+  
+  // required uint64 id = 2;
+  if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->id(), target);
+  }
+  
+  // required uint64 position = 3;
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->position(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int WriteResponse::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required bool okay = 1;
+    if (has_okay()) {
+      total_size += 1 + 1;
+    }
+    
+    // required uint64 id = 2;
+    if (has_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->id());
+    }
+    
+    // required uint64 position = 3;
+    if (has_position()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->position());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void WriteResponse::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const WriteResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const WriteResponse*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void WriteResponse::MergeFrom(const WriteResponse& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_okay(from.okay());
+    }
+    if (from._has_bit(1)) {
+      set_id(from.id());
+    }
+    if (from._has_bit(2)) {
+      set_position(from.position());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void WriteResponse::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void WriteResponse::CopyFrom(const WriteResponse& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteResponse::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+  
+  return true;
+}
+
+void WriteResponse::Swap(WriteResponse* other) {
+  if (other != this) {
+    std::swap(okay_, other->okay_);
+    std::swap(id_, other->id_);
+    std::swap(position_, other->position_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata WriteResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = WriteResponse_descriptor_;
+  metadata.reflection = WriteResponse_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int BatchWriteRequest::kIdFieldNumber;
+const int BatchWriteRequest::kWritesFieldNumber;
+const int BatchWriteRequest::kLearnedFieldNumber;
+#endif  // !_MSC_VER
+
+BatchWriteRequest::BatchWriteRequest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void BatchWriteRequest::InitAsDefaultInstance() {
+}
+
+BatchWriteRequest::BatchWriteRequest(const BatchWriteRequest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void BatchWriteRequest::SharedCtor() {
+  _cached_size_ = 0;
+  id_ = GOOGLE_ULONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+BatchWriteRequest::~BatchWriteRequest() {
+  SharedDtor();
+}
+
+void BatchWriteRequest::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void BatchWriteRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* BatchWriteRequest::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return BatchWriteRequest_descriptor_;
+}
+
+const BatchWriteRequest& BatchWriteRequest::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
+}
+
+BatchWriteRequest* BatchWriteRequest::default_instance_ = NULL;
+
+BatchWriteRequest* BatchWriteRequest::New() const {
+  return new BatchWriteRequest;
+}
+
+void BatchWriteRequest::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    id_ = GOOGLE_ULONGLONG(0);
+  }
+  writes_.Clear();
+  learned_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool BatchWriteRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint64 id = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &id_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_writes;
+        break;
+      }
+      
+      // repeated .mesos.internal.log.WriteRequest writes = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_writes:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_writes()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_writes;
+        if (input->ExpectTag(24)) goto parse_learned;
+        break;
+      }
+      
+      // repeated uint64 learned = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_learned:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 1, 24, input, this->mutable_learned())));
+        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
+                   == ::google::protobuf::internal::WireFormatLite::
+                      WIRETYPE_LENGTH_DELIMITED) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_learned())));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_learned;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void BatchWriteRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required uint64 id = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->id(), output);
+  }
+  
+  // repeated .mesos.internal.log.WriteRequest writes = 2;
+  for (int i = 0; i < this->writes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->writes(i), output);
+  }
+  
+  // repeated uint64 learned = 3;
+  for (int i = 0; i < this->learned_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(
+      3, this->learned(i), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* BatchWriteRequest::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required uint64 id = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->id(), target);
+  }
+  
+  // repeated .mesos.internal.log.WriteRequest writes = 2;
+  for (int i = 0; i < this->writes_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        5, this->nop(), target);
+        2, this->writes(i), target);
   }
   
-  // optional .mesos.internal.log.Action.Append append = 6;
-  if (_has_bit(5)) {
+  // repeated uint64 learned = 3;
+  for (int i = 0; i < this->learned_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->append(), target);
+      WriteUInt64ToArray(3, this->learned(i), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int BatchWriteRequest::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint64 id = 1;
+    if (has_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->id());
+    }
+    
+  }
+  // repeated .mesos.internal.log.WriteRequest writes = 2;
+  total_size += 1 * this->writes_size();
+  for (int i = 0; i < this->writes_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->writes(i));
+  }
+  
+  // repeated uint64 learned = 3;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->learned_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt64Size(this->learned(i));
+    }
+    total_size += 1 * this->learned_size() + data_size;
+  }
+  
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void BatchWriteRequest::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const BatchWriteRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const BatchWriteRequest*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void BatchWriteRequest::MergeFrom(const BatchWriteRequest& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  writes_.MergeFrom(from.writes_);
+  learned_.MergeFrom(from.learned_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_id(from.id());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void BatchWriteRequest::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BatchWriteRequest::CopyFrom(const BatchWriteRequest& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchWriteRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+  
+  for (int i = 0; i < writes_size(); i++) {
+    if (!this->writes(i).IsInitialized()) return false;
+  }
+  return true;
+}
+
+void BatchWriteRequest::Swap(BatchWriteRequest* other) {
+  if (other != this) {
+    std::swap(id_, other->id_);
+    writes_.Swap(&other->writes_);
+    learned_.Swap(&other->learned_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata BatchWriteRequest::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = BatchWriteRequest_descriptor_;
+  metadata.reflection = BatchWriteRequest_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int BatchWriteResponse::kOkayFieldNumber;
+const int BatchWriteResponse::kIdFieldNumber;
+const int BatchWriteResponse::kPositionsFieldNumber;
+#endif  // !_MSC_VER
+
+BatchWriteResponse::BatchWriteResponse()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void BatchWriteResponse::InitAsDefaultInstance() {
+}
+
+BatchWriteResponse::BatchWriteResponse(const BatchWriteResponse& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void BatchWriteResponse::SharedCtor() {
+  _cached_size_ = 0;
+  okay_ = false;
+  id_ = GOOGLE_ULONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+BatchWriteResponse::~BatchWriteResponse() {
+  SharedDtor();
+}
+
+void BatchWriteResponse::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void BatchWriteResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* BatchWriteResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return BatchWriteResponse_descriptor_;
+}
+
+const BatchWriteResponse& BatchWriteResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
+}
+
+BatchWriteResponse* BatchWriteResponse::default_instance_ = NULL;
+
+BatchWriteResponse* BatchWriteResponse::New() const {
+  return new BatchWriteResponse;
+}
+
+void BatchWriteResponse::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    okay_ = false;
+    id_ = GOOGLE_ULONGLONG(0);
+  }
+  positions_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool BatchWriteResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required bool okay = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &okay_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_id;
+        break;
+      }
+      
+      // required uint64 id = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_id:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &id_)));
+          _set_bit(1);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_positions;
+        break;
+      }
+      
+      // repeated uint64 positions = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_positions:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 1, 24, input, this->mutable_positions())));
+        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
+                   == ::google::protobuf::internal::WireFormatLite::
+                      WIRETYPE_LENGTH_DELIMITED) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_positions())));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_positions;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void BatchWriteResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required bool okay = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->okay(), output);
+  }
+  
+  // required uint64 id = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->id(), output);
+  }
+  
+  // repeated uint64 positions = 3;
+  for (int i = 0; i < this->positions_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(
+      3, this->positions(i), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* BatchWriteResponse::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required bool okay = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->okay(), target);
   }
   
-  // optional .mesos.internal.log.Action.Truncate truncate = 7;
-  if (_has_bit(6)) {
+  // required uint64 id = 2;
+  if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->id(), target);
+  }
+  
+  // repeated uint64 positions = 3;
+  for (int i = 0; i < this->positions_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        7, this->truncate(), target);
+      WriteUInt64ToArray(3, this->positions(i), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -3044,54 +4815,244 @@ void WriteRequest::SerializeWithCachedSizes(
   return target;
 }
 
-int WriteRequest::ByteSize() const {
+int BatchWriteResponse::ByteSize() const {
   int total_size = 0;
   
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint64 id = 1;
-    if (has_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->id());
+    // required bool okay = 1;
+    if (has_okay()) {
+      total_size += 1 + 1;
     }
     
-    // required uint64 position = 2;
-    if (has_position()) {
+    // required uint64 id = 2;
+    if (has_id()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->position());
+          this->id());
     }
     
-    // optional bool learned = 3;
-    if (has_learned()) {
-      total_size += 1 + 1;
+  }
+  // repeated uint64 positions = 3;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->positions_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt64Size(this->positions(i));
     }
-    
-    // required .mesos.internal.log.Action.Type type = 4;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+    total_size += 1 * this->positions_size() + data_size;
+  }
+  
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void BatchWriteResponse::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const BatchWriteResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const BatchWriteResponse*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void BatchWriteResponse::MergeFrom(const BatchWriteResponse& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  positions_.MergeFrom(from.positions_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_okay(from.okay());
     }
-    
-    // optional .mesos.internal.log.Action.Nop nop = 5;
-    if (has_nop()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->nop());
+    if (from._has_bit(1)) {
+      set_id(from.id());
     }
-    
-    // optional .mesos.internal.log.Action.Append append = 6;
-    if (has_append()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->append());
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void BatchWriteResponse::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BatchWriteResponse::CopyFrom(const BatchWriteResponse& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchWriteResponse::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+  
+  return true;
+}
+
+void BatchWriteResponse::Swap(BatchWriteResponse* other) {
+  if (other != this) {
+    std::swap(okay_, other->okay_);
+    std::swap(id_, other->id_);
+    positions_.Swap(&other->positions_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata BatchWriteResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = BatchWriteResponse_descriptor_;
+  metadata.reflection = BatchWriteResponse_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int LearnRequest::kPositionFieldNumber;
+#endif  // !_MSC_VER
+
+LearnRequest::LearnRequest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void LearnRequest::InitAsDefaultInstance() {
+}
+
+LearnRequest::LearnRequest(const LearnRequest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void LearnRequest::SharedCtor() {
+  _cached_size_ = 0;
+  position_ = GOOGLE_ULONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+LearnRequest::~LearnRequest() {
+  SharedDtor();
+}
+
+void LearnRequest::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void LearnRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* LearnRequest::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return LearnRequest_descriptor_;
+}
+
+const LearnRequest& LearnRequest::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
+}
+
+LearnRequest* LearnRequest::default_instance_ = NULL;
+
+LearnRequest* LearnRequest::New() const {
+  return new LearnRequest;
+}
+
+void LearnRequest::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    position_ = GOOGLE_ULONGLONG(0);
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool LearnRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint64 position = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &position_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
     }
-    
-    // optional .mesos.internal.log.Action.Truncate truncate = 7;
-    if (has_truncate()) {
+  }
+  return true;
+#undef DO_
+}
+
+void LearnRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required uint64 position = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->position(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* LearnRequest::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required uint64 position = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->position(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int LearnRequest::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint64 position = 1;
+    if (has_position()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->truncate());
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->position());
     }
     
   }
@@ -3106,10 +5067,10 @@ int WriteRequest::ByteSize() const {
   return total_size;
 }
 
-void WriteRequest::MergeFrom(const ::google::protobuf::Message& from) {
+void LearnRequest::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const WriteRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const WriteRequest*>(
+  const LearnRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const LearnRequest*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -3118,78 +5079,48 @@ void WriteRequest::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void WriteRequest::MergeFrom(const WriteRequest& from) {
+void LearnRequest::MergeFrom(const LearnRequest& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from._has_bit(0)) {
-      set_id(from.id());
-    }
-    if (from._has_bit(1)) {
       set_position(from.position());
     }
-    if (from._has_bit(2)) {
-      set_learned(from.learned());
-    }
-    if (from._has_bit(3)) {
-      set_type(from.type());
-    }
-    if (from._has_bit(4)) {
-      mutable_nop()->::mesos::internal::log::Action_Nop::MergeFrom(from.nop());
-    }
-    if (from._has_bit(5)) {
-      mutable_append()->::mesos::internal::log::Action_Append::MergeFrom(from.append());
-    }
-    if (from._has_bit(6)) {
-      mutable_truncate()->::mesos::internal::log::Action_Truncate::MergeFrom(from.truncate());
-    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void WriteRequest::CopyFrom(const ::google::protobuf::Message& from) {
+void LearnRequest::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void WriteRequest::CopyFrom(const WriteRequest& from) {
+void LearnRequest::CopyFrom(const LearnRequest& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool WriteRequest::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000b) != 0x0000000b) return false;
+bool LearnRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
   
-  if (has_append()) {
-    if (!this->append().IsInitialized()) return false;
-  }
-  if (has_truncate()) {
-    if (!this->truncate().IsInitialized()) return false;
-  }
   return true;
 }
 
-void WriteRequest::Swap(WriteRequest* other) {
+void LearnRequest::Swap(LearnRequest* other) {
   if (other != this) {
-    std::swap(id_, other->id_);
     std::swap(position_, other->position_);
-    std::swap(learned_, other->learned_);
-    std::swap(type_, other->type_);
-    std::swap(nop_, other->nop_);
-    std::swap(append_, other->append_);
-    std::swap(truncate_, other->truncate_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata WriteRequest::GetMetadata() const {
+::google::protobuf::Metadata LearnRequest::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = WriteRequest_descriptor_;
-  metadata.reflection = WriteRequest_reflection_;
+  metadata.descriptor = LearnRequest_descriptor_;
+  metadata.reflection = LearnRequest_reflection_;
   return metadata;
 }
 
@@ -3197,73 +5128,74 @@ void WriteRequest::Swap(WriteRequest* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int WriteResponse::kOkayFieldNumber;
-const int WriteResponse::kIdFieldNumber;
-const int WriteResponse::kPositionFieldNumber;
+const int LearnResponse::kOkayFieldNumber;
+const int LearnResponse::kActionFieldNumber;
 #endif  // !_MSC_VER
 
-WriteResponse::WriteResponse()
+LearnResponse::LearnResponse()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void WriteResponse::InitAsDefaultInstance() {
+void LearnResponse::InitAsDefaultInstance() {
+  action_ = const_cast< ::mesos::internal::log::Action*>(&::mesos::internal::log::Action::default_instance());
 }
 
-WriteResponse::WriteResponse(const WriteResponse& from)
+LearnResponse::LearnResponse(const LearnResponse& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void WriteResponse::SharedCtor() {
+void LearnResponse::SharedCtor() {
   _cached_size_ = 0;
   okay_ = false;
-  id_ = GOOGLE_ULONGLONG(0);
-  position_ = GOOGLE_ULONGLONG(0);
+  action_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-WriteResponse::~WriteResponse() {
+LearnResponse::~LearnResponse() {
   SharedDtor();
 }
 
-void WriteResponse::SharedDtor() {
+void LearnResponse::SharedDtor() {
   if (this != default_instance_) {
+    delete action_;
   }
 }
 
-void WriteResponse::SetCachedSize(int size) const {
+void LearnResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* WriteResponse::descriptor() {
+const ::google::protobuf::Descriptor* LearnResponse::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return WriteResponse_descriptor_;
+  return LearnResponse_descriptor_;
 }
 
-const WriteResponse& WriteResponse::default_instance() {
+const LearnResponse& LearnResponse::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
 }
 
-WriteResponse* WriteResponse::default_instance_ = NULL;
+LearnResponse* LearnResponse::default_instance_ = NULL;
 
-WriteResponse* WriteResponse::New() const {
-  return new WriteResponse;
+LearnResponse* LearnResponse::New() const {
+  return new LearnResponse;
 }
 
-void WriteResponse::Clear() {
+void LearnResponse::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     okay_ = false;
-    id_ = GOOGLE_ULONGLONG(0);
-    position_ = GOOGLE_ULONGLONG(0);
+    if (_has_bit(1)) {
+      if (action_ != NULL) action_->::mesos::internal::log::Action::Clear();
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool WriteResponse::MergePartialFromCodedStream(
+bool LearnResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
@@ -3280,35 +5212,17 @@ bool WriteResponse::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(16)) goto parse_id;
+        if (input->ExpectTag(18)) goto parse_action;
         break;
       }
       
-      // required uint64 id = 2;
+      // optional .mesos.internal.log.Action action = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &id_)));
-          _set_bit(1);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_position;
-        break;
-      }
-      
-      // required uint64 position = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_position:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &position_)));
-          _set_bit(2);
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_action:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_action()));
         } else {
           goto handle_uninterpreted;
         }
@@ -3332,21 +5246,17 @@ bool WriteResponse::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void WriteResponse::SerializeWithCachedSizes(
+void LearnResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
   // required bool okay = 1;
   if (_has_bit(0)) {
     ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->okay(), output);
   }
   
-  // required uint64 id = 2;
+  // optional .mesos.internal.log.Action action = 2;
   if (_has_bit(1)) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->id(), output);
-  }
-  
-  // required uint64 position = 3;
-  if (_has_bit(2)) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->position(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->action(), output);
   }
   
   if (!unknown_fields().empty()) {
@@ -3355,21 +5265,18 @@ void WriteResponse::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* WriteResponse::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* LearnResponse::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
   // required bool okay = 1;
   if (_has_bit(0)) {
     target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->okay(), target);
   }
   
-  // required uint64 id = 2;
+  // optional .mesos.internal.log.Action action = 2;
   if (_has_bit(1)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->id(), target);
-  }
-  
-  // required uint64 position = 3;
-  if (_has_bit(2)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->position(), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->action(), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -3379,7 +5286,7 @@ void WriteResponse::SerializeWithCachedSizes(
   return target;
 }
 
-int WriteResponse::ByteSize() const {
+int LearnResponse::ByteSize() const {
   int total_size = 0;
   
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
@@ -3388,18 +5295,11 @@ int WriteResponse::ByteSize() const {
       total_size += 1 + 1;
     }
     
-    // required uint64 id = 2;
-    if (has_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->id());
-    }
-    
-    // required uint64 position = 3;
-    if (has_position()) {
+    // optional .mesos.internal.log.Action action = 2;
+    if (has_action()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->position());
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->action());
     }
     
   }
@@ -3414,10 +5314,10 @@ int WriteResponse::ByteSize() const {
   return total_size;
 }
 
-void WriteResponse::MergeFrom(const ::google::protobuf::Message& from) {
+void LearnResponse::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const WriteResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const WriteResponse*>(
+  const LearnResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const LearnResponse*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -3426,56 +5326,55 @@ void WriteResponse::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void WriteResponse::MergeFrom(const WriteResponse& from) {
+void LearnResponse::MergeFrom(const LearnResponse& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from._has_bit(0)) {
       set_okay(from.okay());
     }
     if (from._has_bit(1)) {
-      set_id(from.id());
-    }
-    if (from._has_bit(2)) {
-      set_position(from.position());
+      mutable_action()->::mesos::internal::log::Action::MergeFrom(from.action());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void WriteResponse::CopyFrom(const ::google::protobuf::Message& from) {
+void LearnResponse::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void WriteResponse::CopyFrom(const WriteResponse& from) {
+void LearnResponse::CopyFrom(const LearnResponse& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool WriteResponse::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+bool LearnResponse::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
   
+  if (has_action()) {
+    if (!this->action().IsInitialized()) return false;
+  }
   return true;
 }
 
-void WriteResponse::Swap(WriteResponse* other) {
+void LearnResponse::Swap(LearnResponse* other) {
   if (other != this) {
     std::swap(okay_, other->okay_);
-    std::swap(id_, other->id_);
-    std::swap(position_, other->position_);
+    std::swap(action_, other->action_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata WriteResponse::GetMetadata() const {
+::google::protobuf::Metadata LearnResponse::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = WriteResponse_descriptor_;
-  metadata.reflection = WriteResponse_reflection_;
+  metadata.descriptor = LearnResponse_descriptor_;
+  metadata.reflection = LearnResponse_reflection_;
   return metadata;
 }
 
@@ -3483,80 +5382,82 @@ void WriteResponse::Swap(WriteResponse* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int LearnRequest::kPositionFieldNumber;
+const int LearnedMessage::kActionFieldNumber;
 #endif  // !_MSC_VER
 
-LearnRequest::LearnRequest()
+LearnedMessage::LearnedMessage()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void LearnRequest::InitAsDefaultInstance() {
+void LearnedMessage::InitAsDefaultInstance() {
+  action_ = const_cast< ::mesos::internal::log::Action*>(&::mesos::internal::log::Action::default_instance());
 }
 
-LearnRequest::LearnRequest(const LearnRequest& from)
+LearnedMessage::LearnedMessage(const LearnedMessage& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void LearnRequest::SharedCtor() {
+void LearnedMessage::SharedCtor() {
   _cached_size_ = 0;
-  position_ = GOOGLE_ULONGLONG(0);
+  action_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-LearnRequest::~LearnRequest() {
+LearnedMessage::~LearnedMessage() {
   SharedDtor();
 }
 
-void LearnRequest::SharedDtor() {
+void LearnedMessage::SharedDtor() {
   if (this != default_instance_) {
+    delete action_;
   }
 }
 
-void LearnRequest::SetCachedSize(int size) const {
+void LearnedMessage::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* LearnRequest::descriptor() {
+const ::google::protobuf::Descriptor* LearnedMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return LearnRequest_descriptor_;
+  return LearnedMessage_descriptor_;
 }
 
-const LearnRequest& LearnRequest::default_instance() {
+const LearnedMessage& LearnedMessage::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
 }
 
-LearnRequest* LearnRequest::default_instance_ = NULL;
+LearnedMessage* LearnedMessage::default_instance_ = NULL;
 
-LearnRequest* LearnRequest::New() const {
-  return new LearnRequest;
+LearnedMessage* LearnedMessage::New() const {
+  return new LearnedMessage;
 }
 
-void LearnRequest::Clear() {
+void LearnedMessage::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    position_ = GOOGLE_ULONGLONG(0);
+    if (_has_bit(0)) {
+      if (action_ != NULL) action_->::mesos::internal::log::Action::Clear();
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool LearnRequest::MergePartialFromCodedStream(
+bool LearnedMessage::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint64 position = 1;
+      // required .mesos.internal.log.Action action = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &position_)));
-          _set_bit(0);
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_action()));
         } else {
           goto handle_uninterpreted;
         }
@@ -3580,11 +5481,12 @@ bool LearnRequest::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void LearnRequest::SerializeWithCachedSizes(
+void LearnedMessage::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required uint64 position = 1;
+  // required .mesos.internal.log.Action action = 1;
   if (_has_bit(0)) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->position(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->action(), output);
   }
   
   if (!unknown_fields().empty()) {
@@ -3593,11 +5495,13 @@ void LearnRequest::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* LearnRequest::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* LearnedMessage::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required uint64 position = 1;
+  // required .mesos.internal.log.Action action = 1;
   if (_has_bit(0)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->position(), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->action(), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -3607,15 +5511,15 @@ void LearnRequest::SerializeWithCachedSizes(
   return target;
 }
 
-int LearnRequest::ByteSize() const {
+int LearnedMessage::ByteSize() const {
   int total_size = 0;
   
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint64 position = 1;
-    if (has_position()) {
+    // required .mesos.internal.log.Action action = 1;
+    if (has_action()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->position());
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->action());
     }
     
   }
@@ -3630,10 +5534,10 @@ int LearnRequest::ByteSize() const {
   return total_size;
 }
 
-void LearnRequest::MergeFrom(const ::google::protobuf::Message& from) {
+void LearnedMessage::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const LearnRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const LearnRequest*>(
+  const LearnedMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const LearnedMessage*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -3642,48 +5546,51 @@ void LearnRequest::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void LearnRequest::MergeFrom(const LearnRequest& from) {
+void LearnedMessage::MergeFrom(const LearnedMessage& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from._has_bit(0)) {
-      set_position(from.position());
+      mutable_action()->::mesos::internal::log::Action::MergeFrom(from.action());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void LearnRequest::CopyFrom(const ::google::protobuf::Message& from) {
+void LearnedMessage::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void LearnRequest::CopyFrom(const LearnRequest& from) {
+void LearnedMessage::CopyFrom(const LearnedMessage& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LearnRequest::IsInitialized() const {
+bool LearnedMessage::IsInitialized() const {
   if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
   
+  if (has_action()) {
+    if (!this->action().IsInitialized()) return false;
+  }
   return true;
 }
 
-void LearnRequest::Swap(LearnRequest* other) {
+void LearnedMessage::Swap(LearnedMessage* other) {
   if (other != this) {
-    std::swap(position_, other->position_);
+    std::swap(action_, other->action_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata LearnRequest::GetMetadata() const {
+::google::protobuf::Metadata LearnedMessage::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = LearnRequest_descriptor_;
-  metadata.reflection = LearnRequest_reflection_;
+  metadata.descriptor = LearnedMessage_descriptor_;
+  metadata.reflection = LearnedMessage_reflection_;
   return metadata;
 }
 
@@ -3691,101 +5598,118 @@ void LearnRequest::Swap(LearnRequest* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int LearnResponse::kOkayFieldNumber;
-const int LearnResponse::kActionFieldNumber;
+const int CatchupRequest::kIdFieldNumber;
+const int CatchupRequest::kFromFieldNumber;
+const int CatchupRequest::kToFieldNumber;
 #endif  // !_MSC_VER
 
-LearnResponse::LearnResponse()
+CatchupRequest::CatchupRequest()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void LearnResponse::InitAsDefaultInstance() {
-  action_ = const_cast< ::mesos::internal::log::Action*>(&::mesos::internal::log::Action::default_instance());
+void CatchupRequest::InitAsDefaultInstance() {
 }
 
-LearnResponse::LearnResponse(const LearnResponse& from)
+CatchupRequest::CatchupRequest(const CatchupRequest& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void LearnResponse::SharedCtor() {
+void CatchupRequest::SharedCtor() {
   _cached_size_ = 0;
-  okay_ = false;
-  action_ = NULL;
+  id_ = GOOGLE_ULONGLONG(0);
+  from_ = GOOGLE_ULONGLONG(0);
+  to_ = GOOGLE_ULONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-LearnResponse::~LearnResponse() {
+CatchupRequest::~CatchupRequest() {
   SharedDtor();
 }
 
-void LearnResponse::SharedDtor() {
+void CatchupRequest::SharedDtor() {
   if (this != default_instance_) {
-    delete action_;
   }
 }
 
-void LearnResponse::SetCachedSize(int size) const {
+void CatchupRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* LearnResponse::descriptor() {
+const ::google::protobuf::Descriptor* CatchupRequest::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return LearnResponse_descriptor_;
+  return CatchupRequest_descriptor_;
 }
 
-const LearnResponse& LearnResponse::default_instance() {
+const CatchupRequest& CatchupRequest::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
 }
 
-LearnResponse* LearnResponse::default_instance_ = NULL;
+CatchupRequest* CatchupRequest::default_instance_ = NULL;
 
-LearnResponse* LearnResponse::New() const {
-  return new LearnResponse;
+CatchupRequest* CatchupRequest::New() const {
+  return new CatchupRequest;
 }
 
-void LearnResponse::Clear() {
+void CatchupRequest::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    okay_ = false;
-    if (_has_bit(1)) {
-      if (action_ != NULL) action_->::mesos::internal::log::Action::Clear();
-    }
+    id_ = GOOGLE_ULONGLONG(0);
+    from_ = GOOGLE_ULONGLONG(0);
+    to_ = GOOGLE_ULONGLONG(0);
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool LearnResponse::MergePartialFromCodedStream(
+bool CatchupRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required bool okay = 1;
+      // required uint64 id = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &okay_)));
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &id_)));
           _set_bit(0);
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(18)) goto parse_action;
+        if (input->ExpectTag(16)) goto parse_from;
         break;
       }
       
-      // optional .mesos.internal.log.Action action = 2;
+      // required uint64 from = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_action:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_action()));
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_from:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &from_)));
+          _set_bit(1);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_to;
+        break;
+      }
+      
+      // required uint64 to = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_to:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &to_)));
+          _set_bit(2);
         } else {
           goto handle_uninterpreted;
         }
@@ -3809,17 +5733,21 @@ bool LearnResponse::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void LearnResponse::SerializeWithCachedSizes(
+void CatchupRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required bool okay = 1;
+  // required uint64 id = 1;
   if (_has_bit(0)) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->okay(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->id(), output);
   }
   
-  // optional .mesos.internal.log.Action action = 2;
+  // required uint64 from = 2;
   if (_has_bit(1)) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->action(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->from(), output);
+  }
+  
+  // required uint64 to = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->to(), output);
   }
   
   if (!unknown_fields().empty()) {
@@ -3828,18 +5756,21 @@ void LearnResponse::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* LearnResponse::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CatchupRequest::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required bool okay = 1;
+  // required uint64 id = 1;
   if (_has_bit(0)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->okay(), target);
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->id(), target);
   }
   
-  // optional .mesos.internal.log.Action action = 2;
+  // required uint64 from = 2;
   if (_has_bit(1)) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->action(), target);
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->from(), target);
+  }
+  
+  // required uint64 to = 3;
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->to(), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -3849,20 +5780,29 @@ void LearnResponse::SerializeWithCachedSizes(
   return target;
 }
 
-int LearnResponse::ByteSize() const {
+int CatchupRequest::ByteSize() const {
   int total_size = 0;
   
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required bool okay = 1;
-    if (has_okay()) {
-      total_size += 1 + 1;
+    // required uint64 id = 1;
+    if (has_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->id());
     }
     
-    // optional .mesos.internal.log.Action action = 2;
-    if (has_action()) {
+    // required uint64 from = 2;
+    if (has_from()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->action());
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->from());
+    }
+    
+    // required uint64 to = 3;
+    if (has_to()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->to());
     }
     
   }
@@ -3877,10 +5817,10 @@ int LearnResponse::ByteSize() const {
   return total_size;
 }
 
-void LearnResponse::MergeFrom(const ::google::protobuf::Message& from) {
+void CatchupRequest::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const LearnResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const LearnResponse*>(
+  const CatchupRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CatchupRequest*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -3889,55 +5829,56 @@ void LearnResponse::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void LearnResponse::MergeFrom(const LearnResponse& from) {
+void CatchupRequest::MergeFrom(const CatchupRequest& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from._has_bit(0)) {
-      set_okay(from.okay());
+      set_id(from.id());
     }
     if (from._has_bit(1)) {
-      mutable_action()->::mesos::internal::log::Action::MergeFrom(from.action());
+      set_from(from.from());
+    }
+    if (from._has_bit(2)) {
+      set_to(from.to());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void LearnResponse::CopyFrom(const ::google::protobuf::Message& from) {
+void CatchupRequest::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void LearnResponse::CopyFrom(const LearnResponse& from) {
+void CatchupRequest::CopyFrom(const CatchupRequest& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LearnResponse::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+bool CatchupRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
   
-  if (has_action()) {
-    if (!this->action().IsInitialized()) return false;
-  }
   return true;
 }
 
-void LearnResponse::Swap(LearnResponse* other) {
+void CatchupRequest::Swap(CatchupRequest* other) {
   if (other != this) {
-    std::swap(okay_, other->okay_);
-    std::swap(action_, other->action_);
+    std::swap(id_, other->id_);
+    std::swap(from_, other->from_);
+    std::swap(to_, other->to_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata LearnResponse::GetMetadata() const {
+::google::protobuf::Metadata CatchupRequest::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = LearnResponse_descriptor_;
-  metadata.reflection = LearnResponse_reflection_;
+  metadata.descriptor = CatchupRequest_descriptor_;
+  metadata.reflection = CatchupRequest_reflection_;
   return metadata;
 }
 
@@ -3945,85 +5886,100 @@ void LearnResponse::Swap(LearnResponse* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int LearnedMessage::kActionFieldNumber;
+const int CatchupResponse::kIdFieldNumber;
+const int CatchupResponse::kActionsFieldNumber;
 #endif  // !_MSC_VER
 
-LearnedMessage::LearnedMessage()
+CatchupResponse::CatchupResponse()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void LearnedMessage::InitAsDefaultInstance() {
-  action_ = const_cast< ::mesos::internal::log::Action*>(&::mesos::internal::log::Action::default_instance());
+void CatchupResponse::InitAsDefaultInstance() {
 }
 
-LearnedMessage::LearnedMessage(const LearnedMessage& from)
+CatchupResponse::CatchupResponse(const CatchupResponse& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void LearnedMessage::SharedCtor() {
+void CatchupResponse::SharedCtor() {
   _cached_size_ = 0;
-  action_ = NULL;
+  id_ = GOOGLE_ULONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-LearnedMessage::~LearnedMessage() {
+CatchupResponse::~CatchupResponse() {
   SharedDtor();
 }
 
-void LearnedMessage::SharedDtor() {
+void CatchupResponse::SharedDtor() {
   if (this != default_instance_) {
-    delete action_;
   }
 }
 
-void LearnedMessage::SetCachedSize(int size) const {
+void CatchupResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* LearnedMessage::descriptor() {
+const ::google::protobuf::Descriptor* CatchupResponse::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return LearnedMessage_descriptor_;
+  return CatchupResponse_descriptor_;
 }
 
-const LearnedMessage& LearnedMessage::default_instance() {
+const CatchupResponse& CatchupResponse::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_log_2eproto();  return *default_instance_;
 }
 
-LearnedMessage* LearnedMessage::default_instance_ = NULL;
+CatchupResponse* CatchupResponse::default_instance_ = NULL;
 
-LearnedMessage* LearnedMessage::New() const {
-  return new LearnedMessage;
+CatchupResponse* CatchupResponse::New() const {
+  return new CatchupResponse;
 }
 
-void LearnedMessage::Clear() {
+void CatchupResponse::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (_has_bit(0)) {
-      if (action_ != NULL) action_->::mesos::internal::log::Action::Clear();
-    }
+    id_ = GOOGLE_ULONGLONG(0);
   }
+  actions_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool LearnedMessage::MergePartialFromCodedStream(
+bool CatchupResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .mesos.internal.log.Action action = 1;
+      // required uint64 id = 1;
       case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &id_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_actions;
+        break;
+      }
+      
+      // repeated .mesos.internal.log.Action actions = 2;
+      case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_actions:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_action()));
+                input, add_actions()));
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(18)) goto parse_actions;
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -4044,12 +6000,17 @@ bool LearnedMessage::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void LearnedMessage::SerializeWithCachedSizes(
+void CatchupResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .mesos.internal.log.Action action = 1;
+  // required uint64 id = 1;
   if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->id(), output);
+  }
+  
+  // repeated .mesos.internal.log.Action actions = 2;
+  for (int i = 0; i < this->actions_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->action(), output);
+      2, this->actions(i), output);
   }
   
   if (!unknown_fields().empty()) {
@@ -4058,13 +6019,18 @@ void LearnedMessage::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* LearnedMessage::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CatchupResponse::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required .mesos.internal.log.Action action = 1;
+  // required uint64 id = 1;
   if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->id(), target);
+  }
+  
+  // repeated .mesos.internal.log.Action actions = 2;
+  for (int i = 0; i < this->actions_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        1, this->action(), target);
+        2, this->actions(i), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -4074,18 +6040,26 @@ void LearnedMessage::SerializeWithCachedSizes(
   return target;
 }
 
-int LearnedMessage::ByteSize() const {
+int CatchupResponse::ByteSize() const {
   int total_size = 0;
   
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .mesos.internal.log.Action action = 1;
-    if (has_action()) {
+    // required uint64 id = 1;
+    if (has_id()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->action());
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->id());
     }
     
   }
+  // repeated .mesos.internal.log.Action actions = 2;
+  total_size += 1 * this->actions_size();
+  for (int i = 0; i < this->actions_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->actions(i));
+  }
+  
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -4097,10 +6071,10 @@ int LearnedMessage::ByteSize() const {
   return total_size;
 }
 
-void LearnedMessage::MergeFrom(const ::google::protobuf::Message& from) {
+void CatchupResponse::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const LearnedMessage* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const LearnedMessage*>(
+  const CatchupResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CatchupResponse*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -4109,51 +6083,53 @@ void LearnedMessage::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void LearnedMessage::MergeFrom(const LearnedMessage& from) {
+void CatchupResponse::MergeFrom(const CatchupResponse& from) {
   GOOGLE_CHECK_NE(&from, this);
+  actions_.MergeFrom(from.actions_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from._has_bit(0)) {
-      mutable_action()->::mesos::internal::log::Action::MergeFrom(from.action());
+      set_id(from.id());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void LearnedMessage::CopyFrom(const ::google::protobuf::Message& from) {
+void CatchupResponse::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void LearnedMessage::CopyFrom(const LearnedMessage& from) {
+void CatchupResponse::CopyFrom(const CatchupResponse& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LearnedMessage::IsInitialized() const {
+bool CatchupResponse::IsInitialized() const {
   if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
   
-  if (has_action()) {
-    if (!this->action().IsInitialized()) return false;
+  for (int i = 0; i < actions_size(); i++) {
+    if (!this->actions(i).IsInitialized()) return false;
   }
   return true;
 }
 
-void LearnedMessage::Swap(LearnedMessage* other) {
+void CatchupResponse::Swap(CatchupResponse* other) {
   if (other != this) {
-    std::swap(action_, other->action_);
+    std::swap(id_, other->id_);
+    actions_.Swap(&other->actions_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata LearnedMessage::GetMetadata() const {
+::google::protobuf::Metadata CatchupResponse::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = LearnedMessage_descriptor_;
-  metadata.reflection = LearnedMessage_reflection_;
+  metadata.descriptor = CatchupResponse_descriptor_;
+  metadata.reflection = CatchupResponse_reflection_;
   return metadata;
 }
 
@@ -39,14 +39,20 @@ class Action;
 class Action_Nop;
 class Action_Append;
 class Action_Truncate;
+class Checkpoint;
+class Checkpoint_Range;
 class Record;
 class PromiseRequest;
 class PromiseResponse;
 class WriteRequest;
 class WriteResponse;
+class BatchWriteRequest;
+class BatchWriteResponse;
 class LearnRequest;
 class LearnResponse;
 class LearnedMessage;
+class CatchupRequest;
+class CatchupResponse;
 
 enum Action_Type {
   Action_Type_NOP = 1,
@@ -70,11 +76,12 @@ inline bool Action_Type_Parse(
 }
 enum Record_Type {
   Record_Type_PROMISE = 1,
-  Record_Type_ACTION = 2
+  Record_Type_ACTION = 2,
+  Record_Type_CHECKPOINT = 3
 };
 bool Record_Type_IsValid(int value);
 const Record_Type Record_Type_Type_MIN = Record_Type_PROMISE;
-const Record_Type Record_Type_Type_MAX = Record_Type_ACTION;
+const Record_Type Record_Type_Type_MAX = Record_Type_CHECKPOINT;
 const int Record_Type_Type_ARRAYSIZE = Record_Type_Type_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* Record_Type_descriptor();
@@ -627,6 +634,236 @@ class Action : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class Checkpoint_Range : public ::google::protobuf::Message {
+ public:
+  Checkpoint_Range();
+  virtual ~Checkpoint_Range();
+  
+  Checkpoint_Range(const Checkpoint_Range& from);
+  
+  inline Checkpoint_Range& operator=(const Checkpoint_Range& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Checkpoint_Range& default_instance();
+  
+  void Swap(Checkpoint_Range* other);
+  
+  // implements Message ----------------------------------------------
+  
+  Checkpoint_Range* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Checkpoint_Range& from);
+  void MergeFrom(const Checkpoint_Range& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // required uint64 from = 1;
+  inline bool has_from() const;
+  inline void clear_from();
+  static const int kFromFieldNumber = 1;
+  inline ::google::protobuf::uint64 from() const;
+  inline void set_from(::google::protobuf::uint64 value);
+  
+  // required uint64 to = 2;
+  inline bool has_to() const;
+  inline void clear_to();
+  static const int kToFieldNumber = 2;
+  inline ::google::protobuf::uint64 to() const;
+  inline void set_to(::google::protobuf::uint64 value);
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.log.Checkpoint.Range)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable int _cached_size_;
+  
+  ::google::protobuf::uint64 from_;
+  ::google::protobuf::uint64 to_;
+  friend void  protobuf_AddDesc_log_2eproto();
+  friend void protobuf_AssignDesc_log_2eproto();
+  friend void protobuf_ShutdownFile_log_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static Checkpoint_Range* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Checkpoint : public ::google::protobuf::Message {
+ public:
+  Checkpoint();
+  virtual ~Checkpoint();
+  
+  Checkpoint(const Checkpoint& from);
+  
+  inline Checkpoint& operator=(const Checkpoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Checkpoint& default_instance();
+  
+  void Swap(Checkpoint* other);
+  
+  // implements Message ----------------------------------------------
+  
+  Checkpoint* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Checkpoint& from);
+  void MergeFrom(const Checkpoint& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  typedef Checkpoint_Range Range;
+  
+  // accessors -------------------------------------------------------
+  
+  // required uint64 coordinator = 1;
+  inline bool has_coordinator() const;
+  inline void clear_coordinator();
+  static const int kCoordinatorFieldNumber = 1;
+  inline ::google::protobuf::uint64 coordinator() const;
+  inline void set_coordinator(::google::protobuf::uint64 value);
+  
+  // required uint64 begin = 2;
+  inline bool has_begin() const;
+  inline void clear_begin();
+  static const int kBeginFieldNumber = 2;
+  inline ::google::protobuf::uint64 begin() const;
+  inline void set_begin(::google::protobuf::uint64 value);
+  
+  // required uint64 end = 3;
+  inline bool has_end() const;
+  inline void clear_end();
+  static const int kEndFieldNumber = 3;
+  inline ::google::protobuf::uint64 end() const;
+  inline void set_end(::google::protobuf::uint64 value);
+  
+  // repeated .mesos.internal.log.Checkpoint.Range holes = 4;
+  inline int holes_size() const;
+  inline void clear_holes();
+  static const int kHolesFieldNumber = 4;
+  inline const ::mesos::internal::log::Checkpoint_Range& holes(int index) const;
+  inline ::mesos::internal::log::Checkpoint_Range* mutable_holes(int index);
+  inline ::mesos::internal::log::Checkpoint_Range* add_holes();
+  inline const ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Checkpoint_Range >&
+      holes() const;
+  inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Checkpoint_Range >*
+      mutable_holes();
+  
+  // repeated .mesos.internal.log.Checkpoint.Range unlearned = 5;
+  inline int unlearned_size() const;
+  inline void clear_unlearned();
+  static const int kUnlearnedFieldNumber = 5;
+  inline const ::mesos::internal::log::Checkpoint_Range& unlearned(int index) const;
+  inline ::mesos::internal::log::Checkpoint_Range* mutable_unlearned(int index);
+  inline ::mesos::internal::log::Checkpoint_Range* add_unlearned();
+  inline const ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Checkpoint_Range >&
+      unlearned() const;
+  inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Checkpoint_Range >*
+      mutable_unlearned();
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.log.Checkpoint)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable int _cached_size_;
+  
+  ::google::protobuf::uint64 coordinator_;
+  ::google::protobuf::uint64 begin_;
+  ::google::protobuf::uint64 end_;
+  ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Checkpoint_Range > holes_;
+  ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Checkpoint_Range > unlearned_;
+  friend void  protobuf_AddDesc_log_2eproto();
+  friend void protobuf_AssignDesc_log_2eproto();
+  friend void protobuf_ShutdownFile_log_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static Checkpoint* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class Record : public ::google::protobuf::Message {
  public:
   Record();
@@ -682,6 +919,7 @@ class Record : public ::google::protobuf::Message {
   typedef Record_Type Type;
   static const Type PROMISE = Record_Type_PROMISE;
   static const Type ACTION = Record_Type_ACTION;
+  static const Type CHECKPOINT = Record_Type_CHECKPOINT;
   static inline bool Type_IsValid(int value) {
     return Record_Type_IsValid(value);
   }
@@ -726,6 +964,13 @@ class Record : public ::google::protobuf::Message {
   inline const ::mesos::internal::log::Action& action() const;
   inline ::mesos::internal::log::Action* mutable_action();
   
+  // optional .mesos.internal.log.Checkpoint checkpoint = 4;
+  inline bool has_checkpoint() const;
+  inline void clear_checkpoint();
+  static const int kCheckpointFieldNumber = 4;
+  inline const ::mesos::internal::log::Checkpoint& checkpoint() const;
+  inline ::mesos::internal::log::Checkpoint* mutable_checkpoint();
+  
   // @@protoc_insertion_point(class_scope:mesos.internal.log.Record)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
@@ -734,11 +979,12 @@ class Record : public ::google::protobuf::Message {
   int type_;
   ::mesos::internal::log::Promise* promise_;
   ::mesos::internal::log::Action* action_;
+  ::mesos::internal::log::Checkpoint* checkpoint_;
   friend void  protobuf_AddDesc_log_2eproto();
   friend void protobuf_AssignDesc_log_2eproto();
   friend void protobuf_ShutdownFile_log_2eproto();
   
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
   
   // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
   inline bool _has_bit(int index) const {
@@ -1208,14 +1454,14 @@ class WriteResponse : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class LearnRequest : public ::google::protobuf::Message {
+class BatchWriteRequest : public ::google::protobuf::Message {
  public:
-  LearnRequest();
-  virtual ~LearnRequest();
+  BatchWriteRequest();
+  virtual ~BatchWriteRequest();
   
-  LearnRequest(const LearnRequest& from);
+  BatchWriteRequest(const BatchWriteRequest& from);
   
-  inline LearnRequest& operator=(const LearnRequest& from) {
+  inline BatchWriteRequest& operator=(const BatchWriteRequest& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1229,17 +1475,17 @@ class LearnRequest : public ::google::protobuf::Message {
   }
   
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LearnRequest& default_instance();
+  static const BatchWriteRequest& default_instance();
   
-  void Swap(LearnRequest* other);
+  void Swap(BatchWriteRequest* other);
   
   // implements Message ----------------------------------------------
   
-  LearnRequest* New() const;
+  BatchWriteRequest* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LearnRequest& from);
-  void MergeFrom(const LearnRequest& from);
+  void CopyFrom(const BatchWriteRequest& from);
+  void MergeFrom(const BatchWriteRequest& from);
   void Clear();
   bool IsInitialized() const;
   
@@ -1262,24 +1508,50 @@ class LearnRequest : public ::google::protobuf::Message {
   
   // accessors -------------------------------------------------------
   
-  // required uint64 position = 1;
-  inline bool has_position() const;
-  inline void clear_position();
-  static const int kPositionFieldNumber = 1;
-  inline ::google::protobuf::uint64 position() const;
-  inline void set_position(::google::protobuf::uint64 value);
+  // required uint64 id = 1;
+  inline bool has_id() const;
+  inline void clear_id();
+  static const int kIdFieldNumber = 1;
+  inline ::google::protobuf::uint64 id() const;
+  inline void set_id(::google::protobuf::uint64 value);
   
-  // @@protoc_insertion_point(class_scope:mesos.internal.log.LearnRequest)
+  // repeated .mesos.internal.log.WriteRequest writes = 2;
+  inline int writes_size() const;
+  inline void clear_writes();
+  static const int kWritesFieldNumber = 2;
+  inline const ::mesos::internal::log::WriteRequest& writes(int index) const;
+  inline ::mesos::internal::log::WriteRequest* mutable_writes(int index);
+  inline ::mesos::internal::log::WriteRequest* add_writes();
+  inline const ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::WriteRequest >&
+      writes() const;
+  inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::WriteRequest >*
+      mutable_writes();
+  
+  // repeated uint64 learned = 3;
+  inline int learned_size() const;
+  inline void clear_learned();
+  static const int kLearnedFieldNumber = 3;
+  inline ::google::protobuf::uint64 learned(int index) const;
+  inline void set_learned(int index, ::google::protobuf::uint64 value);
+  inline void add_learned(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      learned() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_learned();
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.log.BatchWriteRequest)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
   mutable int _cached_size_;
   
-  ::google::protobuf::uint64 position_;
+  ::google::protobuf::uint64 id_;
+  ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::WriteRequest > writes_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > learned_;
   friend void  protobuf_AddDesc_log_2eproto();
   friend void protobuf_AssignDesc_log_2eproto();
   friend void protobuf_ShutdownFile_log_2eproto();
   
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
   
   // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
   inline bool _has_bit(int index) const {
@@ -1293,18 +1565,18 @@ class LearnRequest : public ::google::protobuf::Message {
   }
   
   void InitAsDefaultInstance();
-  static LearnRequest* default_instance_;
+  static BatchWriteRequest* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class LearnResponse : public ::google::protobuf::Message {
+class BatchWriteResponse : public ::google::protobuf::Message {
  public:
-  LearnResponse();
-  virtual ~LearnResponse();
+  BatchWriteResponse();
+  virtual ~BatchWriteResponse();
   
-  LearnResponse(const LearnResponse& from);
+  BatchWriteResponse(const BatchWriteResponse& from);
   
-  inline LearnResponse& operator=(const LearnResponse& from) {
+  inline BatchWriteResponse& operator=(const BatchWriteResponse& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1318,17 +1590,17 @@ class LearnResponse : public ::google::protobuf::Message {
   }
   
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LearnResponse& default_instance();
+  static const BatchWriteResponse& default_instance();
   
-  void Swap(LearnResponse* other);
+  void Swap(BatchWriteResponse* other);
   
   // implements Message ----------------------------------------------
   
-  LearnResponse* New() const;
+  BatchWriteResponse* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LearnResponse& from);
-  void MergeFrom(const LearnResponse& from);
+  void CopyFrom(const BatchWriteResponse& from);
+  void MergeFrom(const BatchWriteResponse& from);
   void Clear();
   bool IsInitialized() const;
   
@@ -1358,25 +1630,38 @@ class LearnResponse : public ::google::protobuf::Message {
   inline bool okay() const;
   inline void set_okay(bool value);
   
-  // optional .mesos.internal.log.Action action = 2;
-  inline bool has_action() const;
-  inline void clear_action();
-  static const int kActionFieldNumber = 2;
-  inline const ::mesos::internal::log::Action& action() const;
-  inline ::mesos::internal::log::Action* mutable_action();
+  // required uint64 id = 2;
+  inline bool has_id() const;
+  inline void clear_id();
+  static const int kIdFieldNumber = 2;
+  inline ::google::protobuf::uint64 id() const;
+  inline void set_id(::google::protobuf::uint64 value);
   
-  // @@protoc_insertion_point(class_scope:mesos.internal.log.LearnResponse)
+  // repeated uint64 positions = 3;
+  inline int positions_size() const;
+  inline void clear_positions();
+  static const int kPositionsFieldNumber = 3;
+  inline ::google::protobuf::uint64 positions(int index) const;
+  inline void set_positions(int index, ::google::protobuf::uint64 value);
+  inline void add_positions(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      positions() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_positions();
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.log.BatchWriteResponse)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
   mutable int _cached_size_;
   
   bool okay_;
-  ::mesos::internal::log::Action* action_;
+  ::google::protobuf::uint64 id_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > positions_;
   friend void  protobuf_AddDesc_log_2eproto();
   friend void protobuf_AssignDesc_log_2eproto();
   friend void protobuf_ShutdownFile_log_2eproto();
   
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
   
   // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
   inline bool _has_bit(int index) const {
@@ -1390,18 +1675,18 @@ class LearnResponse : public ::google::protobuf::Message {
   }
   
   void InitAsDefaultInstance();
-  static LearnResponse* default_instance_;
+  static BatchWriteResponse* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class LearnedMessage : public ::google::protobuf::Message {
+class LearnRequest : public ::google::protobuf::Message {
  public:
-  LearnedMessage();
-  virtual ~LearnedMessage();
+  LearnRequest();
+  virtual ~LearnRequest();
   
-  LearnedMessage(const LearnedMessage& from);
+  LearnRequest(const LearnRequest& from);
   
-  inline LearnedMessage& operator=(const LearnedMessage& from) {
+  inline LearnRequest& operator=(const LearnRequest& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1415,17 +1700,17 @@ class LearnedMessage : public ::google::protobuf::Message {
   }
   
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LearnedMessage& default_instance();
+  static const LearnRequest& default_instance();
   
-  void Swap(LearnedMessage* other);
+  void Swap(LearnRequest* other);
   
   // implements Message ----------------------------------------------
   
-  LearnedMessage* New() const;
+  LearnRequest* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LearnedMessage& from);
-  void MergeFrom(const LearnedMessage& from);
+  void CopyFrom(const LearnRequest& from);
+  void MergeFrom(const LearnRequest& from);
   void Clear();
   bool IsInitialized() const;
   
@@ -1448,19 +1733,19 @@ class LearnedMessage : public ::google::protobuf::Message {
   
   // accessors -------------------------------------------------------
   
-  // required .mesos.internal.log.Action action = 1;
-  inline bool has_action() const;
-  inline void clear_action();
-  static const int kActionFieldNumber = 1;
-  inline const ::mesos::internal::log::Action& action() const;
-  inline ::mesos::internal::log::Action* mutable_action();
+  // required uint64 position = 1;
+  inline bool has_position() const;
+  inline void clear_position();
+  static const int kPositionFieldNumber = 1;
+  inline ::google::protobuf::uint64 position() const;
+  inline void set_position(::google::protobuf::uint64 value);
   
-  // @@protoc_insertion_point(class_scope:mesos.internal.log.LearnedMessage)
+  // @@protoc_insertion_point(class_scope:mesos.internal.log.LearnRequest)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
   mutable int _cached_size_;
   
-  ::mesos::internal::log::Action* action_;
+  ::google::protobuf::uint64 position_;
   friend void  protobuf_AddDesc_log_2eproto();
   friend void protobuf_AssignDesc_log_2eproto();
   friend void protobuf_ShutdownFile_log_2eproto();
@@ -1479,20 +1764,413 @@ class LearnedMessage : public ::google::protobuf::Message {
   }
   
   void InitAsDefaultInstance();
-  static LearnedMessage* default_instance_;
+  static LearnRequest* default_instance_;
 };
-// ===================================================================
-
-
-// ===================================================================
-
-// Promise
+// -------------------------------------------------------------------
 
-// required uint64 id = 1;
-inline bool Promise::has_id() const {
-  return _has_bit(0);
-}
-inline void Promise::clear_id() {
+class LearnResponse : public ::google::protobuf::Message {
+ public:
+  LearnResponse();
+  virtual ~LearnResponse();
+  
+  LearnResponse(const LearnResponse& from);
+  
+  inline LearnResponse& operator=(const LearnResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LearnResponse& default_instance();
+  
+  void Swap(LearnResponse* other);
+  
+  // implements Message ----------------------------------------------
+  
+  LearnResponse* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const LearnResponse& from);
+  void MergeFrom(const LearnResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // required bool okay = 1;
+  inline bool has_okay() const;
+  inline void clear_okay();
+  static const int kOkayFieldNumber = 1;
+  inline bool okay() const;
+  inline void set_okay(bool value);
+  
+  // optional .mesos.internal.log.Action action = 2;
+  inline bool has_action() const;
+  inline void clear_action();
+  static const int kActionFieldNumber = 2;
+  inline const ::mesos::internal::log::Action& action() const;
+  inline ::mesos::internal::log::Action* mutable_action();
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.log.LearnResponse)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable int _cached_size_;
+  
+  bool okay_;
+  ::mesos::internal::log::Action* action_;
+  friend void  protobuf_AddDesc_log_2eproto();
+  friend void protobuf_AssignDesc_log_2eproto();
+  friend void protobuf_ShutdownFile_log_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static LearnResponse* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class LearnedMessage : public ::google::protobuf::Message {
+ public:
+  LearnedMessage();
+  virtual ~LearnedMessage();
+  
+  LearnedMessage(const LearnedMessage& from);
+  
+  inline LearnedMessage& operator=(const LearnedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LearnedMessage& default_instance();
+  
+  void Swap(LearnedMessage* other);
+  
+  // implements Message ----------------------------------------------
+  
+  LearnedMessage* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const LearnedMessage& from);
+  void MergeFrom(const LearnedMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // required .mesos.internal.log.Action action = 1;
+  inline bool has_action() const;
+  inline void clear_action();
+  static const int kActionFieldNumber = 1;
+  inline const ::mesos::internal::log::Action& action() const;
+  inline ::mesos::internal::log::Action* mutable_action();
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.log.LearnedMessage)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable int _cached_size_;
+  
+  ::mesos::internal::log::Action* action_;
+  friend void  protobuf_AddDesc_log_2eproto();
+  friend void protobuf_AssignDesc_log_2eproto();
+  friend void protobuf_ShutdownFile_log_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static LearnedMessage* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CatchupRequest : public ::google::protobuf::Message {
+ public:
+  CatchupRequest();
+  virtual ~CatchupRequest();
+  
+  CatchupRequest(const CatchupRequest& from);
+  
+  inline CatchupRequest& operator=(const CatchupRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CatchupRequest& default_instance();
+  
+  void Swap(CatchupRequest* other);
+  
+  // implements Message ----------------------------------------------
+  
+  CatchupRequest* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CatchupRequest& from);
+  void MergeFrom(const CatchupRequest& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // required uint64 id = 1;
+  inline bool has_id() const;
+  inline void clear_id();
+  static const int kIdFieldNumber = 1;
+  inline ::google::protobuf::uint64 id() const;
+  inline void set_id(::google::protobuf::uint64 value);
+  
+  // required uint64 from = 2;
+  inline bool has_from() const;
+  inline void clear_from();
+  static const int kFromFieldNumber = 2;
+  inline ::google::protobuf::uint64 from() const;
+  inline void set_from(::google::protobuf::uint64 value);
+  
+  // required uint64 to = 3;
+  inline bool has_to() const;
+  inline void clear_to();
+  static const int kToFieldNumber = 3;
+  inline ::google::protobuf::uint64 to() const;
+  inline void set_to(::google::protobuf::uint64 value);
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.log.CatchupRequest)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable int _cached_size_;
+  
+  ::google::protobuf::uint64 id_;
+  ::google::protobuf::uint64 from_;
+  ::google::protobuf::uint64 to_;
+  friend void  protobuf_AddDesc_log_2eproto();
+  friend void protobuf_AssignDesc_log_2eproto();
+  friend void protobuf_ShutdownFile_log_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static CatchupRequest* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CatchupResponse : public ::google::protobuf::Message {
+ public:
+  CatchupResponse();
+  virtual ~CatchupResponse();
+  
+  CatchupResponse(const CatchupResponse& from);
+  
+  inline CatchupResponse& operator=(const CatchupResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CatchupResponse& default_instance();
+  
+  void Swap(CatchupResponse* other);
+  
+  // implements Message ----------------------------------------------
+  
+  CatchupResponse* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CatchupResponse& from);
+  void MergeFrom(const CatchupResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // required uint64 id = 1;
+  inline bool has_id() const;
+  inline void clear_id();
+  static const int kIdFieldNumber = 1;
+  inline ::google::protobuf::uint64 id() const;
+  inline void set_id(::google::protobuf::uint64 value);
+  
+  // repeated .mesos.internal.log.Action actions = 2;
+  inline int actions_size() const;
+  inline void clear_actions();
+  static const int kActionsFieldNumber = 2;
+  inline const ::mesos::internal::log::Action& actions(int index) const;
+  inline ::mesos::internal::log::Action* mutable_actions(int index);
+  inline ::mesos::internal::log::Action* add_actions();
+  inline const ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Action >&
+      actions() const;
+  inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Action >*
+      mutable_actions();
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.log.CatchupResponse)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable int _cached_size_;
+  
+  ::google::protobuf::uint64 id_;
+  ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Action > actions_;
+  friend void  protobuf_AddDesc_log_2eproto();
+  friend void protobuf_AssignDesc_log_2eproto();
+  friend void protobuf_ShutdownFile_log_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static CatchupResponse* default_instance_;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+// Promise
+
+// required uint64 id = 1;
+inline bool Promise::has_id() const {
+  return _has_bit(0);
+}
+inline void Promise::clear_id() {
   id_ = GOOGLE_ULONGLONG(0);
   _clear_bit(0);
 }
@@ -1754,6 +2432,144 @@ inline ::mesos::internal::log::Action_Truncate* Action::mutable_truncate() {
 
 // -------------------------------------------------------------------
 
+// Checkpoint_Range
+
+// required uint64 from = 1;
+inline bool Checkpoint_Range::has_from() const {
+  return _has_bit(0);
+}
+inline void Checkpoint_Range::clear_from() {
+  from_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(0);
+}
+inline ::google::protobuf::uint64 Checkpoint_Range::from() const {
+  return from_;
+}
+inline void Checkpoint_Range::set_from(::google::protobuf::uint64 value) {
+  _set_bit(0);
+  from_ = value;
+}
+
+// required uint64 to = 2;
+inline bool Checkpoint_Range::has_to() const {
+  return _has_bit(1);
+}
+inline void Checkpoint_Range::clear_to() {
+  to_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(1);
+}
+inline ::google::protobuf::uint64 Checkpoint_Range::to() const {
+  return to_;
+}
+inline void Checkpoint_Range::set_to(::google::protobuf::uint64 value) {
+  _set_bit(1);
+  to_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// Checkpoint
+
+// required uint64 coordinator = 1;
+inline bool Checkpoint::has_coordinator() const {
+  return _has_bit(0);
+}
+inline void Checkpoint::clear_coordinator() {
+  coordinator_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(0);
+}
+inline ::google::protobuf::uint64 Checkpoint::coordinator() const {
+  return coordinator_;
+}
+inline void Checkpoint::set_coordinator(::google::protobuf::uint64 value) {
+  _set_bit(0);
+  coordinator_ = value;
+}
+
+// required uint64 begin = 2;
+inline bool Checkpoint::has_begin() const {
+  return _has_bit(1);
+}
+inline void Checkpoint::clear_begin() {
+  begin_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(1);
+}
+inline ::google::protobuf::uint64 Checkpoint::begin() const {
+  return begin_;
+}
+inline void Checkpoint::set_begin(::google::protobuf::uint64 value) {
+  _set_bit(1);
+  begin_ = value;
+}
+
+// required uint64 end = 3;
+inline bool Checkpoint::has_end() const {
+  return _has_bit(2);
+}
+inline void Checkpoint::clear_end() {
+  end_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(2);
+}
+inline ::google::protobuf::uint64 Checkpoint::end() const {
+  return end_;
+}
+inline void Checkpoint::set_end(::google::protobuf::uint64 value) {
+  _set_bit(2);
+  end_ = value;
+}
+
+// repeated .mesos.internal.log.Checkpoint.Range holes = 4;
+inline int Checkpoint::holes_size() const {
+  return holes_.size();
+}
+inline void Checkpoint::clear_holes() {
+  holes_.Clear();
+}
+inline const ::mesos::internal::log::Checkpoint_Range& Checkpoint::holes(int index) const {
+  return holes_.Get(index);
+}
+inline ::mesos::internal::log::Checkpoint_Range* Checkpoint::mutable_holes(int index) {
+  return holes_.Mutable(index);
+}
+inline ::mesos::internal::log::Checkpoint_Range* Checkpoint::add_holes() {
+  return holes_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Checkpoint_Range >&
+Checkpoint::holes() const {
+  return holes_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Checkpoint_Range >*
+Checkpoint::mutable_holes() {
+  return &holes_;
+}
+
+// repeated .mesos.internal.log.Checkpoint.Range unlearned = 5;
+inline int Checkpoint::unlearned_size() const {
+  return unlearned_.size();
+}
+inline void Checkpoint::clear_unlearned() {
+  unlearned_.Clear();
+}
+inline const ::mesos::internal::log::Checkpoint_Range& Checkpoint::unlearned(int index) const {
+  return unlearned_.Get(index);
+}
+inline ::mesos::internal::log::Checkpoint_Range* Checkpoint::mutable_unlearned(int index) {
+  return unlearned_.Mutable(index);
+}
+inline ::mesos::internal::log::Checkpoint_Range* Checkpoint::add_unlearned() {
+  return unlearned_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Checkpoint_Range >&
+Checkpoint::unlearned() const {
+  return unlearned_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Checkpoint_Range >*
+Checkpoint::mutable_unlearned() {
+  return &unlearned_;
+}
+
+// -------------------------------------------------------------------
+
 // Record
 
 // required .mesos.internal.log.Record.Type type = 1;
@@ -1807,6 +2623,23 @@ inline ::mesos::internal::log::Action* Record::mutable_action() {
   return action_;
 }
 
+// optional .mesos.internal.log.Checkpoint checkpoint = 4;
+inline bool Record::has_checkpoint() const {
+  return _has_bit(3);
+}
+inline void Record::clear_checkpoint() {
+  if (checkpoint_ != NULL) checkpoint_->::mesos::internal::log::Checkpoint::Clear();
+  _clear_bit(3);
+}
+inline const ::mesos::internal::log::Checkpoint& Record::checkpoint() const {
+  return checkpoint_ != NULL ? *checkpoint_ : *default_instance_->checkpoint_;
+}
+inline ::mesos::internal::log::Checkpoint* Record::mutable_checkpoint() {
+  _set_bit(3);
+  if (checkpoint_ == NULL) checkpoint_ = new ::mesos::internal::log::Checkpoint;
+  return checkpoint_;
+}
+
 // -------------------------------------------------------------------
 
 // PromiseRequest
@@ -2086,6 +2919,137 @@ inline void WriteResponse::set_position(::google::protobuf::uint64 value) {
 
 // -------------------------------------------------------------------
 
+// BatchWriteRequest
+
+// required uint64 id = 1;
+inline bool BatchWriteRequest::has_id() const {
+  return _has_bit(0);
+}
+inline void BatchWriteRequest::clear_id() {
+  id_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(0);
+}
+inline ::google::protobuf::uint64 BatchWriteRequest::id() const {
+  return id_;
+}
+inline void BatchWriteRequest::set_id(::google::protobuf::uint64 value) {
+  _set_bit(0);
+  id_ = value;
+}
+
+// repeated .mesos.internal.log.WriteRequest writes = 2;
+inline int BatchWriteRequest::writes_size() const {
+  return writes_.size();
+}
+inline void BatchWriteRequest::clear_writes() {
+  writes_.Clear();
+}
+inline const ::mesos::internal::log::WriteRequest& BatchWriteRequest::writes(int index) const {
+  return writes_.Get(index);
+}
+inline ::mesos::internal::log::WriteRequest* BatchWriteRequest::mutable_writes(int index) {
+  return writes_.Mutable(index);
+}
+inline ::mesos::internal::log::WriteRequest* BatchWriteRequest::add_writes() {
+  return writes_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::WriteRequest >&
+BatchWriteRequest::writes() const {
+  return writes_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::WriteRequest >*
+BatchWriteRequest::mutable_writes() {
+  return &writes_;
+}
+
+// repeated uint64 learned = 3;
+inline int BatchWriteRequest::learned_size() const {
+  return learned_.size();
+}
+inline void BatchWriteRequest::clear_learned() {
+  learned_.Clear();
+}
+inline ::google::protobuf::uint64 BatchWriteRequest::learned(int index) const {
+  return learned_.Get(index);
+}
+inline void BatchWriteRequest::set_learned(int index, ::google::protobuf::uint64 value) {
+  learned_.Set(index, value);
+}
+inline void BatchWriteRequest::add_learned(::google::protobuf::uint64 value) {
+  learned_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+BatchWriteRequest::learned() const {
+  return learned_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+BatchWriteRequest::mutable_learned() {
+  return &learned_;
+}
+
+// -------------------------------------------------------------------
+
+// BatchWriteResponse
+
+// required bool okay = 1;
+inline bool BatchWriteResponse::has_okay() const {
+  return _has_bit(0);
+}
+inline void BatchWriteResponse::clear_okay() {
+  okay_ = false;
+  _clear_bit(0);
+}
+inline bool BatchWriteResponse::okay() const {
+  return okay_;
+}
+inline void BatchWriteResponse::set_okay(bool value) {
+  _set_bit(0);
+  okay_ = value;
+}
+
+// required uint64 id = 2;
+inline bool BatchWriteResponse::has_id() const {
+  return _has_bit(1);
+}
+inline void BatchWriteResponse::clear_id() {
+  id_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(1);
+}
+inline ::google::protobuf::uint64 BatchWriteResponse::id() const {
+  return id_;
+}
+inline void BatchWriteResponse::set_id(::google::protobuf::uint64 value) {
+  _set_bit(1);
+  id_ = value;
+}
+
+// repeated uint64 positions = 3;
+inline int BatchWriteResponse::positions_size() const {
+  return positions_.size();
+}
+inline void BatchWriteResponse::clear_positions() {
+  positions_.Clear();
+}
+inline ::google::protobuf::uint64 BatchWriteResponse::positions(int index) const {
+  return positions_.Get(index);
+}
+inline void BatchWriteResponse::set_positions(int index, ::google::protobuf::uint64 value) {
+  positions_.Set(index, value);
+}
+inline void BatchWriteResponse::add_positions(::google::protobuf::uint64 value) {
+  positions_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+BatchWriteResponse::positions() const {
+  return positions_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+BatchWriteResponse::mutable_positions() {
+  return &positions_;
+}
+
+// -------------------------------------------------------------------
+
 // LearnRequest
 
 // required uint64 position = 1;
@@ -2162,6 +3126,103 @@ inline ::mesos::internal::log::Action* LearnedMessage::mutable_action() {
   return action_;
 }
 
+// -------------------------------------------------------------------
+
+// CatchupRequest
+
+// required uint64 id = 1;
+inline bool CatchupRequest::has_id() const {
+  return _has_bit(0);
+}
+inline void CatchupRequest::clear_id() {
+  id_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(0);
+}
+inline ::google::protobuf::uint64 CatchupRequest::id() const {
+  return id_;
+}
+inline void CatchupRequest::set_id(::google::protobuf::uint64 value) {
+  _set_bit(0);
+  id_ = value;
+}
+
+// required uint64 from = 2;
+inline bool CatchupRequest::has_from() const {
+  return _has_bit(1);
+}
+inline void CatchupRequest::clear_from() {
+  from_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(1);
+}
+inline ::google::protobuf::uint64 CatchupRequest::from() const {
+  return from_;
+}
+inline void CatchupRequest::set_from(::google::protobuf::uint64 value) {
+  _set_bit(1);
+  from_ = value;
+}
+
+// required uint64 to = 3;
+inline bool CatchupRequest::has_to() const {
+  return _has_bit(2);
+}
+inline void CatchupRequest::clear_to() {
+  to_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(2);
+}
+inline ::google::protobuf::uint64 CatchupRequest::to() const {
+  return to_;
+}
+inline void CatchupRequest::set_to(::google::protobuf::uint64 value) {
+  _set_bit(2);
+  to_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// CatchupResponse
+
+// required uint64 id = 1;
+inline bool CatchupResponse::has_id() const {
+  return _has_bit(0);
+}
+inline void CatchupResponse::clear_id() {
+  id_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(0);
+}
+inline ::google::protobuf::uint64 CatchupResponse::id() const {
+  return id_;
+}
+inline void CatchupResponse::set_id(::google::protobuf::uint64 value) {
+  _set_bit(0);
+  id_ = value;
+}
+
+// repeated .mesos.internal.log.Action actions = 2;
+inline int CatchupResponse::actions_size() const {
+  return actions_.size();
+}
+inline void CatchupResponse::clear_actions() {
+  actions_.Clear();
+}
+inline const ::mesos::internal::log::Action& CatchupResponse::actions(int index) const {
+  return actions_.Get(index);
+}
+inline ::mesos::internal::log::Action* CatchupResponse::mutable_actions(int index) {
+  return actions_.Mutable(index);
+}
+inline ::mesos::internal::log::Action* CatchupResponse::add_actions() {
+  return actions_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Action >&
+CatchupResponse::actions() const {
+  return actions_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::log::Action >*
+CatchupResponse::mutable_actions() {
+  return &actions_;
+}
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -69,6 +69,9 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* RunTaskMessage_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   RunTaskMessage_reflection_ = NULL;
+const ::google::protobuf::Descriptor* RunTasksMessage_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  RunTasksMessage_reflection_ = NULL;
 const ::google::protobuf::Descriptor* KillTaskMessage_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   KillTaskMessage_reflection_ = NULL;
@@ -78,6 +81,12 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* StatusUpdateAcknowledgementMessage_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   StatusUpdateAcknowledgementMessage_reflection_ = NULL;
+const ::google::protobuf::Descriptor* StatusUpdatesMessage_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  StatusUpdatesMessage_reflection_ = NULL;
+const ::google::protobuf::Descriptor* StatusUpdateAcknowledgementsMessage_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  StatusUpdateAcknowledgementsMessage_reflection_ = NULL;
 const ::google::protobuf::Descriptor* LostSlaveMessage_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   LostSlaveMessage_reflection_ = NULL;
@@ -262,8 +271,9 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FrameworkToExecutorMessage));
   RegisterFrameworkMessage_descriptor_ = file->message_type(6);
-  static const int RegisterFrameworkMessage_offsets_[1] = {
+  static const int RegisterFrameworkMessage_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RegisterFrameworkMessage, framework_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RegisterFrameworkMessage, supports_batched_status_updates_),
   };
   RegisterFrameworkMessage_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -277,10 +287,11 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(RegisterFrameworkMessage));
   ReregisterFrameworkMessage_descriptor_ = file->message_type(7);
-  static const int ReregisterFrameworkMessage_offsets_[3] = {
+  static const int ReregisterFrameworkMessage_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReregisterFrameworkMessage, framework_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReregisterFrameworkMessage, framework_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReregisterFrameworkMessage, failover_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReregisterFrameworkMessage, supports_batched_status_updates_),
   };
   ReregisterFrameworkMessage_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -451,7 +462,25 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(RunTaskMessage));
-  KillTaskMessage_descriptor_ = file->message_type(18);
+  RunTasksMessage_descriptor_ = file->message_type(18);
+  static const int RunTasksMessage_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RunTasksMessage, framework_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RunTasksMessage, framework_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RunTasksMessage, pid_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RunTasksMessage, tasks_),
+  };
+  RunTasksMessage_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      RunTasksMessage_descriptor_,
+      RunTasksMessage::default_instance_,
+      RunTasksMessage_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RunTasksMessage, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RunTasksMessage, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(RunTasksMessage));
+  KillTaskMessage_descriptor_ = file->message_type(19);
   static const int KillTaskMessage_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KillTaskMessage, framework_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KillTaskMessage, task_id_),
@@ -467,7 +496,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(KillTaskMessage));
-  StatusUpdateMessage_descriptor_ = file->message_type(19);
+  StatusUpdateMessage_descriptor_ = file->message_type(20);
   static const int StatusUpdateMessage_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdateMessage, update_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdateMessage, pid_),
@@ -483,7 +512,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(StatusUpdateMessage));
-  StatusUpdateAcknowledgementMessage_descriptor_ = file->message_type(20);
+  StatusUpdateAcknowledgementMessage_descriptor_ = file->message_type(21);
   static const int StatusUpdateAcknowledgementMessage_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdateAcknowledgementMessage, slave_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdateAcknowledgementMessage, framework_id_),
@@ -501,7 +530,41 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(StatusUpdateAcknowledgementMessage));
-  LostSlaveMessage_descriptor_ = file->message_type(21);
+  StatusUpdatesMessage_descriptor_ = file->message_type(22);
+  static const int StatusUpdatesMessage_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdatesMessage, updates_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdatesMessage, pids_),
+  };
+  StatusUpdatesMessage_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      StatusUpdatesMessage_descriptor_,
+      StatusUpdatesMessage::default_instance_,
+      StatusUpdatesMessage_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdatesMessage, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdatesMessage, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(StatusUpdatesMessage));
+  StatusUpdateAcknowledgementsMessage_descriptor_ = file->message_type(23);
+  static const int StatusUpdateAcknowledgementsMessage_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdateAcknowledgementsMessage, slave_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdateAcknowledgementsMessage, framework_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdateAcknowledgementsMessage, task_ids_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdateAcknowledgementsMessage, uuids_),
+  };
+  StatusUpdateAcknowledgementsMessage_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      StatusUpdateAcknowledgementsMessage_descriptor_,
+      StatusUpdateAcknowledgementsMessage::default_instance_,
+      StatusUpdateAcknowledgementsMessage_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdateAcknowledgementsMessage, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusUpdateAcknowledgementsMessage, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(StatusUpdateAcknowledgementsMessage));
+  LostSlaveMessage_descriptor_ = file->message_type(24);
   static const int LostSlaveMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LostSlaveMessage, slave_id_),
   };
@@ -516,7 +579,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(LostSlaveMessage));
-  FrameworkErrorMessage_descriptor_ = file->message_type(22);
+  FrameworkErrorMessage_descriptor_ = file->message_type(25);
   static const int FrameworkErrorMessage_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrameworkErrorMessage, code_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrameworkErrorMessage, message_),
@@ -532,9 +595,11 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FrameworkErrorMessage));
-  RegisterSlaveMessage_descriptor_ = file->message_type(23);
-  static const int RegisterSlaveMessage_offsets_[1] = {
+  RegisterSlaveMessage_descriptor_ = file->message_type(26);
+  static const int RegisterSlaveMessage_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RegisterSlaveMessage, slave_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RegisterSlaveMessage, supports_run_tasks_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RegisterSlaveMessage, supports_status_update_acknowledgements_),
   };
   RegisterSlaveMessage_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -547,12 +612,14 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(RegisterSlaveMessage));
-  ReregisterSlaveMessage_descriptor_ = file->message_type(24);
-  static const int ReregisterSlaveMessage_offsets_[4] = {
+  ReregisterSlaveMessage_descriptor_ = file->message_type(27);
+  static const int ReregisterSlaveMessage_offsets_[6] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReregisterSlaveMessage, slave_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReregisterSlaveMessage, slave_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReregisterSlaveMessage, executor_infos_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReregisterSlaveMessage, tasks_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReregisterSlaveMessage, supports_run_tasks_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReregisterSlaveMessage, supports_status_update_acknowledgements_),
   };
   ReregisterSlaveMessage_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -565,7 +632,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ReregisterSlaveMessage));
-  SlaveRegisteredMessage_descriptor_ = file->message_type(25);
+  SlaveRegisteredMessage_descriptor_ = file->message_type(28);
   static const int SlaveRegisteredMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SlaveRegisteredMessage, slave_id_),
   };
@@ -580,7 +647,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SlaveRegisteredMessage));
-  SlaveReregisteredMessage_descriptor_ = file->message_type(26);
+  SlaveReregisteredMessage_descriptor_ = file->message_type(29);
   static const int SlaveReregisteredMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SlaveReregisteredMessage, slave_id_),
   };
@@ -595,7 +662,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SlaveReregisteredMessage));
-  UnregisterSlaveMessage_descriptor_ = file->message_type(27);
+  UnregisterSlaveMessage_descriptor_ = file->message_type(30);
   static const int UnregisterSlaveMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UnregisterSlaveMessage, slave_id_),
   };
@@ -610,7 +677,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(UnregisterSlaveMessage));
-  HeartbeatMessage_descriptor_ = file->message_type(28);
+  HeartbeatMessage_descriptor_ = file->message_type(31);
   static const int HeartbeatMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HeartbeatMessage, slave_id_),
   };
@@ -625,7 +692,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(HeartbeatMessage));
-  ShutdownFrameworkMessage_descriptor_ = file->message_type(29);
+  ShutdownFrameworkMessage_descriptor_ = file->message_type(32);
   static const int ShutdownFrameworkMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ShutdownFrameworkMessage, framework_id_),
   };
@@ -640,7 +707,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ShutdownFrameworkMessage));
-  ShutdownExecutorMessage_descriptor_ = file->message_type(30);
+  ShutdownExecutorMessage_descriptor_ = file->message_type(33);
   static const int ShutdownExecutorMessage_offsets_[1] = {
   };
   ShutdownExecutorMessage_reflection_ =
@@ -654,7 +721,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ShutdownExecutorMessage));
-  UpdateFrameworkMessage_descriptor_ = file->message_type(31);
+  UpdateFrameworkMessage_descriptor_ = file->message_type(34);
   static const int UpdateFrameworkMessage_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UpdateFrameworkMessage, framework_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UpdateFrameworkMessage, pid_),
@@ -670,7 +737,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(UpdateFrameworkMessage));
-  RegisterExecutorMessage_descriptor_ = file->message_type(32);
+  RegisterExecutorMessage_descriptor_ = file->message_type(35);
   static const int RegisterExecutorMessage_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RegisterExecutorMessage, framework_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RegisterExecutorMessage, executor_id_),
@@ -686,7 +753,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(RegisterExecutorMessage));
-  ExecutorRegisteredMessage_descriptor_ = file->message_type(33);
+  ExecutorRegisteredMessage_descriptor_ = file->message_type(36);
   static const int ExecutorRegisteredMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutorRegisteredMessage, args_),
   };
@@ -701,7 +768,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ExecutorRegisteredMessage));
-  ExitedExecutorMessage_descriptor_ = file->message_type(34);
+  ExitedExecutorMessage_descriptor_ = file->message_type(37);
   static const int ExitedExecutorMessage_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExitedExecutorMessage, slave_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExitedExecutorMessage, framework_id_),
@@ -719,7 +786,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ExitedExecutorMessage));
-  RegisterProjdMessage_descriptor_ = file->message_type(35);
+  RegisterProjdMessage_descriptor_ = file->message_type(38);
   static const int RegisterProjdMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RegisterProjdMessage, project_),
   };
@@ -734,7 +801,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(RegisterProjdMessage));
-  ProjdReadyMessage_descriptor_ = file->message_type(36);
+  ProjdReadyMessage_descriptor_ = file->message_type(39);
   static const int ProjdReadyMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProjdReadyMessage, project_),
   };
@@ -749,7 +816,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ProjdReadyMessage));
-  ProjdUpdateResourcesMessage_descriptor_ = file->message_type(37);
+  ProjdUpdateResourcesMessage_descriptor_ = file->message_type(40);
   static const int ProjdUpdateResourcesMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProjdUpdateResourcesMessage, params_),
   };
@@ -764,7 +831,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ProjdUpdateResourcesMessage));
-  FrameworkExpiredMessage_descriptor_ = file->message_type(38);
+  FrameworkExpiredMessage_descriptor_ = file->message_type(41);
   static const int FrameworkExpiredMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrameworkExpiredMessage, framework_id_),
   };
@@ -779,7 +846,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FrameworkExpiredMessage));
-  ShutdownMessage_descriptor_ = file->message_type(39);
+  ShutdownMessage_descriptor_ = file->message_type(42);
   static const int ShutdownMessage_offsets_[1] = {
   };
   ShutdownMessage_reflection_ =
@@ -793,7 +860,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ShutdownMessage));
-  NoMasterDetectedMessage_descriptor_ = file->message_type(40);
+  NoMasterDetectedMessage_descriptor_ = file->message_type(43);
   static const int NoMasterDetectedMessage_offsets_[1] = {
   };
   NoMasterDetectedMessage_reflection_ =
@@ -807,7 +874,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(NoMasterDetectedMessage));
-  NewMasterDetectedMessage_descriptor_ = file->message_type(41);
+  NewMasterDetectedMessage_descriptor_ = file->message_type(44);
   static const int NewMasterDetectedMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NewMasterDetectedMessage, pid_),
   };
@@ -822,7 +889,7 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(NewMasterDetectedMessage));
-  GotMasterTokenMessage_descriptor_ = file->message_type(42);
+  GotMasterTokenMessage_descriptor_ = file->message_type(45);
   static const int GotMasterTokenMessage_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GotMasterTokenMessage, token_),
   };
@@ -885,12 +952,18 @@ void protobuf_RegisterTypes(const ::std::string&) {
     ReviveOffersMessage_descriptor_, &ReviveOffersMessage::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     RunTaskMessage_descriptor_, &RunTaskMessage::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    RunTasksMessage_descriptor_, &RunTasksMessage::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     KillTaskMessage_descriptor_, &KillTaskMessage::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     StatusUpdateMessage_descriptor_, &StatusUpdateMessage::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     StatusUpdateAcknowledgementMessage_descriptor_, &StatusUpdateAcknowledgementMessage::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    StatusUpdatesMessage_descriptor_, &StatusUpdatesMessage::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    StatusUpdateAcknowledgementsMessage_descriptor_, &StatusUpdateAcknowledgementsMessage::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     LostSlaveMessage_descriptor_, &LostSlaveMessage::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -976,12 +1049,18 @@ void protobuf_ShutdownFile_messages_2eproto() {
   delete ReviveOffersMessage_reflection_;
   delete RunTaskMessage::default_instance_;
   delete RunTaskMessage_reflection_;
+  delete RunTasksMessage::default_instance_;
+  delete RunTasksMessage_reflection_;
   delete KillTaskMessage::default_instance_;
   delete KillTaskMessage_reflection_;
   delete StatusUpdateMessage::default_instance_;
   delete StatusUpdateMessage_reflection_;
   delete StatusUpdateAcknowledgementMessage::default_instance_;
   delete StatusUpdateAcknowledgementMessage_reflection_;
+  delete StatusUpdatesMessage::default_instance_;
+  delete StatusUpdatesMessage_reflection_;
+  delete StatusUpdateAcknowledgementsMessage::default_instance_;
+  delete StatusUpdateAcknowledgementsMessage_reflection_;
   delete LostSlaveMessage::default_instance_;
   delete LostSlaveMessage_reflection_;
   delete FrameworkErrorMessage::default_instance_;
@@ -1058,79 +1137,96 @@ void protobuf_AddDesc_messages_2eproto() {
     " \n\010slave_id\030\001 \002(\0132\016.mesos.SlaveID\022(\n\014fra"
     "mework_id\030\002 \002(\0132\022.mesos.FrameworkID\022&\n\013e"
     "xecutor_id\030\003 \002(\0132\021.mesos.ExecutorID\022\014\n\004d"
-    "ata\030\004 \002(\014\"C\n\030RegisterFrameworkMessage\022\'\n"
-    "\tframework\030\001 \002(\0132\024.mesos.FrameworkInfo\"\201"
-    "\001\n\032ReregisterFrameworkMessage\022(\n\014framewo"
-    "rk_id\030\001 \002(\0132\022.mesos.FrameworkID\022\'\n\tframe"
-    "work\030\002 \002(\0132\024.mesos.FrameworkInfo\022\020\n\010fail"
-    "over\030\003 \002(\010\"F\n\032FrameworkRegisteredMessage"
-    "\022(\n\014framework_id\030\001 \002(\0132\022.mesos.Framework"
-    "ID\"H\n\034FrameworkReregisteredMessage\022(\n\014fr"
-    "amework_id\030\001 \002(\0132\022.mesos.FrameworkID\"F\n\032"
-    "UnregisterFrameworkMessage\022(\n\014framework_"
-    "id\030\001 \002(\0132\022.mesos.FrameworkID\"F\n\032Deactiva"
-    "teFrameworkMessage\022(\n\014framework_id\030\001 \002(\013"
-    "2\022.mesos.FrameworkID\"l\n\026ResourceRequestM"
-    "essage\022(\n\014framework_id\030\001 \002(\0132\022.mesos.Fra"
-    "meworkID\022(\n\010requests\030\002 \003(\0132\026.mesos.Resou"
-    "rceRequest\"C\n\025ResourceOffersMessage\022\034\n\006o"
-    "ffers\030\001 \003(\0132\014.mesos.Offer\022\014\n\004pids\030\002 \003(\t\""
-    "\250\001\n\022LaunchTasksMessage\022(\n\014framework_id\030\001"
-    " \002(\0132\022.mesos.FrameworkID\022 \n\010offer_id\030\002 \002"
-    "(\0132\016.mesos.OfferID\022%\n\005tasks\030\003 \003(\0132\026.meso"
-    "s.TaskDescription\022\037\n\007filters\030\005 \002(\0132\016.mes"
-    "os.Filters\"?\n\033RescindResourceOfferMessag"
-    "e\022 \n\010offer_id\030\001 \002(\0132\016.mesos.OfferID\"?\n\023R"
-    "eviveOffersMessage\022(\n\014framework_id\030\001 \002(\013"
-    "2\022.mesos.FrameworkID\"\226\001\n\016RunTaskMessage\022"
+    "ata\030\004 \002(\014\"s\n\030RegisterFrameworkMessage\022\'\n"
+    "\tframework\030\001 \002(\0132\024.mesos.FrameworkInfo\022."
+    "\n\037supports_batched_status_updates\030\002 \001(\010:"
+    "\005false\"\261\001\n\032ReregisterFrameworkMessage\022(\n"
+    "\014framework_id\030\001 \002(\0132\022.mesos.FrameworkID\022"
+    "\'\n\tframework\030\002 \002(\0132\024.mesos.FrameworkInfo"
+    "\022\020\n\010failover\030\003 \002(\010\022.\n\037supports_batched_s"
+    "tatus_updates\030\004 \001(\010:\005false\"F\n\032FrameworkR"
+    "egisteredMessage\022(\n\014framework_id\030\001 \002(\0132\022"
+    ".mesos.FrameworkID\"H\n\034FrameworkReregiste"
+    "redMessage\022(\n\014framework_id\030\001 \002(\0132\022.mesos"
+    ".FrameworkID\"F\n\032UnregisterFrameworkMessa"
+    "ge\022(\n\014framework_id\030\001 \002(\0132\022.mesos.Framewo"
+    "rkID\"F\n\032DeactivateFrameworkMessage\022(\n\014fr"
+    "amework_id\030\001 \002(\0132\022.mesos.FrameworkID\"l\n\026"
+    "ResourceRequestMessage\022(\n\014framework_id\030\001"
+    " \002(\0132\022.mesos.FrameworkID\022(\n\010requests\030\002 \003"
+    "(\0132\026.mesos.ResourceRequest\"C\n\025ResourceOf"
+    "fersMessage\022\034\n\006offers\030\001 \003(\0132\014.mesos.Offe"
+    "r\022\014\n\004pids\030\002 \003(\t\"\250\001\n\022LaunchTasksMessage\022("
+    "\n\014framework_id\030\001 \002(\0132\022.mesos.FrameworkID"
+    "\022 \n\010offer_id\030\002 \002(\0132\016.mesos.OfferID\022%\n\005ta"
+    "sks\030\003 \003(\0132\026.mesos.TaskDescription\022\037\n\007fil"
+    "ters\030\005 \002(\0132\016.mesos.Filters\"?\n\033RescindRes"
+    "ourceOfferMessage\022 \n\010offer_id\030\001 \002(\0132\016.me"
+    "sos.OfferID\"?\n\023ReviveOffersMessage\022(\n\014fr"
+    "amework_id\030\001 \002(\0132\022.mesos.FrameworkID\"\226\001\n"
+    "\016RunTaskMessage\022(\n\014framework_id\030\001 \002(\0132\022."
+    "mesos.FrameworkID\022\'\n\tframework\030\002 \002(\0132\024.m"
+    "esos.FrameworkInfo\022\013\n\003pid\030\003 \002(\t\022$\n\004task\030"
+    "\004 \002(\0132\026.mesos.TaskDescription\"\230\001\n\017RunTas"
+    "ksMessage\022(\n\014framework_id\030\001 \002(\0132\022.mesos."
+    "FrameworkID\022\'\n\tframework\030\002 \002(\0132\024.mesos.F"
+    "rameworkInfo\022\013\n\003pid\030\003 \002(\t\022%\n\005tasks\030\004 \003(\013"
+    "2\026.mesos.TaskDescription\"[\n\017KillTaskMess"
+    "age\022(\n\014framework_id\030\001 \002(\0132\022.mesos.Framew"
+    "orkID\022\036\n\007task_id\030\002 \002(\0132\r.mesos.TaskID\"P\n"
+    "\023StatusUpdateMessage\022,\n\006update\030\001 \002(\0132\034.m"
+    "esos.internal.StatusUpdate\022\013\n\003pid\030\002 \001(\t\""
+    "\236\001\n\"StatusUpdateAcknowledgementMessage\022 "
+    "\n\010slave_id\030\001 \002(\0132\016.mesos.SlaveID\022(\n\014fram"
+    "ework_id\030\002 \002(\0132\022.mesos.FrameworkID\022\036\n\007ta"
+    "sk_id\030\003 \002(\0132\r.mesos.TaskID\022\014\n\004uuid\030\004 \002(\014"
+    "\"S\n\024StatusUpdatesMessage\022-\n\007updates\030\001 \003("
+    "\0132\034.mesos.internal.StatusUpdate\022\014\n\004pids\030"
+    "\002 \003(\t\"\241\001\n#StatusUpdateAcknowledgementsMe"
+    "ssage\022 \n\010slave_id\030\001 \002(\0132\016.mesos.SlaveID\022"
+    "(\n\014framework_id\030\002 \002(\0132\022.mesos.FrameworkI"
+    "D\022\037\n\010task_ids\030\003 \003(\0132\r.mesos.TaskID\022\r\n\005uu"
+    "ids\030\004 \003(\014\"4\n\020LostSlaveMessage\022 \n\010slave_i"
+    "d\030\001 \002(\0132\016.mesos.SlaveID\"6\n\025FrameworkErro"
+    "rMessage\022\014\n\004code\030\001 \002(\005\022\017\n\007message\030\002 \002(\t\""
+    "\222\001\n\024RegisterSlaveMessage\022\037\n\005slave\030\001 \002(\0132"
+    "\020.mesos.SlaveInfo\022!\n\022supports_run_tasks\030"
+    "\002 \001(\010:\005false\0226\n\'supports_status_update_a"
+    "cknowledgements\030\003 \001(\010:\005false\"\210\002\n\026Reregis"
+    "terSlaveMessage\022 \n\010slave_id\030\001 \002(\0132\016.meso"
+    "s.SlaveID\022\037\n\005slave\030\002 \002(\0132\020.mesos.SlaveIn"
+    "fo\022+\n\016executor_infos\030\004 \003(\0132\023.mesos.Execu"
+    "torInfo\022#\n\005tasks\030\003 \003(\0132\024.mesos.internal."
+    "Task\022!\n\022supports_run_tasks\030\005 \001(\010:\005false\022"
+    "6\n\'supports_status_update_acknowledgemen"
+    "ts\030\006 \001(\010:\005false\":\n\026SlaveRegisteredMessag"
+    "e\022 \n\010slave_id\030\001 \002(\0132\016.mesos.SlaveID\"<\n\030S"
+    "laveReregisteredMessage\022 \n\010slave_id\030\001 \002("
+    "\0132\016.mesos.SlaveID\":\n\026UnregisterSlaveMess"
+    "age\022 \n\010slave_id\030\001 \002(\0132\016.mesos.SlaveID\"4\n"
+    "\020HeartbeatMessage\022 \n\010slave_id\030\001 \002(\0132\016.me"
+    "sos.SlaveID\"D\n\030ShutdownFrameworkMessage\022"
     "(\n\014framework_id\030\001 \002(\0132\022.mesos.FrameworkI"
-    "D\022\'\n\tframework\030\002 \002(\0132\024.mesos.FrameworkIn"
-    "fo\022\013\n\003pid\030\003 \002(\t\022$\n\004task\030\004 \002(\0132\026.mesos.Ta"
-    "skDescription\"[\n\017KillTaskMessage\022(\n\014fram"
-    "ework_id\030\001 \002(\0132\022.mesos.FrameworkID\022\036\n\007ta"
-    "sk_id\030\002 \002(\0132\r.mesos.TaskID\"P\n\023StatusUpda"
-    "teMessage\022,\n\006update\030\001 \002(\0132\034.mesos.intern"
-    "al.StatusUpdate\022\013\n\003pid\030\002 \001(\t\"\236\001\n\"StatusU"
-    "pdateAcknowledgementMessage\022 \n\010slave_id\030"
-    "\001 \002(\0132\016.mesos.SlaveID\022(\n\014framework_id\030\002 "
-    "\002(\0132\022.mesos.FrameworkID\022\036\n\007task_id\030\003 \002(\013"
-    "2\r.mesos.TaskID\022\014\n\004uuid\030\004 \002(\014\"4\n\020LostSla"
-    "veMessage\022 \n\010slave_id\030\001 \002(\0132\016.mesos.Slav"
-    "eID\"6\n\025FrameworkErrorMessage\022\014\n\004code\030\001 \002"
-    "(\005\022\017\n\007message\030\002 \002(\t\"7\n\024RegisterSlaveMess"
-    "age\022\037\n\005slave\030\001 \002(\0132\020.mesos.SlaveInfo\"\255\001\n"
-    "\026ReregisterSlaveMessage\022 \n\010slave_id\030\001 \002("
-    "\0132\016.mesos.SlaveID\022\037\n\005slave\030\002 \002(\0132\020.mesos"
-    ".SlaveInfo\022+\n\016executor_infos\030\004 \003(\0132\023.mes"
-    "os.ExecutorInfo\022#\n\005tasks\030\003 \003(\0132\024.mesos.i"
-    "nternal.Task\":\n\026SlaveRegisteredMessage\022 "
-    "\n\010slave_id\030\001 \002(\0132\016.mesos.SlaveID\"<\n\030Slav"
-    "eReregisteredMessage\022 \n\010slave_id\030\001 \002(\0132\016"
-    ".mesos.SlaveID\":\n\026UnregisterSlaveMessage"
-    "\022 \n\010slave_id\030\001 \002(\0132\016.mesos.SlaveID\"4\n\020He"
-    "artbeatMessage\022 \n\010slave_id\030\001 \002(\0132\016.mesos"
-    ".SlaveID\"D\n\030ShutdownFrameworkMessage\022(\n\014"
-    "framework_id\030\001 \002(\0132\022.mesos.FrameworkID\"\031"
-    "\n\027ShutdownExecutorMessage\"O\n\026UpdateFrame"
-    "workMessage\022(\n\014framework_id\030\001 \002(\0132\022.meso"
-    "s.FrameworkID\022\013\n\003pid\030\002 \002(\t\"k\n\027RegisterEx"
-    "ecutorMessage\022(\n\014framework_id\030\001 \002(\0132\022.me"
-    "sos.FrameworkID\022&\n\013executor_id\030\002 \002(\0132\021.m"
-    "esos.ExecutorID\">\n\031ExecutorRegisteredMes"
-    "sage\022!\n\004args\030\001 \002(\0132\023.mesos.ExecutorArgs\""
-    "\233\001\n\025ExitedExecutorMessage\022 \n\010slave_id\030\001 "
-    "\002(\0132\016.mesos.SlaveID\022(\n\014framework_id\030\002 \002("
-    "\0132\022.mesos.FrameworkID\022&\n\013executor_id\030\003 \002"
-    "(\0132\021.mesos.ExecutorID\022\016\n\006status\030\004 \002(\005\"\'\n"
-    "\024RegisterProjdMessage\022\017\n\007project\030\001 \002(\t\"$"
-    "\n\021ProjdReadyMessage\022\017\n\007project\030\001 \002(\t\"<\n\033"
-    "ProjdUpdateResourcesMessage\022\035\n\006params\030\001 "
-    "\001(\0132\r.mesos.Params\"C\n\027FrameworkExpiredMe"
-    "ssage\022(\n\014framework_id\030\001 \002(\0132\022.mesos.Fram"
-    "eworkID\"\021\n\017ShutdownMessage\"\031\n\027NoMasterDe"
-    "tectedMessage\"\'\n\030NewMasterDetectedMessag"
-    "e\022\013\n\003pid\030\002 \002(\t\"&\n\025GotMasterTokenMessage\022"
-    "\r\n\005token\030\001 \002(\t", 3774);
+    "D\"\031\n\027ShutdownExecutorMessage\"O\n\026UpdateFr"
+    "ameworkMessage\022(\n\014framework_id\030\001 \002(\0132\022.m"
+    "esos.FrameworkID\022\013\n\003pid\030\002 \002(\t\"k\n\027Registe"
+    "rExecutorMessage\022(\n\014framework_id\030\001 \002(\0132\022"
+    ".mesos.FrameworkID\022&\n\013executor_id\030\002 \002(\0132"
+    "\021.mesos.ExecutorID\">\n\031ExecutorRegistered"
+    "Message\022!\n\004args\030\001 \002(\0132\023.mesos.ExecutorAr"
+    "gs\"\233\001\n\025ExitedExecutorMessage\022 \n\010slave_id"
+    "\030\001 \002(\0132\016.mesos.SlaveID\022(\n\014framework_id\030\002"
+    " \002(\0132\022.mesos.FrameworkID\022&\n\013executor_id\030"
+    "\003 \002(\0132\021.mesos.ExecutorID\022\016\n\006status\030\004 \002(\005"
+    "\"\'\n\024RegisterProjdMessage\022\017\n\007project\030\001 \002("
+    "\t\"$\n\021ProjdReadyMessage\022\017\n\007project\030\001 \002(\t\""
+    "<\n\033ProjdUpdateResourcesMessage\022\035\n\006params"
+    "\030\001 \001(\0132\r.mesos.Params\"C\n\027FrameworkExpire"
+    "dMessage\022(\n\014framework_id\030\001 \002(\0132\022.mesos.F"
+    "rameworkID\"\021\n\017ShutdownMessage\"\031\n\027NoMaste"
+    "rDetectedMessage\"\'\n\030NewMasterDetectedMes"
+    "sage\022\013\n\003pid\030\002 \002(\t\"&\n\025GotMasterTokenMessa"
+    "ge\022\r\n\005token\030\001 \002(\t", 4457);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "messages.proto", &protobuf_RegisterTypes);
   Task::default_instance_ = new Task();
@@ -1151,9 +1247,12 @@ void protobuf_AddDesc_messages_2eproto() {
   RescindResourceOfferMessage::default_instance_ = new RescindResourceOfferMessage();
   ReviveOffersMessage::default_instance_ = new ReviveOffersMessage();
   RunTaskMessage::default_instance_ = new RunTaskMessage();
+  RunTasksMessage::default_instance_ = new RunTasksMessage();
   KillTaskMessage::default_instance_ = new KillTaskMessage();
   StatusUpdateMessage::default_instance_ = new StatusUpdateMessage();
   StatusUpdateAcknowledgementMessage::default_instance_ = new StatusUpdateAcknowledgementMessage();
+  StatusUpdatesMessage::default_instance_ = new StatusUpdatesMessage();
+  StatusUpdateAcknowledgementsMessage::default_instance_ = new StatusUpdateAcknowledgementsMessage();
   LostSlaveMessage::default_instance_ = new LostSlaveMessage();
   FrameworkErrorMessage::default_instance_ = new FrameworkErrorMessage();
   RegisterSlaveMessage::default_instance_ = new RegisterSlaveMessage();
@@ -1194,9 +1293,12 @@ void protobuf_AddDesc_messages_2eproto() {
   RescindResourceOfferMessage::default_instance_->InitAsDefaultInstance();
   ReviveOffersMessage::default_instance_->InitAsDefaultInstance();
   RunTaskMessage::default_instance_->InitAsDefaultInstance();
+  RunTasksMessage::default_instance_->InitAsDefaultInstance();
   KillTaskMessage::default_instance_->InitAsDefaultInstance();
   StatusUpdateMessage::default_instance_->InitAsDefaultInstance();
   StatusUpdateAcknowledgementMessage::default_instance_->InitAsDefaultInstance();
+  StatusUpdatesMessage::default_instance_->InitAsDefaultInstance();
+  StatusUpdateAcknowledgementsMessage::default_instance_->InitAsDefaultInstance();
   LostSlaveMessage::default_instance_->InitAsDefaultInstance();
   FrameworkErrorMessage::default_instance_->InitAsDefaultInstance();
   RegisterSlaveMessage::default_instance_->InitAsDefaultInstance();
@@ -3342,6 +3444,7 @@ void FrameworkToExecutorMessage::Swap(FrameworkToExecutorMessage* other) {
 
 #ifndef _MSC_VER
 const int RegisterFrameworkMessage::kFrameworkFieldNumber;
+const int RegisterFrameworkMessage::kSupportsBatchedStatusUpdatesFieldNumber;
 #endif  // !_MSC_VER
 
 RegisterFrameworkMessage::RegisterFrameworkMessage()
@@ -3362,6 +3465,7 @@ RegisterFrameworkMessage::RegisterFrameworkMessage(const RegisterFrameworkMessag
 void RegisterFrameworkMessage::SharedCtor() {
   _cached_size_ = 0;
   framework_ = NULL;
+  supports_batched_status_updates_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -3400,6 +3504,7 @@ void RegisterFrameworkMessage::Clear() {
     if (_has_bit(0)) {
       if (framework_ != NULL) framework_->::mesos::FrameworkInfo::Clear();
     }
+    supports_batched_status_updates_ = false;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -3420,6 +3525,22 @@ bool RegisterFrameworkMessage::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(16)) goto parse_supports_batched_status_updates;
+        break;
+      }
+      
+      // optional bool supports_batched_status_updates = 2 [default = false];
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_supports_batched_status_updates:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &supports_batched_status_updates_)));
+          _set_bit(1);
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -3448,6 +3569,11 @@ void RegisterFrameworkMessage::SerializeWithCachedSizes(
       1, this->framework(), output);
   }
   
+  // optional bool supports_batched_status_updates = 2 [default = false];
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->supports_batched_status_updates(), output);
+  }
+  
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -3463,6 +3589,11 @@ void RegisterFrameworkMessage::SerializeWithCachedSizes(
         1, this->framework(), target);
   }
   
+  // optional bool supports_batched_status_updates = 2 [default = false];
+  if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->supports_batched_status_updates(), target);
+  }
+  
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -3481,6 +3612,11 @@ int RegisterFrameworkMessage::ByteSize() const {
           this->framework());
     }
     
+    // optional bool supports_batched_status_updates = 2 [default = false];
+    if (has_supports_batched_status_updates()) {
+      total_size += 1 + 1;
+    }
+    
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -3511,6 +3647,9 @@ void RegisterFrameworkMessage::MergeFrom(const RegisterFrameworkMessage& from) {
     if (from._has_bit(0)) {
       mutable_framework()->::mesos::FrameworkInfo::MergeFrom(from.framework());
     }
+    if (from._has_bit(1)) {
+      set_supports_batched_status_updates(from.supports_batched_status_updates());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -3539,6 +3678,7 @@ bool RegisterFrameworkMessage::IsInitialized() const {
 void RegisterFrameworkMessage::Swap(RegisterFrameworkMessage* other) {
   if (other != this) {
     std::swap(framework_, other->framework_);
+    std::swap(supports_batched_status_updates_, other->supports_batched_status_updates_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -3560,6 +3700,7 @@ void RegisterFrameworkMessage::Swap(RegisterFrameworkMessage* other) {
 const int ReregisterFrameworkMessage::kFrameworkIdFieldNumber;
 const int ReregisterFrameworkMessage::kFrameworkFieldNumber;
 const int ReregisterFrameworkMessage::kFailoverFieldNumber;
+const int ReregisterFrameworkMessage::kSupportsBatchedStatusUpdatesFieldNumber;
 #endif  // !_MSC_VER
 
 ReregisterFrameworkMessage::ReregisterFrameworkMessage()
@@ -3583,6 +3724,7 @@ void ReregisterFrameworkMessage::SharedCtor() {
   framework_id_ = NULL;
   framework_ = NULL;
   failover_ = false;
+  supports_batched_status_updates_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -3626,6 +3768,7 @@ void ReregisterFrameworkMessage::Clear() {
       if (framework_ != NULL) framework_->::mesos::FrameworkInfo::Clear();
     }
     failover_ = false;
+    supports_batched_status_updates_ = false;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -3676,6 +3819,22 @@ bool ReregisterFrameworkMessage::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(32)) goto parse_supports_batched_status_updates;
+        break;
+      }
+      
+      // optional bool supports_batched_status_updates = 4 [default = false];
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_supports_batched_status_updates:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &supports_batched_status_updates_)));
+          _set_bit(3);
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -3715,6 +3874,11 @@ void ReregisterFrameworkMessage::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->failover(), output);
   }
   
+  // optional bool supports_batched_status_updates = 4 [default = false];
+  if (_has_bit(3)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->supports_batched_status_updates(), output);
+  }
+  
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -3742,6 +3906,11 @@ void ReregisterFrameworkMessage::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->failover(), target);
   }
   
+  // optional bool supports_batched_status_updates = 4 [default = false];
+  if (_has_bit(3)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->supports_batched_status_updates(), target);
+  }
+  
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -3772,6 +3941,11 @@ int ReregisterFrameworkMessage::ByteSize() const {
       total_size += 1 + 1;
     }
     
+    // optional bool supports_batched_status_updates = 4 [default = false];
+    if (has_supports_batched_status_updates()) {
+      total_size += 1 + 1;
+    }
+    
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -3808,6 +3982,9 @@ void ReregisterFrameworkMessage::MergeFrom(const ReregisterFrameworkMessage& fro
     if (from._has_bit(2)) {
       set_failover(from.failover());
     }
+    if (from._has_bit(3)) {
+      set_supports_batched_status_updates(from.supports_batched_status_updates());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -3841,6 +4018,7 @@ void ReregisterFrameworkMessage::Swap(ReregisterFrameworkMessage* other) {
     std::swap(framework_id_, other->framework_id_);
     std::swap(framework_, other->framework_);
     std::swap(failover_, other->failover_);
+    std::swap(supports_batched_status_updates_, other->supports_batched_status_updates_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -6387,79 +6565,92 @@ void RunTaskMessage::Swap(RunTaskMessage* other) {
 
 // ===================================================================
 
+const ::std::string RunTasksMessage::_default_pid_;
 #ifndef _MSC_VER
-const int KillTaskMessage::kFrameworkIdFieldNumber;
-const int KillTaskMessage::kTaskIdFieldNumber;
+const int RunTasksMessage::kFrameworkIdFieldNumber;
+const int RunTasksMessage::kFrameworkFieldNumber;
+const int RunTasksMessage::kPidFieldNumber;
+const int RunTasksMessage::kTasksFieldNumber;
 #endif  // !_MSC_VER
 
-KillTaskMessage::KillTaskMessage()
+RunTasksMessage::RunTasksMessage()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void KillTaskMessage::InitAsDefaultInstance() {
+void RunTasksMessage::InitAsDefaultInstance() {
   framework_id_ = const_cast< ::mesos::FrameworkID*>(&::mesos::FrameworkID::default_instance());
-  task_id_ = const_cast< ::mesos::TaskID*>(&::mesos::TaskID::default_instance());
+  framework_ = const_cast< ::mesos::FrameworkInfo*>(&::mesos::FrameworkInfo::default_instance());
 }
 
-KillTaskMessage::KillTaskMessage(const KillTaskMessage& from)
+RunTasksMessage::RunTasksMessage(const RunTasksMessage& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void KillTaskMessage::SharedCtor() {
+void RunTasksMessage::SharedCtor() {
   _cached_size_ = 0;
   framework_id_ = NULL;
-  task_id_ = NULL;
+  framework_ = NULL;
+  pid_ = const_cast< ::std::string*>(&_default_pid_);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-KillTaskMessage::~KillTaskMessage() {
+RunTasksMessage::~RunTasksMessage() {
   SharedDtor();
 }
 
-void KillTaskMessage::SharedDtor() {
+void RunTasksMessage::SharedDtor() {
+  if (pid_ != &_default_pid_) {
+    delete pid_;
+  }
   if (this != default_instance_) {
     delete framework_id_;
-    delete task_id_;
+    delete framework_;
   }
 }
 
-void KillTaskMessage::SetCachedSize(int size) const {
+void RunTasksMessage::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* KillTaskMessage::descriptor() {
+const ::google::protobuf::Descriptor* RunTasksMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return KillTaskMessage_descriptor_;
+  return RunTasksMessage_descriptor_;
 }
 
-const KillTaskMessage& KillTaskMessage::default_instance() {
+const RunTasksMessage& RunTasksMessage::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();  return *default_instance_;
 }
 
-KillTaskMessage* KillTaskMessage::default_instance_ = NULL;
+RunTasksMessage* RunTasksMessage::default_instance_ = NULL;
 
-KillTaskMessage* KillTaskMessage::New() const {
-  return new KillTaskMessage;
+RunTasksMessage* RunTasksMessage::New() const {
+  return new RunTasksMessage;
 }
 
-void KillTaskMessage::Clear() {
+void RunTasksMessage::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (_has_bit(0)) {
       if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
     }
     if (_has_bit(1)) {
-      if (task_id_ != NULL) task_id_->::mesos::TaskID::Clear();
+      if (framework_ != NULL) framework_->::mesos::FrameworkInfo::Clear();
+    }
+    if (_has_bit(2)) {
+      if (pid_ != &_default_pid_) {
+        pid_->clear();
+      }
     }
   }
+  tasks_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool KillTaskMessage::MergePartialFromCodedStream(
+bool RunTasksMessage::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
@@ -6474,20 +6665,52 @@ bool KillTaskMessage::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(18)) goto parse_task_id;
+        if (input->ExpectTag(18)) goto parse_framework;
         break;
       }
       
-      // required .mesos.TaskID task_id = 2;
+      // required .mesos.FrameworkInfo framework = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_task_id:
+         parse_framework:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_task_id()));
+               input, mutable_framework()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_pid;
+        break;
+      }
+      
+      // required string pid = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_pid:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_pid()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->pid().data(), this->pid().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(34)) goto parse_tasks;
+        break;
+      }
+      
+      // repeated .mesos.TaskDescription tasks = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_tasks:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_tasks()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_tasks;
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -6508,7 +6731,7 @@ bool KillTaskMessage::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void KillTaskMessage::SerializeWithCachedSizes(
+void RunTasksMessage::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
   // required .mesos.FrameworkID framework_id = 1;
   if (_has_bit(0)) {
@@ -6516,10 +6739,25 @@ void KillTaskMessage::SerializeWithCachedSizes(
       1, this->framework_id(), output);
   }
   
-  // required .mesos.TaskID task_id = 2;
+  // required .mesos.FrameworkInfo framework = 2;
   if (_has_bit(1)) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->task_id(), output);
+      2, this->framework(), output);
+  }
+  
+  // required string pid = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->pid().data(), this->pid().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      3, this->pid(), output);
+  }
+  
+  // repeated .mesos.TaskDescription tasks = 4;
+  for (int i = 0; i < this->tasks_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->tasks(i), output);
   }
   
   if (!unknown_fields().empty()) {
@@ -6528,7 +6766,7 @@ void KillTaskMessage::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* KillTaskMessage::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* RunTasksMessage::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
   // required .mesos.FrameworkID framework_id = 1;
   if (_has_bit(0)) {
@@ -6537,11 +6775,28 @@ void KillTaskMessage::SerializeWithCachedSizes(
         1, this->framework_id(), target);
   }
   
-  // required .mesos.TaskID task_id = 2;
+  // required .mesos.FrameworkInfo framework = 2;
   if (_has_bit(1)) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        2, this->task_id(), target);
+        2, this->framework(), target);
+  }
+  
+  // required string pid = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->pid().data(), this->pid().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->pid(), target);
+  }
+  
+  // repeated .mesos.TaskDescription tasks = 4;
+  for (int i = 0; i < this->tasks_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->tasks(i), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -6551,7 +6806,7 @@ void KillTaskMessage::SerializeWithCachedSizes(
   return target;
 }
 
-int KillTaskMessage::ByteSize() const {
+int RunTasksMessage::ByteSize() const {
   int total_size = 0;
   
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
@@ -6562,14 +6817,29 @@ int KillTaskMessage::ByteSize() const {
           this->framework_id());
     }
     
-    // required .mesos.TaskID task_id = 2;
-    if (has_task_id()) {
+    // required .mesos.FrameworkInfo framework = 2;
+    if (has_framework()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->task_id());
+          this->framework());
+    }
+    
+    // required string pid = 3;
+    if (has_pid()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->pid());
     }
     
   }
+  // repeated .mesos.TaskDescription tasks = 4;
+  total_size += 1 * this->tasks_size();
+  for (int i = 0; i < this->tasks_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->tasks(i));
+  }
+  
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -6581,10 +6851,10 @@ int KillTaskMessage::ByteSize() const {
   return total_size;
 }
 
-void KillTaskMessage::MergeFrom(const ::google::protobuf::Message& from) {
+void RunTasksMessage::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const KillTaskMessage* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const KillTaskMessage*>(
+  const RunTasksMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const RunTasksMessage*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -6593,169 +6863,171 @@ void KillTaskMessage::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void KillTaskMessage::MergeFrom(const KillTaskMessage& from) {
+void RunTasksMessage::MergeFrom(const RunTasksMessage& from) {
   GOOGLE_CHECK_NE(&from, this);
+  tasks_.MergeFrom(from.tasks_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from._has_bit(0)) {
       mutable_framework_id()->::mesos::FrameworkID::MergeFrom(from.framework_id());
     }
     if (from._has_bit(1)) {
-      mutable_task_id()->::mesos::TaskID::MergeFrom(from.task_id());
+      mutable_framework()->::mesos::FrameworkInfo::MergeFrom(from.framework());
+    }
+    if (from._has_bit(2)) {
+      set_pid(from.pid());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void KillTaskMessage::CopyFrom(const ::google::protobuf::Message& from) {
+void RunTasksMessage::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void KillTaskMessage::CopyFrom(const KillTaskMessage& from) {
+void RunTasksMessage::CopyFrom(const RunTasksMessage& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool KillTaskMessage::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+bool RunTasksMessage::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
   
   if (has_framework_id()) {
     if (!this->framework_id().IsInitialized()) return false;
   }
-  if (has_task_id()) {
-    if (!this->task_id().IsInitialized()) return false;
+  if (has_framework()) {
+    if (!this->framework().IsInitialized()) return false;
+  }
+  for (int i = 0; i < tasks_size(); i++) {
+    if (!this->tasks(i).IsInitialized()) return false;
   }
   return true;
 }
 
-void KillTaskMessage::Swap(KillTaskMessage* other) {
+void RunTasksMessage::Swap(RunTasksMessage* other) {
   if (other != this) {
     std::swap(framework_id_, other->framework_id_);
-    std::swap(task_id_, other->task_id_);
+    std::swap(framework_, other->framework_);
+    std::swap(pid_, other->pid_);
+    tasks_.Swap(&other->tasks_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata KillTaskMessage::GetMetadata() const {
+::google::protobuf::Metadata RunTasksMessage::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = KillTaskMessage_descriptor_;
-  metadata.reflection = KillTaskMessage_reflection_;
+  metadata.descriptor = RunTasksMessage_descriptor_;
+  metadata.reflection = RunTasksMessage_reflection_;
   return metadata;
 }
 
 
 // ===================================================================
 
-const ::std::string StatusUpdateMessage::_default_pid_;
 #ifndef _MSC_VER
-const int StatusUpdateMessage::kUpdateFieldNumber;
-const int StatusUpdateMessage::kPidFieldNumber;
+const int KillTaskMessage::kFrameworkIdFieldNumber;
+const int KillTaskMessage::kTaskIdFieldNumber;
 #endif  // !_MSC_VER
 
-StatusUpdateMessage::StatusUpdateMessage()
+KillTaskMessage::KillTaskMessage()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void StatusUpdateMessage::InitAsDefaultInstance() {
-  update_ = const_cast< ::mesos::internal::StatusUpdate*>(&::mesos::internal::StatusUpdate::default_instance());
+void KillTaskMessage::InitAsDefaultInstance() {
+  framework_id_ = const_cast< ::mesos::FrameworkID*>(&::mesos::FrameworkID::default_instance());
+  task_id_ = const_cast< ::mesos::TaskID*>(&::mesos::TaskID::default_instance());
 }
 
-StatusUpdateMessage::StatusUpdateMessage(const StatusUpdateMessage& from)
+KillTaskMessage::KillTaskMessage(const KillTaskMessage& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void StatusUpdateMessage::SharedCtor() {
+void KillTaskMessage::SharedCtor() {
   _cached_size_ = 0;
-  update_ = NULL;
-  pid_ = const_cast< ::std::string*>(&_default_pid_);
+  framework_id_ = NULL;
+  task_id_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-StatusUpdateMessage::~StatusUpdateMessage() {
+KillTaskMessage::~KillTaskMessage() {
   SharedDtor();
 }
 
-void StatusUpdateMessage::SharedDtor() {
-  if (pid_ != &_default_pid_) {
-    delete pid_;
-  }
+void KillTaskMessage::SharedDtor() {
   if (this != default_instance_) {
-    delete update_;
+    delete framework_id_;
+    delete task_id_;
   }
 }
 
-void StatusUpdateMessage::SetCachedSize(int size) const {
+void KillTaskMessage::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* StatusUpdateMessage::descriptor() {
+const ::google::protobuf::Descriptor* KillTaskMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return StatusUpdateMessage_descriptor_;
+  return KillTaskMessage_descriptor_;
 }
 
-const StatusUpdateMessage& StatusUpdateMessage::default_instance() {
+const KillTaskMessage& KillTaskMessage::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();  return *default_instance_;
 }
 
-StatusUpdateMessage* StatusUpdateMessage::default_instance_ = NULL;
+KillTaskMessage* KillTaskMessage::default_instance_ = NULL;
 
-StatusUpdateMessage* StatusUpdateMessage::New() const {
-  return new StatusUpdateMessage;
+KillTaskMessage* KillTaskMessage::New() const {
+  return new KillTaskMessage;
 }
 
-void StatusUpdateMessage::Clear() {
+void KillTaskMessage::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (_has_bit(0)) {
-      if (update_ != NULL) update_->::mesos::internal::StatusUpdate::Clear();
+      if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
     }
     if (_has_bit(1)) {
-      if (pid_ != &_default_pid_) {
-        pid_->clear();
-      }
+      if (task_id_ != NULL) task_id_->::mesos::TaskID::Clear();
     }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool StatusUpdateMessage::MergePartialFromCodedStream(
+bool KillTaskMessage::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .mesos.internal.StatusUpdate update = 1;
+      // required .mesos.FrameworkID framework_id = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_update()));
+               input, mutable_framework_id()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(18)) goto parse_pid;
+        if (input->ExpectTag(18)) goto parse_task_id;
         break;
       }
       
-      // optional string pid = 2;
+      // required .mesos.TaskID task_id = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_pid:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_pid()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->pid().data(), this->pid().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
+         parse_task_id:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_task_id()));
         } else {
           goto handle_uninterpreted;
         }
@@ -6779,21 +7051,18 @@ bool StatusUpdateMessage::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void StatusUpdateMessage::SerializeWithCachedSizes(
+void KillTaskMessage::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .mesos.internal.StatusUpdate update = 1;
+  // required .mesos.FrameworkID framework_id = 1;
   if (_has_bit(0)) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->update(), output);
+      1, this->framework_id(), output);
   }
   
-  // optional string pid = 2;
+  // required .mesos.TaskID task_id = 2;
   if (_has_bit(1)) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->pid().data(), this->pid().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->pid(), output);
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->task_id(), output);
   }
   
   if (!unknown_fields().empty()) {
@@ -6802,23 +7071,918 @@ void StatusUpdateMessage::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* StatusUpdateMessage::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* KillTaskMessage::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required .mesos.internal.StatusUpdate update = 1;
+  // required .mesos.FrameworkID framework_id = 1;
   if (_has_bit(0)) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        1, this->update(), target);
+        1, this->framework_id(), target);
   }
   
-  // optional string pid = 2;
+  // required .mesos.TaskID task_id = 2;
   if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->task_id(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int KillTaskMessage::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required .mesos.FrameworkID framework_id = 1;
+    if (has_framework_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->framework_id());
+    }
+    
+    // required .mesos.TaskID task_id = 2;
+    if (has_task_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->task_id());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void KillTaskMessage::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const KillTaskMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const KillTaskMessage*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void KillTaskMessage::MergeFrom(const KillTaskMessage& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      mutable_framework_id()->::mesos::FrameworkID::MergeFrom(from.framework_id());
+    }
+    if (from._has_bit(1)) {
+      mutable_task_id()->::mesos::TaskID::MergeFrom(from.task_id());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void KillTaskMessage::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void KillTaskMessage::CopyFrom(const KillTaskMessage& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KillTaskMessage::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+  
+  if (has_framework_id()) {
+    if (!this->framework_id().IsInitialized()) return false;
+  }
+  if (has_task_id()) {
+    if (!this->task_id().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void KillTaskMessage::Swap(KillTaskMessage* other) {
+  if (other != this) {
+    std::swap(framework_id_, other->framework_id_);
+    std::swap(task_id_, other->task_id_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata KillTaskMessage::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = KillTaskMessage_descriptor_;
+  metadata.reflection = KillTaskMessage_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+const ::std::string StatusUpdateMessage::_default_pid_;
+#ifndef _MSC_VER
+const int StatusUpdateMessage::kUpdateFieldNumber;
+const int StatusUpdateMessage::kPidFieldNumber;
+#endif  // !_MSC_VER
+
+StatusUpdateMessage::StatusUpdateMessage()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void StatusUpdateMessage::InitAsDefaultInstance() {
+  update_ = const_cast< ::mesos::internal::StatusUpdate*>(&::mesos::internal::StatusUpdate::default_instance());
+}
+
+StatusUpdateMessage::StatusUpdateMessage(const StatusUpdateMessage& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void StatusUpdateMessage::SharedCtor() {
+  _cached_size_ = 0;
+  update_ = NULL;
+  pid_ = const_cast< ::std::string*>(&_default_pid_);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+StatusUpdateMessage::~StatusUpdateMessage() {
+  SharedDtor();
+}
+
+void StatusUpdateMessage::SharedDtor() {
+  if (pid_ != &_default_pid_) {
+    delete pid_;
+  }
+  if (this != default_instance_) {
+    delete update_;
+  }
+}
+
+void StatusUpdateMessage::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* StatusUpdateMessage::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return StatusUpdateMessage_descriptor_;
+}
+
+const StatusUpdateMessage& StatusUpdateMessage::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();  return *default_instance_;
+}
+
+StatusUpdateMessage* StatusUpdateMessage::default_instance_ = NULL;
+
+StatusUpdateMessage* StatusUpdateMessage::New() const {
+  return new StatusUpdateMessage;
+}
+
+void StatusUpdateMessage::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (_has_bit(0)) {
+      if (update_ != NULL) update_->::mesos::internal::StatusUpdate::Clear();
+    }
+    if (_has_bit(1)) {
+      if (pid_ != &_default_pid_) {
+        pid_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool StatusUpdateMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required .mesos.internal.StatusUpdate update = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_update()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_pid;
+        break;
+      }
+      
+      // optional string pid = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_pid:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_pid()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->pid().data(), this->pid().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void StatusUpdateMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required .mesos.internal.StatusUpdate update = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->update(), output);
+  }
+  
+  // optional string pid = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->pid().data(), this->pid().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->pid(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* StatusUpdateMessage::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required .mesos.internal.StatusUpdate update = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->update(), target);
+  }
+  
+  // optional string pid = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->pid().data(), this->pid().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->pid(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int StatusUpdateMessage::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required .mesos.internal.StatusUpdate update = 1;
+    if (has_update()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->update());
+    }
+    
+    // optional string pid = 2;
+    if (has_pid()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->pid());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void StatusUpdateMessage::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const StatusUpdateMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const StatusUpdateMessage*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void StatusUpdateMessage::MergeFrom(const StatusUpdateMessage& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      mutable_update()->::mesos::internal::StatusUpdate::MergeFrom(from.update());
+    }
+    if (from._has_bit(1)) {
+      set_pid(from.pid());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void StatusUpdateMessage::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StatusUpdateMessage::CopyFrom(const StatusUpdateMessage& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatusUpdateMessage::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+  
+  if (has_update()) {
+    if (!this->update().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void StatusUpdateMessage::Swap(StatusUpdateMessage* other) {
+  if (other != this) {
+    std::swap(update_, other->update_);
+    std::swap(pid_, other->pid_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata StatusUpdateMessage::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = StatusUpdateMessage_descriptor_;
+  metadata.reflection = StatusUpdateMessage_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+const ::std::string StatusUpdateAcknowledgementMessage::_default_uuid_;
+#ifndef _MSC_VER
+const int StatusUpdateAcknowledgementMessage::kSlaveIdFieldNumber;
+const int StatusUpdateAcknowledgementMessage::kFrameworkIdFieldNumber;
+const int StatusUpdateAcknowledgementMessage::kTaskIdFieldNumber;
+const int StatusUpdateAcknowledgementMessage::kUuidFieldNumber;
+#endif  // !_MSC_VER
+
+StatusUpdateAcknowledgementMessage::StatusUpdateAcknowledgementMessage()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void StatusUpdateAcknowledgementMessage::InitAsDefaultInstance() {
+  slave_id_ = const_cast< ::mesos::SlaveID*>(&::mesos::SlaveID::default_instance());
+  framework_id_ = const_cast< ::mesos::FrameworkID*>(&::mesos::FrameworkID::default_instance());
+  task_id_ = const_cast< ::mesos::TaskID*>(&::mesos::TaskID::default_instance());
+}
+
+StatusUpdateAcknowledgementMessage::StatusUpdateAcknowledgementMessage(const StatusUpdateAcknowledgementMessage& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void StatusUpdateAcknowledgementMessage::SharedCtor() {
+  _cached_size_ = 0;
+  slave_id_ = NULL;
+  framework_id_ = NULL;
+  task_id_ = NULL;
+  uuid_ = const_cast< ::std::string*>(&_default_uuid_);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+StatusUpdateAcknowledgementMessage::~StatusUpdateAcknowledgementMessage() {
+  SharedDtor();
+}
+
+void StatusUpdateAcknowledgementMessage::SharedDtor() {
+  if (uuid_ != &_default_uuid_) {
+    delete uuid_;
+  }
+  if (this != default_instance_) {
+    delete slave_id_;
+    delete framework_id_;
+    delete task_id_;
+  }
+}
+
+void StatusUpdateAcknowledgementMessage::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* StatusUpdateAcknowledgementMessage::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return StatusUpdateAcknowledgementMessage_descriptor_;
+}
+
+const StatusUpdateAcknowledgementMessage& StatusUpdateAcknowledgementMessage::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();  return *default_instance_;
+}
+
+StatusUpdateAcknowledgementMessage* StatusUpdateAcknowledgementMessage::default_instance_ = NULL;
+
+StatusUpdateAcknowledgementMessage* StatusUpdateAcknowledgementMessage::New() const {
+  return new StatusUpdateAcknowledgementMessage;
+}
+
+void StatusUpdateAcknowledgementMessage::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (_has_bit(0)) {
+      if (slave_id_ != NULL) slave_id_->::mesos::SlaveID::Clear();
+    }
+    if (_has_bit(1)) {
+      if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
+    }
+    if (_has_bit(2)) {
+      if (task_id_ != NULL) task_id_->::mesos::TaskID::Clear();
+    }
+    if (_has_bit(3)) {
+      if (uuid_ != &_default_uuid_) {
+        uuid_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool StatusUpdateAcknowledgementMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required .mesos.SlaveID slave_id = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_slave_id()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_framework_id;
+        break;
+      }
+      
+      // required .mesos.FrameworkID framework_id = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_framework_id:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_framework_id()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_task_id;
+        break;
+      }
+      
+      // required .mesos.TaskID task_id = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_task_id:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_task_id()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_uuid;
+        break;
+      }
+      
+      // required bytes uuid = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_uuid:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_uuid()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void StatusUpdateAcknowledgementMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required .mesos.SlaveID slave_id = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->slave_id(), output);
+  }
+  
+  // required .mesos.FrameworkID framework_id = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->framework_id(), output);
+  }
+  
+  // required .mesos.TaskID task_id = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->task_id(), output);
+  }
+  
+  // required bytes uuid = 4;
+  if (_has_bit(3)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      4, this->uuid(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* StatusUpdateAcknowledgementMessage::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required .mesos.SlaveID slave_id = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->slave_id(), target);
+  }
+  
+  // required .mesos.FrameworkID framework_id = 2;
+  if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->framework_id(), target);
+  }
+  
+  // required .mesos.TaskID task_id = 3;
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->task_id(), target);
+  }
+  
+  // required bytes uuid = 4;
+  if (_has_bit(3)) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        4, this->uuid(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int StatusUpdateAcknowledgementMessage::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required .mesos.SlaveID slave_id = 1;
+    if (has_slave_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->slave_id());
+    }
+    
+    // required .mesos.FrameworkID framework_id = 2;
+    if (has_framework_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->framework_id());
+    }
+    
+    // required .mesos.TaskID task_id = 3;
+    if (has_task_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->task_id());
+    }
+    
+    // required bytes uuid = 4;
+    if (has_uuid()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->uuid());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void StatusUpdateAcknowledgementMessage::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const StatusUpdateAcknowledgementMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const StatusUpdateAcknowledgementMessage*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void StatusUpdateAcknowledgementMessage::MergeFrom(const StatusUpdateAcknowledgementMessage& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      mutable_slave_id()->::mesos::SlaveID::MergeFrom(from.slave_id());
+    }
+    if (from._has_bit(1)) {
+      mutable_framework_id()->::mesos::FrameworkID::MergeFrom(from.framework_id());
+    }
+    if (from._has_bit(2)) {
+      mutable_task_id()->::mesos::TaskID::MergeFrom(from.task_id());
+    }
+    if (from._has_bit(3)) {
+      set_uuid(from.uuid());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void StatusUpdateAcknowledgementMessage::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StatusUpdateAcknowledgementMessage::CopyFrom(const StatusUpdateAcknowledgementMessage& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatusUpdateAcknowledgementMessage::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
+  
+  if (has_slave_id()) {
+    if (!this->slave_id().IsInitialized()) return false;
+  }
+  if (has_framework_id()) {
+    if (!this->framework_id().IsInitialized()) return false;
+  }
+  if (has_task_id()) {
+    if (!this->task_id().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void StatusUpdateAcknowledgementMessage::Swap(StatusUpdateAcknowledgementMessage* other) {
+  if (other != this) {
+    std::swap(slave_id_, other->slave_id_);
+    std::swap(framework_id_, other->framework_id_);
+    std::swap(task_id_, other->task_id_);
+    std::swap(uuid_, other->uuid_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata StatusUpdateAcknowledgementMessage::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = StatusUpdateAcknowledgementMessage_descriptor_;
+  metadata.reflection = StatusUpdateAcknowledgementMessage_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int StatusUpdatesMessage::kUpdatesFieldNumber;
+const int StatusUpdatesMessage::kPidsFieldNumber;
+#endif  // !_MSC_VER
+
+StatusUpdatesMessage::StatusUpdatesMessage()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void StatusUpdatesMessage::InitAsDefaultInstance() {
+}
+
+StatusUpdatesMessage::StatusUpdatesMessage(const StatusUpdatesMessage& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void StatusUpdatesMessage::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+StatusUpdatesMessage::~StatusUpdatesMessage() {
+  SharedDtor();
+}
+
+void StatusUpdatesMessage::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void StatusUpdatesMessage::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* StatusUpdatesMessage::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return StatusUpdatesMessage_descriptor_;
+}
+
+const StatusUpdatesMessage& StatusUpdatesMessage::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();  return *default_instance_;
+}
+
+StatusUpdatesMessage* StatusUpdatesMessage::default_instance_ = NULL;
+
+StatusUpdatesMessage* StatusUpdatesMessage::New() const {
+  return new StatusUpdatesMessage;
+}
+
+void StatusUpdatesMessage::Clear() {
+  updates_.Clear();
+  pids_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool StatusUpdatesMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .mesos.internal.StatusUpdate updates = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_updates:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_updates()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(10)) goto parse_updates;
+        if (input->ExpectTag(18)) goto parse_pids;
+        break;
+      }
+      
+      // repeated string pids = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_pids:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_pids()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->pids(0).data(), this->pids(0).length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_pids;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void StatusUpdatesMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // repeated .mesos.internal.StatusUpdate updates = 1;
+  for (int i = 0; i < this->updates_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->updates(i), output);
+  }
+  
+  // repeated string pids = 2;
+  for (int i = 0; i < this->pids_size(); i++) {
+  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+    this->pids(i).data(), this->pids(i).length(),
+    ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->pids(i), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* StatusUpdatesMessage::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // repeated .mesos.internal.StatusUpdate updates = 1;
+  for (int i = 0; i < this->updates_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->updates(i), target);
+  }
+  
+  // repeated string pids = 2;
+  for (int i = 0; i < this->pids_size(); i++) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->pid().data(), this->pid().length(),
+      this->pids(i).data(), this->pids(i).length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->pid(), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(2, this->pids(i), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -6828,25 +7992,24 @@ void StatusUpdateMessage::SerializeWithCachedSizes(
   return target;
 }
 
-int StatusUpdateMessage::ByteSize() const {
+int StatusUpdatesMessage::ByteSize() const {
   int total_size = 0;
   
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .mesos.internal.StatusUpdate update = 1;
-    if (has_update()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->update());
-    }
-    
-    // optional string pid = 2;
-    if (has_pid()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->pid());
-    }
-    
+  // repeated .mesos.internal.StatusUpdate updates = 1;
+  total_size += 1 * this->updates_size();
+  for (int i = 0; i < this->updates_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->updates(i));
+  }
+  
+  // repeated string pids = 2;
+  total_size += 1 * this->pids_size();
+  for (int i = 0; i < this->pids_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->pids(i));
   }
+  
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -6858,10 +8021,10 @@ int StatusUpdateMessage::ByteSize() const {
   return total_size;
 }
 
-void StatusUpdateMessage::MergeFrom(const ::google::protobuf::Message& from) {
+void StatusUpdatesMessage::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const StatusUpdateMessage* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const StatusUpdateMessage*>(
+  const StatusUpdatesMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const StatusUpdatesMessage*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -6870,131 +8033,116 @@ void StatusUpdateMessage::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void StatusUpdateMessage::MergeFrom(const StatusUpdateMessage& from) {
+void StatusUpdatesMessage::MergeFrom(const StatusUpdatesMessage& from) {
   GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from._has_bit(0)) {
-      mutable_update()->::mesos::internal::StatusUpdate::MergeFrom(from.update());
-    }
-    if (from._has_bit(1)) {
-      set_pid(from.pid());
-    }
-  }
+  updates_.MergeFrom(from.updates_);
+  pids_.MergeFrom(from.pids_);
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void StatusUpdateMessage::CopyFrom(const ::google::protobuf::Message& from) {
+void StatusUpdatesMessage::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void StatusUpdateMessage::CopyFrom(const StatusUpdateMessage& from) {
+void StatusUpdatesMessage::CopyFrom(const StatusUpdatesMessage& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool StatusUpdateMessage::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+bool StatusUpdatesMessage::IsInitialized() const {
   
-  if (has_update()) {
-    if (!this->update().IsInitialized()) return false;
+  for (int i = 0; i < updates_size(); i++) {
+    if (!this->updates(i).IsInitialized()) return false;
   }
   return true;
 }
 
-void StatusUpdateMessage::Swap(StatusUpdateMessage* other) {
+void StatusUpdatesMessage::Swap(StatusUpdatesMessage* other) {
   if (other != this) {
-    std::swap(update_, other->update_);
-    std::swap(pid_, other->pid_);
+    updates_.Swap(&other->updates_);
+    pids_.Swap(&other->pids_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata StatusUpdateMessage::GetMetadata() const {
+::google::protobuf::Metadata StatusUpdatesMessage::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = StatusUpdateMessage_descriptor_;
-  metadata.reflection = StatusUpdateMessage_reflection_;
+  metadata.descriptor = StatusUpdatesMessage_descriptor_;
+  metadata.reflection = StatusUpdatesMessage_reflection_;
   return metadata;
 }
 
 
 // ===================================================================
 
-const ::std::string StatusUpdateAcknowledgementMessage::_default_uuid_;
 #ifndef _MSC_VER
-const int StatusUpdateAcknowledgementMessage::kSlaveIdFieldNumber;
-const int StatusUpdateAcknowledgementMessage::kFrameworkIdFieldNumber;
-const int StatusUpdateAcknowledgementMessage::kTaskIdFieldNumber;
-const int StatusUpdateAcknowledgementMessage::kUuidFieldNumber;
+const int StatusUpdateAcknowledgementsMessage::kSlaveIdFieldNumber;
+const int StatusUpdateAcknowledgementsMessage::kFrameworkIdFieldNumber;
+const int StatusUpdateAcknowledgementsMessage::kTaskIdsFieldNumber;
+const int StatusUpdateAcknowledgementsMessage::kUuidsFieldNumber;
 #endif  // !_MSC_VER
 
-StatusUpdateAcknowledgementMessage::StatusUpdateAcknowledgementMessage()
+StatusUpdateAcknowledgementsMessage::StatusUpdateAcknowledgementsMessage()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void StatusUpdateAcknowledgementMessage::InitAsDefaultInstance() {
+void StatusUpdateAcknowledgementsMessage::InitAsDefaultInstance() {
   slave_id_ = const_cast< ::mesos::SlaveID*>(&::mesos::SlaveID::default_instance());
   framework_id_ = const_cast< ::mesos::FrameworkID*>(&::mesos::FrameworkID::default_instance());
-  task_id_ = const_cast< ::mesos::TaskID*>(&::mesos::TaskID::default_instance());
 }
 
-StatusUpdateAcknowledgementMessage::StatusUpdateAcknowledgementMessage(const StatusUpdateAcknowledgementMessage& from)
+StatusUpdateAcknowledgementsMessage::StatusUpdateAcknowledgementsMessage(const StatusUpdateAcknowledgementsMessage& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void StatusUpdateAcknowledgementMessage::SharedCtor() {
+void StatusUpdateAcknowledgementsMessage::SharedCtor() {
   _cached_size_ = 0;
   slave_id_ = NULL;
   framework_id_ = NULL;
-  task_id_ = NULL;
-  uuid_ = const_cast< ::std::string*>(&_default_uuid_);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-StatusUpdateAcknowledgementMessage::~StatusUpdateAcknowledgementMessage() {
+StatusUpdateAcknowledgementsMessage::~StatusUpdateAcknowledgementsMessage() {
   SharedDtor();
 }
 
-void StatusUpdateAcknowledgementMessage::SharedDtor() {
-  if (uuid_ != &_default_uuid_) {
-    delete uuid_;
-  }
+void StatusUpdateAcknowledgementsMessage::SharedDtor() {
   if (this != default_instance_) {
     delete slave_id_;
     delete framework_id_;
-    delete task_id_;
   }
 }
 
-void StatusUpdateAcknowledgementMessage::SetCachedSize(int size) const {
+void StatusUpdateAcknowledgementsMessage::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* StatusUpdateAcknowledgementMessage::descriptor() {
+const ::google::protobuf::Descriptor* StatusUpdateAcknowledgementsMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return StatusUpdateAcknowledgementMessage_descriptor_;
+  return StatusUpdateAcknowledgementsMessage_descriptor_;
 }
 
-const StatusUpdateAcknowledgementMessage& StatusUpdateAcknowledgementMessage::default_instance() {
+const StatusUpdateAcknowledgementsMessage& StatusUpdateAcknowledgementsMessage::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();  return *default_instance_;
 }
 
-StatusUpdateAcknowledgementMessage* StatusUpdateAcknowledgementMessage::default_instance_ = NULL;
+StatusUpdateAcknowledgementsMessage* StatusUpdateAcknowledgementsMessage::default_instance_ = NULL;
 
-StatusUpdateAcknowledgementMessage* StatusUpdateAcknowledgementMessage::New() const {
-  return new StatusUpdateAcknowledgementMessage;
+StatusUpdateAcknowledgementsMessage* StatusUpdateAcknowledgementsMessage::New() const {
+  return new StatusUpdateAcknowledgementsMessage;
 }
 
-void StatusUpdateAcknowledgementMessage::Clear() {
+void StatusUpdateAcknowledgementsMessage::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (_has_bit(0)) {
       if (slave_id_ != NULL) slave_id_->::mesos::SlaveID::Clear();
@@ -7002,20 +8150,14 @@ void StatusUpdateAcknowledgementMessage::Clear() {
     if (_has_bit(1)) {
       if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
     }
-    if (_has_bit(2)) {
-      if (task_id_ != NULL) task_id_->::mesos::TaskID::Clear();
-    }
-    if (_has_bit(3)) {
-      if (uuid_ != &_default_uuid_) {
-        uuid_->clear();
-      }
-    }
   }
+  task_ids_.Clear();
+  uuids_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool StatusUpdateAcknowledgementMessage::MergePartialFromCodedStream(
+bool StatusUpdateAcknowledgementsMessage::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
@@ -7044,34 +8186,36 @@ bool StatusUpdateAcknowledgementMessage::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(26)) goto parse_task_id;
+        if (input->ExpectTag(26)) goto parse_task_ids;
         break;
       }
       
-      // required .mesos.TaskID task_id = 3;
+      // repeated .mesos.TaskID task_ids = 3;
       case 3: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_task_id:
+         parse_task_ids:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_task_id()));
+                input, add_task_ids()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(34)) goto parse_uuid;
+        if (input->ExpectTag(26)) goto parse_task_ids;
+        if (input->ExpectTag(34)) goto parse_uuids;
         break;
       }
       
-      // required bytes uuid = 4;
+      // repeated bytes uuids = 4;
       case 4: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_uuid:
+         parse_uuids:
           DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_uuid()));
+                input, this->add_uuids()));
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(34)) goto parse_uuids;
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -7092,7 +8236,7 @@ bool StatusUpdateAcknowledgementMessage::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void StatusUpdateAcknowledgementMessage::SerializeWithCachedSizes(
+void StatusUpdateAcknowledgementsMessage::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
   // required .mesos.SlaveID slave_id = 1;
   if (_has_bit(0)) {
@@ -7106,16 +8250,16 @@ void StatusUpdateAcknowledgementMessage::SerializeWithCachedSizes(
       2, this->framework_id(), output);
   }
   
-  // required .mesos.TaskID task_id = 3;
-  if (_has_bit(2)) {
+  // repeated .mesos.TaskID task_ids = 3;
+  for (int i = 0; i < this->task_ids_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->task_id(), output);
+      3, this->task_ids(i), output);
   }
   
-  // required bytes uuid = 4;
-  if (_has_bit(3)) {
+  // repeated bytes uuids = 4;
+  for (int i = 0; i < this->uuids_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      4, this->uuid(), output);
+      4, this->uuids(i), output);
   }
   
   if (!unknown_fields().empty()) {
@@ -7124,7 +8268,7 @@ void StatusUpdateAcknowledgementMessage::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* StatusUpdateAcknowledgementMessage::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* StatusUpdateAcknowledgementsMessage::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
   // required .mesos.SlaveID slave_id = 1;
   if (_has_bit(0)) {
@@ -7140,18 +8284,17 @@ void StatusUpdateAcknowledgementMessage::SerializeWithCachedSizes(
         2, this->framework_id(), target);
   }
   
-  // required .mesos.TaskID task_id = 3;
-  if (_has_bit(2)) {
+  // repeated .mesos.TaskID task_ids = 3;
+  for (int i = 0; i < this->task_ids_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        3, this->task_id(), target);
+        3, this->task_ids(i), target);
   }
   
-  // required bytes uuid = 4;
-  if (_has_bit(3)) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        4, this->uuid(), target);
+  // repeated bytes uuids = 4;
+  for (int i = 0; i < this->uuids_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteBytesToArray(4, this->uuids(i), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -7161,7 +8304,7 @@ void StatusUpdateAcknowledgementMessage::SerializeWithCachedSizes(
   return target;
 }
 
-int StatusUpdateAcknowledgementMessage::ByteSize() const {
+int StatusUpdateAcknowledgementsMessage::ByteSize() const {
   int total_size = 0;
   
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
@@ -7179,21 +8322,22 @@ int StatusUpdateAcknowledgementMessage::ByteSize() const {
           this->framework_id());
     }
     
-    // required .mesos.TaskID task_id = 3;
-    if (has_task_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->task_id());
-    }
-    
-    // required bytes uuid = 4;
-    if (has_uuid()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->uuid());
-    }
-    
   }
+  // repeated .mesos.TaskID task_ids = 3;
+  total_size += 1 * this->task_ids_size();
+  for (int i = 0; i < this->task_ids_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->task_ids(i));
+  }
+  
+  // repeated bytes uuids = 4;
+  total_size += 1 * this->uuids_size();
+  for (int i = 0; i < this->uuids_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::BytesSize(
+      this->uuids(i));
+  }
+  
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -7205,10 +8349,10 @@ int StatusUpdateAcknowledgementMessage::ByteSize() const {
   return total_size;
 }
 
-void StatusUpdateAcknowledgementMessage::MergeFrom(const ::google::protobuf::Message& from) {
+void StatusUpdateAcknowledgementsMessage::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const StatusUpdateAcknowledgementMessage* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const StatusUpdateAcknowledgementMessage*>(
+  const StatusUpdateAcknowledgementsMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const StatusUpdateAcknowledgementsMessage*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -7217,8 +8361,10 @@ void StatusUpdateAcknowledgementMessage::MergeFrom(const ::google::protobuf::Mes
   }
 }
 
-void StatusUpdateAcknowledgementMessage::MergeFrom(const StatusUpdateAcknowledgementMessage& from) {
+void StatusUpdateAcknowledgementsMessage::MergeFrom(const StatusUpdateAcknowledgementsMessage& from) {
   GOOGLE_CHECK_NE(&from, this);
+  task_ids_.MergeFrom(from.task_ids_);
+  uuids_.MergeFrom(from.uuids_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from._has_bit(0)) {
       mutable_slave_id()->::mesos::SlaveID::MergeFrom(from.slave_id());
@@ -7226,30 +8372,24 @@ void StatusUpdateAcknowledgementMessage::MergeFrom(const StatusUpdateAcknowledge
     if (from._has_bit(1)) {
       mutable_framework_id()->::mesos::FrameworkID::MergeFrom(from.framework_id());
     }
-    if (from._has_bit(2)) {
-      mutable_task_id()->::mesos::TaskID::MergeFrom(from.task_id());
-    }
-    if (from._has_bit(3)) {
-      set_uuid(from.uuid());
-    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void StatusUpdateAcknowledgementMessage::CopyFrom(const ::google::protobuf::Message& from) {
+void StatusUpdateAcknowledgementsMessage::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void StatusUpdateAcknowledgementMessage::CopyFrom(const StatusUpdateAcknowledgementMessage& from) {
+void StatusUpdateAcknowledgementsMessage::CopyFrom(const StatusUpdateAcknowledgementsMessage& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool StatusUpdateAcknowledgementMessage::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
+bool StatusUpdateAcknowledgementsMessage::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
   
   if (has_slave_id()) {
     if (!this->slave_id().IsInitialized()) return false;
@@ -7257,29 +8397,29 @@ bool StatusUpdateAcknowledgementMessage::IsInitialized() const {
   if (has_framework_id()) {
     if (!this->framework_id().IsInitialized()) return false;
   }
-  if (has_task_id()) {
-    if (!this->task_id().IsInitialized()) return false;
+  for (int i = 0; i < task_ids_size(); i++) {
+    if (!this->task_ids(i).IsInitialized()) return false;
   }
   return true;
 }
 
-void StatusUpdateAcknowledgementMessage::Swap(StatusUpdateAcknowledgementMessage* other) {
+void StatusUpdateAcknowledgementsMessage::Swap(StatusUpdateAcknowledgementsMessage* other) {
   if (other != this) {
     std::swap(slave_id_, other->slave_id_);
     std::swap(framework_id_, other->framework_id_);
-    std::swap(task_id_, other->task_id_);
-    std::swap(uuid_, other->uuid_);
+    task_ids_.Swap(&other->task_ids_);
+    uuids_.Swap(&other->uuids_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata StatusUpdateAcknowledgementMessage::GetMetadata() const {
+::google::protobuf::Metadata StatusUpdateAcknowledgementsMessage::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = StatusUpdateAcknowledgementMessage_descriptor_;
-  metadata.reflection = StatusUpdateAcknowledgementMessage_reflection_;
+  metadata.descriptor = StatusUpdateAcknowledgementsMessage_descriptor_;
+  metadata.reflection = StatusUpdateAcknowledgementsMessage_reflection_;
   return metadata;
 }
 
@@ -7770,6 +8910,8 @@ void FrameworkErrorMessage::Swap(FrameworkErrorMessage* other) {
 
 #ifndef _MSC_VER
 const int RegisterSlaveMessage::kSlaveFieldNumber;
+const int RegisterSlaveMessage::kSupportsRunTasksFieldNumber;
+const int RegisterSlaveMessage::kSupportsStatusUpdateAcknowledgementsFieldNumber;
 #endif  // !_MSC_VER
 
 RegisterSlaveMessage::RegisterSlaveMessage()
@@ -7790,6 +8932,8 @@ RegisterSlaveMessage::RegisterSlaveMessage(const RegisterSlaveMessage& from)
 void RegisterSlaveMessage::SharedCtor() {
   _cached_size_ = 0;
   slave_ = NULL;
+  supports_run_tasks_ = false;
+  supports_status_update_acknowledgements_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -7828,6 +8972,8 @@ void RegisterSlaveMessage::Clear() {
     if (_has_bit(0)) {
       if (slave_ != NULL) slave_->::mesos::SlaveInfo::Clear();
     }
+    supports_run_tasks_ = false;
+    supports_status_update_acknowledgements_ = false;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -7848,6 +8994,38 @@ bool RegisterSlaveMessage::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(16)) goto parse_supports_run_tasks;
+        break;
+      }
+      
+      // optional bool supports_run_tasks = 2 [default = false];
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_supports_run_tasks:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &supports_run_tasks_)));
+          _set_bit(1);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_supports_status_update_acknowledgements;
+        break;
+      }
+      
+      // optional bool supports_status_update_acknowledgements = 3 [default = false];
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_supports_status_update_acknowledgements:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &supports_status_update_acknowledgements_)));
+          _set_bit(2);
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -7876,6 +9054,16 @@ void RegisterSlaveMessage::SerializeWithCachedSizes(
       1, this->slave(), output);
   }
   
+  // optional bool supports_run_tasks = 2 [default = false];
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->supports_run_tasks(), output);
+  }
+  
+  // optional bool supports_status_update_acknowledgements = 3 [default = false];
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->supports_status_update_acknowledgements(), output);
+  }
+  
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -7891,6 +9079,16 @@ void RegisterSlaveMessage::SerializeWithCachedSizes(
         1, this->slave(), target);
   }
   
+  // optional bool supports_run_tasks = 2 [default = false];
+  if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->supports_run_tasks(), target);
+  }
+  
+  // optional bool supports_status_update_acknowledgements = 3 [default = false];
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->supports_status_update_acknowledgements(), target);
+  }
+  
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -7909,6 +9107,16 @@ int RegisterSlaveMessage::ByteSize() const {
           this->slave());
     }
     
+    // optional bool supports_run_tasks = 2 [default = false];
+    if (has_supports_run_tasks()) {
+      total_size += 1 + 1;
+    }
+    
+    // optional bool supports_status_update_acknowledgements = 3 [default = false];
+    if (has_supports_status_update_acknowledgements()) {
+      total_size += 1 + 1;
+    }
+    
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -7939,6 +9147,12 @@ void RegisterSlaveMessage::MergeFrom(const RegisterSlaveMessage& from) {
     if (from._has_bit(0)) {
       mutable_slave()->::mesos::SlaveInfo::MergeFrom(from.slave());
     }
+    if (from._has_bit(1)) {
+      set_supports_run_tasks(from.supports_run_tasks());
+    }
+    if (from._has_bit(2)) {
+      set_supports_status_update_acknowledgements(from.supports_status_update_acknowledgements());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -7967,6 +9181,8 @@ bool RegisterSlaveMessage::IsInitialized() const {
 void RegisterSlaveMessage::Swap(RegisterSlaveMessage* other) {
   if (other != this) {
     std::swap(slave_, other->slave_);
+    std::swap(supports_run_tasks_, other->supports_run_tasks_);
+    std::swap(supports_status_update_acknowledgements_, other->supports_status_update_acknowledgements_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -7989,6 +9205,8 @@ const int ReregisterSlaveMessage::kSlaveIdFieldNumber;
 const int ReregisterSlaveMessage::kSlaveFieldNumber;
 const int ReregisterSlaveMessage::kExecutorInfosFieldNumber;
 const int ReregisterSlaveMessage::kTasksFieldNumber;
+const int ReregisterSlaveMessage::kSupportsRunTasksFieldNumber;
+const int ReregisterSlaveMessage::kSupportsStatusUpdateAcknowledgementsFieldNumber;
 #endif  // !_MSC_VER
 
 ReregisterSlaveMessage::ReregisterSlaveMessage()
@@ -8011,6 +9229,8 @@ void ReregisterSlaveMessage::SharedCtor() {
   _cached_size_ = 0;
   slave_id_ = NULL;
   slave_ = NULL;
+  supports_run_tasks_ = false;
+  supports_status_update_acknowledgements_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -8053,6 +9273,8 @@ void ReregisterSlaveMessage::Clear() {
     if (_has_bit(1)) {
       if (slave_ != NULL) slave_->::mesos::SlaveInfo::Clear();
     }
+    supports_run_tasks_ = false;
+    supports_status_update_acknowledgements_ = false;
   }
   executor_infos_.Clear();
   tasks_.Clear();
@@ -8119,6 +9341,38 @@ bool ReregisterSlaveMessage::MergePartialFromCodedStream(
           goto handle_uninterpreted;
         }
         if (input->ExpectTag(34)) goto parse_executor_infos;
+        if (input->ExpectTag(40)) goto parse_supports_run_tasks;
+        break;
+      }
+      
+      // optional bool supports_run_tasks = 5 [default = false];
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_supports_run_tasks:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &supports_run_tasks_)));
+          _set_bit(4);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(48)) goto parse_supports_status_update_acknowledgements;
+        break;
+      }
+      
+      // optional bool supports_status_update_acknowledgements = 6 [default = false];
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_supports_status_update_acknowledgements:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &supports_status_update_acknowledgements_)));
+          _set_bit(5);
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -8165,6 +9419,16 @@ void ReregisterSlaveMessage::SerializeWithCachedSizes(
       4, this->executor_infos(i), output);
   }
   
+  // optional bool supports_run_tasks = 5 [default = false];
+  if (_has_bit(4)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->supports_run_tasks(), output);
+  }
+  
+  // optional bool supports_status_update_acknowledgements = 6 [default = false];
+  if (_has_bit(5)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->supports_status_update_acknowledgements(), output);
+  }
+  
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -8201,6 +9465,16 @@ void ReregisterSlaveMessage::SerializeWithCachedSizes(
         4, this->executor_infos(i), target);
   }
   
+  // optional bool supports_run_tasks = 5 [default = false];
+  if (_has_bit(4)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(5, this->supports_run_tasks(), target);
+  }
+  
+  // optional bool supports_status_update_acknowledgements = 6 [default = false];
+  if (_has_bit(5)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(6, this->supports_status_update_acknowledgements(), target);
+  }
+  
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -8226,6 +9500,16 @@ int ReregisterSlaveMessage::ByteSize() const {
           this->slave());
     }
     
+    // optional bool supports_run_tasks = 5 [default = false];
+    if (has_supports_run_tasks()) {
+      total_size += 1 + 1;
+    }
+    
+    // optional bool supports_status_update_acknowledgements = 6 [default = false];
+    if (has_supports_status_update_acknowledgements()) {
+      total_size += 1 + 1;
+    }
+    
   }
   // repeated .mesos.ExecutorInfo executor_infos = 4;
   total_size += 1 * this->executor_infos_size();
@@ -8277,6 +9561,12 @@ void ReregisterSlaveMessage::MergeFrom(const ReregisterSlaveMessage& from) {
     if (from._has_bit(1)) {
       mutable_slave()->::mesos::SlaveInfo::MergeFrom(from.slave());
     }
+    if (from._has_bit(4)) {
+      set_supports_run_tasks(from.supports_run_tasks());
+    }
+    if (from._has_bit(5)) {
+      set_supports_status_update_acknowledgements(from.supports_status_update_acknowledgements());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -8317,6 +9607,8 @@ void ReregisterSlaveMessage::Swap(ReregisterSlaveMessage* other) {
     std::swap(slave_, other->slave_);
     executor_infos_.Swap(&other->executor_infos_);
     tasks_.Swap(&other->tasks_);
+    std::swap(supports_run_tasks_, other->supports_run_tasks_);
+    std::swap(supports_status_update_acknowledgements_, other->supports_status_update_acknowledgements_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
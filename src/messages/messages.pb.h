@@ -52,9 +52,12 @@ class LaunchTasksMessage;
 class RescindResourceOfferMessage;
 class ReviveOffersMessage;
 class RunTaskMessage;
+class RunTasksMessage;
 class KillTaskMessage;
 class StatusUpdateMessage;
 class StatusUpdateAcknowledgementMessage;
+class StatusUpdatesMessage;
+class StatusUpdateAcknowledgementsMessage;
 class LostSlaveMessage;
 class FrameworkErrorMessage;
 class RegisterSlaveMessage;
@@ -836,17 +839,25 @@ class RegisterFrameworkMessage : public ::google::protobuf::Message {
   inline const ::mesos::FrameworkInfo& framework() const;
   inline ::mesos::FrameworkInfo* mutable_framework();
   
+  // optional bool supports_batched_status_updates = 2 [default = false];
+  inline bool has_supports_batched_status_updates() const;
+  inline void clear_supports_batched_status_updates();
+  static const int kSupportsBatchedStatusUpdatesFieldNumber = 2;
+  inline bool supports_batched_status_updates() const;
+  inline void set_supports_batched_status_updates(bool value);
+  
   // @@protoc_insertion_point(class_scope:mesos.internal.RegisterFrameworkMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
   mutable int _cached_size_;
   
   ::mesos::FrameworkInfo* framework_;
+  bool supports_batched_status_updates_;
   friend void  protobuf_AddDesc_messages_2eproto();
   friend void protobuf_AssignDesc_messages_2eproto();
   friend void protobuf_ShutdownFile_messages_2eproto();
   
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
   
   // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
   inline bool _has_bit(int index) const {
@@ -939,6 +950,13 @@ class ReregisterFrameworkMessage : public ::google::protobuf::Message {
   inline bool failover() const;
   inline void set_failover(bool value);
   
+  // optional bool supports_batched_status_updates = 4 [default = false];
+  inline bool has_supports_batched_status_updates() const;
+  inline void clear_supports_batched_status_updates();
+  static const int kSupportsBatchedStatusUpdatesFieldNumber = 4;
+  inline bool supports_batched_status_updates() const;
+  inline void set_supports_batched_status_updates(bool value);
+  
   // @@protoc_insertion_point(class_scope:mesos.internal.ReregisterFrameworkMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
@@ -947,11 +965,12 @@ class ReregisterFrameworkMessage : public ::google::protobuf::Message {
   ::mesos::FrameworkID* framework_id_;
   ::mesos::FrameworkInfo* framework_;
   bool failover_;
+  bool supports_batched_status_updates_;
   friend void  protobuf_AddDesc_messages_2eproto();
   friend void protobuf_AssignDesc_messages_2eproto();
   friend void protobuf_ShutdownFile_messages_2eproto();
   
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
   
   // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
   inline bool _has_bit(int index) const {
@@ -1951,6 +1970,128 @@ class RunTaskMessage : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class RunTasksMessage : public ::google::protobuf::Message {
+ public:
+  RunTasksMessage();
+  virtual ~RunTasksMessage();
+  
+  RunTasksMessage(const RunTasksMessage& from);
+  
+  inline RunTasksMessage& operator=(const RunTasksMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const RunTasksMessage& default_instance();
+  
+  void Swap(RunTasksMessage* other);
+  
+  // implements Message ----------------------------------------------
+  
+  RunTasksMessage* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const RunTasksMessage& from);
+  void MergeFrom(const RunTasksMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // required .mesos.FrameworkID framework_id = 1;
+  inline bool has_framework_id() const;
+  inline void clear_framework_id();
+  static const int kFrameworkIdFieldNumber = 1;
+  inline const ::mesos::FrameworkID& framework_id() const;
+  inline ::mesos::FrameworkID* mutable_framework_id();
+  
+  // required .mesos.FrameworkInfo framework = 2;
+  inline bool has_framework() const;
+  inline void clear_framework();
+  static const int kFrameworkFieldNumber = 2;
+  inline const ::mesos::FrameworkInfo& framework() const;
+  inline ::mesos::FrameworkInfo* mutable_framework();
+  
+  // required string pid = 3;
+  inline bool has_pid() const;
+  inline void clear_pid();
+  static const int kPidFieldNumber = 3;
+  inline const ::std::string& pid() const;
+  inline void set_pid(const ::std::string& value);
+  inline void set_pid(const char* value);
+  inline void set_pid(const char* value, size_t size);
+  inline ::std::string* mutable_pid();
+  
+  // repeated .mesos.TaskDescription tasks = 4;
+  inline int tasks_size() const;
+  inline void clear_tasks();
+  static const int kTasksFieldNumber = 4;
+  inline const ::mesos::TaskDescription& tasks(int index) const;
+  inline ::mesos::TaskDescription* mutable_tasks(int index);
+  inline ::mesos::TaskDescription* add_tasks();
+  inline const ::google::protobuf::RepeatedPtrField< ::mesos::TaskDescription >&
+      tasks() const;
+  inline ::google::protobuf::RepeatedPtrField< ::mesos::TaskDescription >*
+      mutable_tasks();
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.RunTasksMessage)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable int _cached_size_;
+  
+  ::mesos::FrameworkID* framework_id_;
+  ::mesos::FrameworkInfo* framework_;
+  ::std::string* pid_;
+  static const ::std::string _default_pid_;
+  ::google::protobuf::RepeatedPtrField< ::mesos::TaskDescription > tasks_;
+  friend void  protobuf_AddDesc_messages_2eproto();
+  friend void protobuf_AssignDesc_messages_2eproto();
+  friend void protobuf_ShutdownFile_messages_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static RunTasksMessage* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class KillTaskMessage : public ::google::protobuf::Message {
  public:
   KillTaskMessage();
@@ -2217,33 +2358,271 @@ class StatusUpdateAcknowledgementMessage : public ::google::protobuf::Message {
   inline const ::mesos::FrameworkID& framework_id() const;
   inline ::mesos::FrameworkID* mutable_framework_id();
   
-  // required .mesos.TaskID task_id = 3;
-  inline bool has_task_id() const;
-  inline void clear_task_id();
-  static const int kTaskIdFieldNumber = 3;
-  inline const ::mesos::TaskID& task_id() const;
-  inline ::mesos::TaskID* mutable_task_id();
-  
-  // required bytes uuid = 4;
-  inline bool has_uuid() const;
-  inline void clear_uuid();
-  static const int kUuidFieldNumber = 4;
-  inline const ::std::string& uuid() const;
-  inline void set_uuid(const ::std::string& value);
-  inline void set_uuid(const char* value);
-  inline void set_uuid(const void* value, size_t size);
-  inline ::std::string* mutable_uuid();
-  
-  // @@protoc_insertion_point(class_scope:mesos.internal.StatusUpdateAcknowledgementMessage)
+  // required .mesos.TaskID task_id = 3;
+  inline bool has_task_id() const;
+  inline void clear_task_id();
+  static const int kTaskIdFieldNumber = 3;
+  inline const ::mesos::TaskID& task_id() const;
+  inline ::mesos::TaskID* mutable_task_id();
+  
+  // required bytes uuid = 4;
+  inline bool has_uuid() const;
+  inline void clear_uuid();
+  static const int kUuidFieldNumber = 4;
+  inline const ::std::string& uuid() const;
+  inline void set_uuid(const ::std::string& value);
+  inline void set_uuid(const char* value);
+  inline void set_uuid(const void* value, size_t size);
+  inline ::std::string* mutable_uuid();
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.StatusUpdateAcknowledgementMessage)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable int _cached_size_;
+  
+  ::mesos::SlaveID* slave_id_;
+  ::mesos::FrameworkID* framework_id_;
+  ::mesos::TaskID* task_id_;
+  ::std::string* uuid_;
+  static const ::std::string _default_uuid_;
+  friend void  protobuf_AddDesc_messages_2eproto();
+  friend void protobuf_AssignDesc_messages_2eproto();
+  friend void protobuf_ShutdownFile_messages_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static StatusUpdateAcknowledgementMessage* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class StatusUpdatesMessage : public ::google::protobuf::Message {
+ public:
+  StatusUpdatesMessage();
+  virtual ~StatusUpdatesMessage();
+  
+  StatusUpdatesMessage(const StatusUpdatesMessage& from);
+  
+  inline StatusUpdatesMessage& operator=(const StatusUpdatesMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const StatusUpdatesMessage& default_instance();
+  
+  void Swap(StatusUpdatesMessage* other);
+  
+  // implements Message ----------------------------------------------
+  
+  StatusUpdatesMessage* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const StatusUpdatesMessage& from);
+  void MergeFrom(const StatusUpdatesMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // repeated .mesos.internal.StatusUpdate updates = 1;
+  inline int updates_size() const;
+  inline void clear_updates();
+  static const int kUpdatesFieldNumber = 1;
+  inline const ::mesos::internal::StatusUpdate& updates(int index) const;
+  inline ::mesos::internal::StatusUpdate* mutable_updates(int index);
+  inline ::mesos::internal::StatusUpdate* add_updates();
+  inline const ::google::protobuf::RepeatedPtrField< ::mesos::internal::StatusUpdate >&
+      updates() const;
+  inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::StatusUpdate >*
+      mutable_updates();
+  
+  // repeated string pids = 2;
+  inline int pids_size() const;
+  inline void clear_pids();
+  static const int kPidsFieldNumber = 2;
+  inline const ::std::string& pids(int index) const;
+  inline ::std::string* mutable_pids(int index);
+  inline void set_pids(int index, const ::std::string& value);
+  inline void set_pids(int index, const char* value);
+  inline void set_pids(int index, const char* value, size_t size);
+  inline ::std::string* add_pids();
+  inline void add_pids(const ::std::string& value);
+  inline void add_pids(const char* value);
+  inline void add_pids(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& pids() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_pids();
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.StatusUpdatesMessage)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable int _cached_size_;
+  
+  ::google::protobuf::RepeatedPtrField< ::mesos::internal::StatusUpdate > updates_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> pids_;
+  friend void  protobuf_AddDesc_messages_2eproto();
+  friend void protobuf_AssignDesc_messages_2eproto();
+  friend void protobuf_ShutdownFile_messages_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static StatusUpdatesMessage* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class StatusUpdateAcknowledgementsMessage : public ::google::protobuf::Message {
+ public:
+  StatusUpdateAcknowledgementsMessage();
+  virtual ~StatusUpdateAcknowledgementsMessage();
+  
+  StatusUpdateAcknowledgementsMessage(const StatusUpdateAcknowledgementsMessage& from);
+  
+  inline StatusUpdateAcknowledgementsMessage& operator=(const StatusUpdateAcknowledgementsMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const StatusUpdateAcknowledgementsMessage& default_instance();
+  
+  void Swap(StatusUpdateAcknowledgementsMessage* other);
+  
+  // implements Message ----------------------------------------------
+  
+  StatusUpdateAcknowledgementsMessage* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const StatusUpdateAcknowledgementsMessage& from);
+  void MergeFrom(const StatusUpdateAcknowledgementsMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // required .mesos.SlaveID slave_id = 1;
+  inline bool has_slave_id() const;
+  inline void clear_slave_id();
+  static const int kSlaveIdFieldNumber = 1;
+  inline const ::mesos::SlaveID& slave_id() const;
+  inline ::mesos::SlaveID* mutable_slave_id();
+  
+  // required .mesos.FrameworkID framework_id = 2;
+  inline bool has_framework_id() const;
+  inline void clear_framework_id();
+  static const int kFrameworkIdFieldNumber = 2;
+  inline const ::mesos::FrameworkID& framework_id() const;
+  inline ::mesos::FrameworkID* mutable_framework_id();
+  
+  // repeated .mesos.TaskID task_ids = 3;
+  inline int task_ids_size() const;
+  inline void clear_task_ids();
+  static const int kTaskIdsFieldNumber = 3;
+  inline const ::mesos::TaskID& task_ids(int index) const;
+  inline ::mesos::TaskID* mutable_task_ids(int index);
+  inline ::mesos::TaskID* add_task_ids();
+  inline const ::google::protobuf::RepeatedPtrField< ::mesos::TaskID >&
+      task_ids() const;
+  inline ::google::protobuf::RepeatedPtrField< ::mesos::TaskID >*
+      mutable_task_ids();
+  
+  // repeated bytes uuids = 4;
+  inline int uuids_size() const;
+  inline void clear_uuids();
+  static const int kUuidsFieldNumber = 4;
+  inline const ::std::string& uuids(int index) const;
+  inline ::std::string* mutable_uuids(int index);
+  inline void set_uuids(int index, const ::std::string& value);
+  inline void set_uuids(int index, const char* value);
+  inline void set_uuids(int index, const void* value, size_t size);
+  inline ::std::string* add_uuids();
+  inline void add_uuids(const ::std::string& value);
+  inline void add_uuids(const char* value);
+  inline void add_uuids(const void* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& uuids() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_uuids();
+  
+  // @@protoc_insertion_point(class_scope:mesos.internal.StatusUpdateAcknowledgementsMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
   mutable int _cached_size_;
   
   ::mesos::SlaveID* slave_id_;
   ::mesos::FrameworkID* framework_id_;
-  ::mesos::TaskID* task_id_;
-  ::std::string* uuid_;
-  static const ::std::string _default_uuid_;
+  ::google::protobuf::RepeatedPtrField< ::mesos::TaskID > task_ids_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> uuids_;
   friend void  protobuf_AddDesc_messages_2eproto();
   friend void protobuf_AssignDesc_messages_2eproto();
   friend void protobuf_ShutdownFile_messages_2eproto();
@@ -2262,7 +2641,7 @@ class StatusUpdateAcknowledgementMessage : public ::google::protobuf::Message {
   }
   
   void InitAsDefaultInstance();
-  static StatusUpdateAcknowledgementMessage* default_instance_;
+  static StatusUpdateAcknowledgementsMessage* default_instance_;
 };
 // -------------------------------------------------------------------
 
@@ -2517,17 +2896,33 @@ class RegisterSlaveMessage : public ::google::protobuf::Message {
   inline const ::mesos::SlaveInfo& slave() const;
   inline ::mesos::SlaveInfo* mutable_slave();
   
+  // optional bool supports_run_tasks = 2 [default = false];
+  inline bool has_supports_run_tasks() const;
+  inline void clear_supports_run_tasks();
+  static const int kSupportsRunTasksFieldNumber = 2;
+  inline bool supports_run_tasks() const;
+  inline void set_supports_run_tasks(bool value);
+  
+  // optional bool supports_status_update_acknowledgements = 3 [default = false];
+  inline bool has_supports_status_update_acknowledgements() const;
+  inline void clear_supports_status_update_acknowledgements();
+  static const int kSupportsStatusUpdateAcknowledgementsFieldNumber = 3;
+  inline bool supports_status_update_acknowledgements() const;
+  inline void set_supports_status_update_acknowledgements(bool value);
+  
   // @@protoc_insertion_point(class_scope:mesos.internal.RegisterSlaveMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
   mutable int _cached_size_;
   
   ::mesos::SlaveInfo* slave_;
+  bool supports_run_tasks_;
+  bool supports_status_update_acknowledgements_;
   friend void  protobuf_AddDesc_messages_2eproto();
   friend void protobuf_AssignDesc_messages_2eproto();
   friend void protobuf_ShutdownFile_messages_2eproto();
   
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
   
   // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
   inline bool _has_bit(int index) const {
@@ -2637,6 +3032,20 @@ class ReregisterSlaveMessage : public ::google::protobuf::Message {
   inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::Task >*
       mutable_tasks();
   
+  // optional bool supports_run_tasks = 5 [default = false];
+  inline bool has_supports_run_tasks() const;
+  inline void clear_supports_run_tasks();
+  static const int kSupportsRunTasksFieldNumber = 5;
+  inline bool supports_run_tasks() const;
+  inline void set_supports_run_tasks(bool value);
+  
+  // optional bool supports_status_update_acknowledgements = 6 [default = false];
+  inline bool has_supports_status_update_acknowledgements() const;
+  inline void clear_supports_status_update_acknowledgements();
+  static const int kSupportsStatusUpdateAcknowledgementsFieldNumber = 6;
+  inline bool supports_status_update_acknowledgements() const;
+  inline void set_supports_status_update_acknowledgements(bool value);
+  
   // @@protoc_insertion_point(class_scope:mesos.internal.ReregisterSlaveMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
@@ -2646,11 +3055,13 @@ class ReregisterSlaveMessage : public ::google::protobuf::Message {
   ::mesos::SlaveInfo* slave_;
   ::google::protobuf::RepeatedPtrField< ::mesos::ExecutorInfo > executor_infos_;
   ::google::protobuf::RepeatedPtrField< ::mesos::internal::Task > tasks_;
+  bool supports_run_tasks_;
+  bool supports_status_update_acknowledgements_;
   friend void  protobuf_AddDesc_messages_2eproto();
   friend void protobuf_AssignDesc_messages_2eproto();
   friend void protobuf_ShutdownFile_messages_2eproto();
   
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
   
   // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
   inline bool _has_bit(int index) const {
@@ -4874,6 +5285,22 @@ inline ::mesos::FrameworkInfo* RegisterFrameworkMessage::mutable_framework() {
   return framework_;
 }
 
+// optional bool supports_batched_status_updates = 2 [default = false];
+inline bool RegisterFrameworkMessage::has_supports_batched_status_updates() const {
+  return _has_bit(1);
+}
+inline void RegisterFrameworkMessage::clear_supports_batched_status_updates() {
+  supports_batched_status_updates_ = false;
+  _clear_bit(1);
+}
+inline bool RegisterFrameworkMessage::supports_batched_status_updates() const {
+  return supports_batched_status_updates_;
+}
+inline void RegisterFrameworkMessage::set_supports_batched_status_updates(bool value) {
+  _set_bit(1);
+  supports_batched_status_updates_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // ReregisterFrameworkMessage
@@ -4928,6 +5355,22 @@ inline void ReregisterFrameworkMessage::set_failover(bool value) {
   failover_ = value;
 }
 
+// optional bool supports_batched_status_updates = 4 [default = false];
+inline bool ReregisterFrameworkMessage::has_supports_batched_status_updates() const {
+  return _has_bit(3);
+}
+inline void ReregisterFrameworkMessage::clear_supports_batched_status_updates() {
+  supports_batched_status_updates_ = false;
+  _clear_bit(3);
+}
+inline bool ReregisterFrameworkMessage::supports_batched_status_updates() const {
+  return supports_batched_status_updates_;
+}
+inline void ReregisterFrameworkMessage::set_supports_batched_status_updates(bool value) {
+  _set_bit(3);
+  supports_batched_status_updates_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // FrameworkRegisteredMessage
@@ -5352,6 +5795,111 @@ inline ::mesos::TaskDescription* RunTaskMessage::mutable_task() {
 
 // -------------------------------------------------------------------
 
+// RunTasksMessage
+
+// required .mesos.FrameworkID framework_id = 1;
+inline bool RunTasksMessage::has_framework_id() const {
+  return _has_bit(0);
+}
+inline void RunTasksMessage::clear_framework_id() {
+  if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
+  _clear_bit(0);
+}
+inline const ::mesos::FrameworkID& RunTasksMessage::framework_id() const {
+  return framework_id_ != NULL ? *framework_id_ : *default_instance_->framework_id_;
+}
+inline ::mesos::FrameworkID* RunTasksMessage::mutable_framework_id() {
+  _set_bit(0);
+  if (framework_id_ == NULL) framework_id_ = new ::mesos::FrameworkID;
+  return framework_id_;
+}
+
+// required .mesos.FrameworkInfo framework = 2;
+inline bool RunTasksMessage::has_framework() const {
+  return _has_bit(1);
+}
+inline void RunTasksMessage::clear_framework() {
+  if (framework_ != NULL) framework_->::mesos::FrameworkInfo::Clear();
+  _clear_bit(1);
+}
+inline const ::mesos::FrameworkInfo& RunTasksMessage::framework() const {
+  return framework_ != NULL ? *framework_ : *default_instance_->framework_;
+}
+inline ::mesos::FrameworkInfo* RunTasksMessage::mutable_framework() {
+  _set_bit(1);
+  if (framework_ == NULL) framework_ = new ::mesos::FrameworkInfo;
+  return framework_;
+}
+
+// required string pid = 3;
+inline bool RunTasksMessage::has_pid() const {
+  return _has_bit(2);
+}
+inline void RunTasksMessage::clear_pid() {
+  if (pid_ != &_default_pid_) {
+    pid_->clear();
+  }
+  _clear_bit(2);
+}
+inline const ::std::string& RunTasksMessage::pid() const {
+  return *pid_;
+}
+inline void RunTasksMessage::set_pid(const ::std::string& value) {
+  _set_bit(2);
+  if (pid_ == &_default_pid_) {
+    pid_ = new ::std::string;
+  }
+  pid_->assign(value);
+}
+inline void RunTasksMessage::set_pid(const char* value) {
+  _set_bit(2);
+  if (pid_ == &_default_pid_) {
+    pid_ = new ::std::string;
+  }
+  pid_->assign(value);
+}
+inline void RunTasksMessage::set_pid(const char* value, size_t size) {
+  _set_bit(2);
+  if (pid_ == &_default_pid_) {
+    pid_ = new ::std::string;
+  }
+  pid_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* RunTasksMessage::mutable_pid() {
+  _set_bit(2);
+  if (pid_ == &_default_pid_) {
+    pid_ = new ::std::string;
+  }
+  return pid_;
+}
+
+// repeated .mesos.TaskDescription tasks = 4;
+inline int RunTasksMessage::tasks_size() const {
+  return tasks_.size();
+}
+inline void RunTasksMessage::clear_tasks() {
+  tasks_.Clear();
+}
+inline const ::mesos::TaskDescription& RunTasksMessage::tasks(int index) const {
+  return tasks_.Get(index);
+}
+inline ::mesos::TaskDescription* RunTasksMessage::mutable_tasks(int index) {
+  return tasks_.Mutable(index);
+}
+inline ::mesos::TaskDescription* RunTasksMessage::add_tasks() {
+  return tasks_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mesos::TaskDescription >&
+RunTasksMessage::tasks() const {
+  return tasks_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::mesos::TaskDescription >*
+RunTasksMessage::mutable_tasks() {
+  return &tasks_;
+}
+
+// -------------------------------------------------------------------
+
 // KillTaskMessage
 
 // required .mesos.FrameworkID framework_id = 1;
@@ -5550,6 +6098,186 @@ inline ::std::string* StatusUpdateAcknowledgementMessage::mutable_uuid() {
 
 // -------------------------------------------------------------------
 
+// StatusUpdatesMessage
+
+// repeated .mesos.internal.StatusUpdate updates = 1;
+inline int StatusUpdatesMessage::updates_size() const {
+  return updates_.size();
+}
+inline void StatusUpdatesMessage::clear_updates() {
+  updates_.Clear();
+}
+inline const ::mesos::internal::StatusUpdate& StatusUpdatesMessage::updates(int index) const {
+  return updates_.Get(index);
+}
+inline ::mesos::internal::StatusUpdate* StatusUpdatesMessage::mutable_updates(int index) {
+  return updates_.Mutable(index);
+}
+inline ::mesos::internal::StatusUpdate* StatusUpdatesMessage::add_updates() {
+  return updates_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mesos::internal::StatusUpdate >&
+StatusUpdatesMessage::updates() const {
+  return updates_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::mesos::internal::StatusUpdate >*
+StatusUpdatesMessage::mutable_updates() {
+  return &updates_;
+}
+
+// repeated string pids = 2;
+inline int StatusUpdatesMessage::pids_size() const {
+  return pids_.size();
+}
+inline void StatusUpdatesMessage::clear_pids() {
+  pids_.Clear();
+}
+inline const ::std::string& StatusUpdatesMessage::pids(int index) const {
+  return pids_.Get(index);
+}
+inline ::std::string* StatusUpdatesMessage::mutable_pids(int index) {
+  return pids_.Mutable(index);
+}
+inline void StatusUpdatesMessage::set_pids(int index, const ::std::string& value) {
+  pids_.Mutable(index)->assign(value);
+}
+inline void StatusUpdatesMessage::set_pids(int index, const char* value) {
+  pids_.Mutable(index)->assign(value);
+}
+inline void StatusUpdatesMessage::set_pids(int index, const char* value, size_t size) {
+  pids_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* StatusUpdatesMessage::add_pids() {
+  return pids_.Add();
+}
+inline void StatusUpdatesMessage::add_pids(const ::std::string& value) {
+  pids_.Add()->assign(value);
+}
+inline void StatusUpdatesMessage::add_pids(const char* value) {
+  pids_.Add()->assign(value);
+}
+inline void StatusUpdatesMessage::add_pids(const char* value, size_t size) {
+  pids_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+StatusUpdatesMessage::pids() const {
+  return pids_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+StatusUpdatesMessage::mutable_pids() {
+  return &pids_;
+}
+
+// -------------------------------------------------------------------
+
+// StatusUpdateAcknowledgementsMessage
+
+// required .mesos.SlaveID slave_id = 1;
+inline bool StatusUpdateAcknowledgementsMessage::has_slave_id() const {
+  return _has_bit(0);
+}
+inline void StatusUpdateAcknowledgementsMessage::clear_slave_id() {
+  if (slave_id_ != NULL) slave_id_->::mesos::SlaveID::Clear();
+  _clear_bit(0);
+}
+inline const ::mesos::SlaveID& StatusUpdateAcknowledgementsMessage::slave_id() const {
+  return slave_id_ != NULL ? *slave_id_ : *default_instance_->slave_id_;
+}
+inline ::mesos::SlaveID* StatusUpdateAcknowledgementsMessage::mutable_slave_id() {
+  _set_bit(0);
+  if (slave_id_ == NULL) slave_id_ = new ::mesos::SlaveID;
+  return slave_id_;
+}
+
+// required .mesos.FrameworkID framework_id = 2;
+inline bool StatusUpdateAcknowledgementsMessage::has_framework_id() const {
+  return _has_bit(1);
+}
+inline void StatusUpdateAcknowledgementsMessage::clear_framework_id() {
+  if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
+  _clear_bit(1);
+}
+inline const ::mesos::FrameworkID& StatusUpdateAcknowledgementsMessage::framework_id() const {
+  return framework_id_ != NULL ? *framework_id_ : *default_instance_->framework_id_;
+}
+inline ::mesos::FrameworkID* StatusUpdateAcknowledgementsMessage::mutable_framework_id() {
+  _set_bit(1);
+  if (framework_id_ == NULL) framework_id_ = new ::mesos::FrameworkID;
+  return framework_id_;
+}
+
+// repeated .mesos.TaskID task_ids = 3;
+inline int StatusUpdateAcknowledgementsMessage::task_ids_size() const {
+  return task_ids_.size();
+}
+inline void StatusUpdateAcknowledgementsMessage::clear_task_ids() {
+  task_ids_.Clear();
+}
+inline const ::mesos::TaskID& StatusUpdateAcknowledgementsMessage::task_ids(int index) const {
+  return task_ids_.Get(index);
+}
+inline ::mesos::TaskID* StatusUpdateAcknowledgementsMessage::mutable_task_ids(int index) {
+  return task_ids_.Mutable(index);
+}
+inline ::mesos::TaskID* StatusUpdateAcknowledgementsMessage::add_task_ids() {
+  return task_ids_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mesos::TaskID >&
+StatusUpdateAcknowledgementsMessage::task_ids() const {
+  return task_ids_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::mesos::TaskID >*
+StatusUpdateAcknowledgementsMessage::mutable_task_ids() {
+  return &task_ids_;
+}
+
+// repeated bytes uuids = 4;
+inline int StatusUpdateAcknowledgementsMessage::uuids_size() const {
+  return uuids_.size();
+}
+inline void StatusUpdateAcknowledgementsMessage::clear_uuids() {
+  uuids_.Clear();
+}
+inline const ::std::string& StatusUpdateAcknowledgementsMessage::uuids(int index) const {
+  return uuids_.Get(index);
+}
+inline ::std::string* StatusUpdateAcknowledgementsMessage::mutable_uuids(int index) {
+  return uuids_.Mutable(index);
+}
+inline void StatusUpdateAcknowledgementsMessage::set_uuids(int index, const ::std::string& value) {
+  uuids_.Mutable(index)->assign(value);
+}
+inline void StatusUpdateAcknowledgementsMessage::set_uuids(int index, const char* value) {
+  uuids_.Mutable(index)->assign(value);
+}
+inline void StatusUpdateAcknowledgementsMessage::set_uuids(int index, const void* value, size_t size) {
+  uuids_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* StatusUpdateAcknowledgementsMessage::add_uuids() {
+  return uuids_.Add();
+}
+inline void StatusUpdateAcknowledgementsMessage::add_uuids(const ::std::string& value) {
+  uuids_.Add()->assign(value);
+}
+inline void StatusUpdateAcknowledgementsMessage::add_uuids(const char* value) {
+  uuids_.Add()->assign(value);
+}
+inline void StatusUpdateAcknowledgementsMessage::add_uuids(const void* value, size_t size) {
+  uuids_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+StatusUpdateAcknowledgementsMessage::uuids() const {
+  return uuids_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+StatusUpdateAcknowledgementsMessage::mutable_uuids() {
+  return &uuids_;
+}
+
+// -------------------------------------------------------------------
+
 // LostSlaveMessage
 
 // required .mesos.SlaveID slave_id = 1;
@@ -5652,6 +6380,38 @@ inline ::mesos::SlaveInfo* RegisterSlaveMessage::mutable_slave() {
   return slave_;
 }
 
+// optional bool supports_run_tasks = 2 [default = false];
+inline bool RegisterSlaveMessage::has_supports_run_tasks() const {
+  return _has_bit(1);
+}
+inline void RegisterSlaveMessage::clear_supports_run_tasks() {
+  supports_run_tasks_ = false;
+  _clear_bit(1);
+}
+inline bool RegisterSlaveMessage::supports_run_tasks() const {
+  return supports_run_tasks_;
+}
+inline void RegisterSlaveMessage::set_supports_run_tasks(bool value) {
+  _set_bit(1);
+  supports_run_tasks_ = value;
+}
+
+// optional bool supports_status_update_acknowledgements = 3 [default = false];
+inline bool RegisterSlaveMessage::has_supports_status_update_acknowledgements() const {
+  return _has_bit(2);
+}
+inline void RegisterSlaveMessage::clear_supports_status_update_acknowledgements() {
+  supports_status_update_acknowledgements_ = false;
+  _clear_bit(2);
+}
+inline bool RegisterSlaveMessage::supports_status_update_acknowledgements() const {
+  return supports_status_update_acknowledgements_;
+}
+inline void RegisterSlaveMessage::set_supports_status_update_acknowledgements(bool value) {
+  _set_bit(2);
+  supports_status_update_acknowledgements_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // ReregisterSlaveMessage
@@ -5740,6 +6500,38 @@ ReregisterSlaveMessage::mutable_tasks() {
   return &tasks_;
 }
 
+// optional bool supports_run_tasks = 5 [default = false];
+inline bool ReregisterSlaveMessage::has_supports_run_tasks() const {
+  return _has_bit(4);
+}
+inline void ReregisterSlaveMessage::clear_supports_run_tasks() {
+  supports_run_tasks_ = false;
+  _clear_bit(4);
+}
+inline bool ReregisterSlaveMessage::supports_run_tasks() const {
+  return supports_run_tasks_;
+}
+inline void ReregisterSlaveMessage::set_supports_run_tasks(bool value) {
+  _set_bit(4);
+  supports_run_tasks_ = value;
+}
+
+// optional bool supports_status_update_acknowledgements = 6 [default = false];
+inline bool ReregisterSlaveMessage::has_supports_status_update_acknowledgements() const {
+  return _has_bit(5);
+}
+inline void ReregisterSlaveMessage::clear_supports_status_update_acknowledgements() {
+  supports_status_update_acknowledgements_ = false;
+  _clear_bit(5);
+}
+inline bool ReregisterSlaveMessage::supports_status_update_acknowledgements() const {
+  return supports_status_update_acknowledgements_;
+}
+inline void ReregisterSlaveMessage::set_supports_status_update_acknowledgements(bool value) {
+  _set_bit(5);
+  supports_status_update_acknowledgements_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // SlaveRegisteredMessage
@@ -121,6 +121,11 @@ public:
         &StatusUpdateMessage::update,
         &StatusUpdateMessage::pid);
 
+    installProtobufHandler<StatusUpdatesMessage>(
+        &SchedulerProcess::statusUpdates,
+        &StatusUpdatesMessage::updates,
+        &StatusUpdatesMessage::pids);
+
     installProtobufHandler<LostSlaveMessage>(
         &SchedulerProcess::lostSlave,
         &LostSlaveMessage::slave_id);
@@ -198,6 +203,7 @@ protected:
       // Touched for the very first time.
       RegisterFrameworkMessage message;
       message.mutable_framework()->MergeFrom(framework);
+      message.set_supports_batched_status_updates(true);
       send(master, message);
     } else {
       // Not the first time, or failing over.
@@ -205,6 +211,7 @@ protected:
       message.mutable_framework()->MergeFrom(framework);
       message.mutable_framework_id()->MergeFrom(frameworkId);
       message.set_failover(failover);
+      message.set_supports_batched_status_updates(true);
       send(master, message);
     }
 
@@ -295,6 +302,54 @@ protected:
     }
   }
 
+  void statusUpdates(const vector<StatusUpdate>& updates,
+                     const vector<string>& pids)
+  {
+    if (aborted) {
+      VLOG(1) << "Ignoring task status updates message because "
+              << "the driver is aborted!";
+      return;
+    }
+
+    if (updates.size() != pids.size()) {
+      LOG(WARNING) << "Ignoring malformed status updates from " << from();
+      return;
+    }
+
+    VLOG(1) << "Received " << updates.size() << " status updates";
+
+    vector<TaskStatus> statuses;
+
+    // Acknowledge the updates with one message per slave.
+    map<string, StatusUpdateAcknowledgementsMessage> messages;
+
+    for (size_t i = 0; i < updates.size(); i++) {
+      const StatusUpdate& update = updates[i];
+
+      CHECK(frameworkId == update.framework_id());
+
+      statuses.push_back(update.status());
+
+      if (pids[i] != "") {
+        StatusUpdateAcknowledgementsMessage& message = messages[pids[i]];
+        message.mutable_framework_id()->MergeFrom(frameworkId);
+        message.mutable_slave_id()->MergeFrom(update.slave_id());
+        message.add_task_ids()->MergeFrom(update.status().task_id());
+        message.add_uuids(update.uuid());
+      }
+    }
+
+    // See the comments in statusUpdate about duplicates and why we
+    // acknowledge after invoking the scheduler.
+    invoke(bind(&Scheduler::statusUpdates, sched, driver, statuses));
+
+    foreachpair (const string& pid,
+                 const StatusUpdateAcknowledgementsMessage& message,
+                 messages) {
+      send(UPID(pid), message);
+    }
+  }
+
   void lostSlave(const SlaveID& slaveId)
   {
     if (aborted) {
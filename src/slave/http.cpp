@@ -1,11 +1,15 @@
 #include <iomanip>
+#include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "common/build.hpp"
 #include "common/foreach.hpp"
+#include "common/hashset.hpp"
 #include "common/json.hpp"
 #include "common/resources.hpp"
+#include "common/strings.hpp"
 #include "common/type_utils.hpp"
 #include "common/utils.hpp"
 
@@ -17,6 +21,7 @@ using process::HttpRequest;
 using process::Promise;
 
 using std::string;
+using std::vector;
 
 
 namespace mesos {
@@ -27,69 +32,111 @@ namespace slave {
 // that it can be shared between slave/http.cpp and master/http.cpp.
 
 
-// Returns a JSON object modeled on a Resources.
-JSON::Object model(const Resources& resources)
+// Writes a JSON object modeled on a Resources.
+void model(JSON::Writer* writer, const Resources& resources)
 {
   // TODO(benh): Add all of the resources.
   Resource::Scalar none;
   Resource::Scalar cpus = resources.get("cpus", none);
   Resource::Scalar mem = resources.get("mem", none);
 
-  JSON::Object object;
-  object.values["cpus"] = cpus.value();
-  object.values["mem"] = mem.value();
-
-  return object;
+  writer->beginObject();
+  writer->field("cpus");
+  writer->value(cpus.value());
+  writer->field("mem");
+  writer->value(mem.value());
+  writer->endObject();
 }
 
 
-JSON::Object model(const Executor& executor)
+void model(JSON::Writer* writer, const Executor& executor)
 {
-  JSON::Object object;
-  object.values["id"] = executor.id.value();
-  object.values["uri"] = executor.info.uri();
-  object.values["directory"] = executor.directory;
-  object.values["resources"] = model(executor.resources);
-
-  JSON::Array array;
+  writer->beginObject();
+  writer->field("id");
+  writer->value(executor.id.value());
+  writer->field("uri");
+  writer->value(executor.info.uri());
+  writer->field("directory");
+  writer->value(executor.directory);
+  writer->field("resources");
+  model(writer, executor.resources);
+
+  writer->field("tasks");
+  writer->beginArray();
 
   // TODO(benh): Send queued tasks also.
   foreachvalue (Task* task, executor.launchedTasks) {
-    JSON::Object object;
-    object.values["id"] = task->task_id().value();
-    object.values["name"] = task->name();
-    object.values["framework_id"] = task->framework_id().value();
-    object.values["slave_id"] = task->slave_id().value();
-    object.values["state"] = TaskState_Name(task->state());
-    object.values["resources"] = model(task->resources());
-
-    array.values.push_back(object);
+    writer->beginObject();
+    writer->field("id");
+    writer->value(task->task_id().value());
+    writer->field("name");
+    writer->value(task->name());
+    writer->field("framework_id");
+    writer->value(task->framework_id().value());
+    writer->field("slave_id");
+    writer->value(task->slave_id().value());
+    writer->field("state");
+    writer->value(TaskState_Name(task->state()));
+    writer->field("resources");
+    model(writer, task->resources());
+    writer->endObject();
   }
 
-  object.values["tasks"] = array;
+  writer->endArray();
 
-  return object;
+  writer->endObject();
 }
 
 
-// Returns a JSON object modeled after a Framework.
-JSON::Object model(const Framework& framework)
+// Writes a JSON object modeled after a Framework.
+void model(JSON::Writer* writer, const Framework& framework)
 {
-  JSON::Object object;
-  object.values["id"] = framework.id.value();
-  object.values["name"] = framework.info.name();
-  object.values["user"] = framework.info.user();
-
-  JSON::Array array;
+  writer->beginObject();
+  writer->field("id");
+  writer->value(framework.id.value());
+  writer->field("name");
+  writer->value(framework.info.name());
+  writer->field("user");
+  writer->value(framework.info.user());
 
   // Model all of the executors.
+  writer->field("executors");
+  writer->beginArray();
   foreachvalue (Executor* executor, framework.executors) {
-    array.values.push_back(model(*executor));
+    model(writer, *executor);
   }
+  writer->endArray();
+
+  writer->endObject();
+}
 
-  object.values["executors"] = array;
 
-  return object;
+// Returns the fields asked for in the query of a request (e.g.,
+// "fields=id,frameworks"), or an empty set if there were none (i.e.,
+// all fields are wanted).
+static hashset<string> fields(const HttpRequest& request)
+{
+  hashset<string> result;
+
+  std::map<string, vector<string> > pairs =
+    strings::pairs(request.query, '&', '=');
+
+  if (pairs.count("fields") > 0) {
+    foreach (const string& value, pairs["fields"]) {
+      foreach (const string& field, strings::split(value, ",")) {
+        result.insert(field);
+      }
+    }
+  }
+
+  return result;
+}
+
+
+// Returns true if a field was asked for (see fields above).
+static bool contains(const hashset<string>& fields, const string& field)
+{
+  return fields.empty() || fields.contains(field);
 }
 
 
@@ -163,31 +210,57 @@ Promise<HttpResponse> state(
 {
   LOG(INFO) << "HTTP request for '" << request.path << "'";
 
-  JSON::Object object;
-  object.values["build_date"] = build::DATE;
-  object.values["build_user"] = build::USER;
-  object.values["start_time"] = slave.startTime;
-  object.values["id"] = slave.id.value();
-  object.values["pid"] = string(slave.self());
-  object.values["resources"] = model(slave.resources);
+  const hashset<string>& wanted = fields(request);
 
-  JSON::Array array;
+  HttpOKResponse response;
 
-  // Model all of the frameworks.
-  foreachvalue (Framework* framework, slave.frameworks) {
-    array.values.push_back(model(*framework));
+  JSON::Writer writer(&response.body);
+  writer.beginObject();
+
+  if (contains(wanted, "build_date")) {
+    writer.field("build_date");
+    writer.value(build::DATE);
   }
 
-  object.values["frameworks"] = array;
+  if (contains(wanted, "build_user")) {
+    writer.field("build_user");
+    writer.value(build::USER);
+  }
 
-  std::ostringstream out;
+  if (contains(wanted, "start_time")) {
+    writer.field("start_time");
+    writer.value(slave.startTime);
+  }
 
-  JSON::render(out, object);
+  if (contains(wanted, "id")) {
+    writer.field("id");
+    writer.value(slave.id.value());
+  }
+
+  if (contains(wanted, "pid")) {
+    writer.field("pid");
+    writer.value(string(slave.self()));
+  }
+
+  if (contains(wanted, "resources")) {
+    writer.field("resources");
+    model(&writer, slave.resources);
+  }
+
+  // Model all of the frameworks.
+  if (contains(wanted, "frameworks")) {
+    writer.field("frameworks");
+    writer.beginArray();
+    foreachvalue (Framework* framework, slave.frameworks) {
+      model(&writer, *framework);
+    }
+    writer.endArray();
+  }
+
+  writer.endObject();
 
-  HttpOKResponse response;
   response.headers["Content-Type"] = "text/x-json";
-  response.headers["Content-Length"] = utils::stringify(out.str().size());
-  response.body = out.str().data();
+  response.headers["Content-Length"] = utils::stringify(response.body.size());
   return response;
 }
 
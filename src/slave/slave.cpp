@@ -33,6 +33,7 @@
 namespace params = std::tr1::placeholders;
 
 using std::string;
+using std::vector;
 
 using process::wait; // Necessary on some OS's to disambiguate.
 
@@ -144,6 +145,12 @@ void Slave::registerOptions(Configurator* configurator)
       "executor_shutdown_timeout_seconds",
       "Amount of time (in seconds) to wait for an executor to shut down\n",
       EXECUTOR_SHUTDOWN_TIMEOUT_SECONDS);
+
+  configurator->addOption<double>(
+      "status_update_batch_interval",
+      "Amount of time (in seconds) to batch up status updates\n"
+      "before sending them to the master (0 disables batching)",
+      0.0);
 }
 
 
@@ -166,6 +173,9 @@ void Slave::initialize()
   startTime = elapsedTime();
   connected = false;
 
+  statusUpdateBatchInterval =
+    conf.get<double>("status_update_batch_interval", 0.0);
+
   // Install protobuf handlers.
   installProtobufHandler<NewMasterDetectedMessage>(
       &Slave::newMasterDetected,
@@ -189,6 +199,13 @@ void Slave::initialize()
       &RunTaskMessage::pid,
       &RunTaskMessage::task);
 
+  installProtobufHandler<RunTasksMessage>(
+      &Slave::runTasks,
+      &RunTasksMessage::framework,
+      &RunTasksMessage::framework_id,
+      &RunTasksMessage::pid,
+      &RunTasksMessage::tasks);
+
   installProtobufHandler<KillTaskMessage>(
       &Slave::killTask,
       &KillTaskMessage::framework_id,
@@ -217,6 +234,13 @@ void Slave::initialize()
       &StatusUpdateAcknowledgementMessage::task_id,
       &StatusUpdateAcknowledgementMessage::uuid);
 
+  installProtobufHandler<StatusUpdateAcknowledgementsMessage>(
+      &Slave::statusUpdateAcknowledgements,
+      &StatusUpdateAcknowledgementsMessage::slave_id,
+      &StatusUpdateAcknowledgementsMessage::framework_id,
+      &StatusUpdateAcknowledgementsMessage::task_ids,
+      &StatusUpdateAcknowledgementsMessage::uuids);
+
   installProtobufHandler<RegisterExecutorMessage>(
       &Slave::registerExecutor,
       &RegisterExecutorMessage::framework_id,
@@ -365,12 +389,16 @@ void Slave::doReliableRegistration()
     // (Vinod): Is the above comment true?
     RegisterSlaveMessage message;
     message.mutable_slave()->MergeFrom(info);
+    message.set_supports_run_tasks(true);
+    message.set_supports_status_update_acknowledgements(true);
     send(master, message);
   } else {
     // Re-registering, so send tasks running.
     ReregisterSlaveMessage message;
     message.mutable_slave_id()->MergeFrom(id);
     message.mutable_slave()->MergeFrom(info);
+    message.set_supports_run_tasks(true);
+    message.set_supports_status_update_acknowledgements(true);
 
     foreachvalue (Framework* framework, frameworks) {
       foreachvalue (Executor* executor, framework->executors) {
@@ -404,52 +432,67 @@ void Slave::runTask(const FrameworkInfo& frameworkInfo,
     frameworks[frameworkId] = framework;
   }
 
-  const ExecutorInfo& executorInfo = task.has_executor()
-    ? task.executor()
-    : framework->info.executor();
+  Executor* executor = assignTask(framework, task);
 
-  const ExecutorID& executorId = executorInfo.executor_id();
+  if (executor != NULL) {
+    // Update the resources.
+    // TODO(Charles Reiss): The isolation module is not guaranteed to update
+    // the resources before the executor acts on its RunTaskMessage.
+    dispatch(isolationModule,
+             &IsolationModule::resourcesChanged,
+             framework->id, executor->id, executor->resources);
 
-  // Either send the task to an executor or start a new executor
-  // and queue the task until the executor has started.
-  Executor* executor = framework->getExecutor(executorId);
+    RunTaskMessage message;
+    message.mutable_framework()->MergeFrom(framework->info);
+    message.mutable_framework_id()->MergeFrom(framework->id);
+    message.set_pid(framework->pid);
+    message.mutable_task()->MergeFrom(task);
+    send(executor->pid, message);
+  }
+}
 
-  if (executor != NULL) {
-    if (executor->shutdown) {
-      LOG(WARNING) << "WARNING! Asked to run task '" << task.task_id()
-                   << "' for framework " << frameworkId
-                   << " with executor '" << executorId
-                   << "' which is being shut down";
 
-      StatusUpdateMessage message;
-      StatusUpdate* update = message.mutable_update();
-      update->mutable_framework_id()->MergeFrom(frameworkId);
-      update->mutable_slave_id()->MergeFrom(id);
-      TaskStatus* status = update->mutable_status();
-      status->mutable_task_id()->MergeFrom(task.task_id());
-      status->set_state(TASK_LOST);
-      update->set_timestamp(elapsedTime());
-      update->set_uuid(UUID::random().toBytes());
-      send(master, message);
-    } else if (!executor->pid) {
-      // Queue task until the executor starts up.
-      LOG(INFO) << "Queuing task '" << task.task_id()
-                << "' for executor " << executorId
-                << " of framework '" << frameworkId;
-      executor->queuedTasks[task.task_id()] = task;
-    } else {
-      // Add the task and send it to the executor.
-      executor->addTask(task);
+void Slave::runTasks(const FrameworkInfo& frameworkInfo,
+                     const FrameworkID& frameworkId,
+                     const string& pid,
+                     const vector<TaskDescription>& tasks)
+{
+  LOG(INFO) << "Got assigned " << tasks.size()
+            << " tasks for framework " << frameworkId;
 
-      stats.tasks[TASK_STARTING]++;
+  Framework* framework = getFramework(frameworkId);
+  if (framework == NULL) {
+    framework = new Framework(frameworkId, frameworkInfo, pid);
+    frameworks[frameworkId] = framework;
+  }
+
+  // Group the tasks for running executors so that each executor only
+  // gets its resources changed once for the entire batch.
+  hashmap<ExecutorID, vector<TaskDescription> > running;
+
+  foreach (const TaskDescription& task, tasks) {
+    VLOG(1) << "Got assigned task " << task.task_id()
+            << " for framework " << frameworkId;
+
+    Executor* executor = assignTask(framework, task);
+    if (executor != NULL) {
+      running[executor->id].push_back(task);
+    }
+  }
 
-      // Update the resources.
-      // TODO(Charles Reiss): The isolation module is not guaranteed to update
-      // the resources before the executor acts on its RunTaskMessage.
-      dispatch(isolationModule,
-               &IsolationModule::resourcesChanged,
-               framework->id, executor->id, executor->resources);
+  foreachpair (const ExecutorID& executorId,
+               const vector<TaskDescription>& tasks,
+               running) {
+    Executor* executor = framework->getExecutor(executorId);
+    CHECK(executor != NULL);
+
+    // TODO(Charles Reiss): The isolation module is not guaranteed to update
+    // the resources before the executor acts on its RunTaskMessage.
+    dispatch(isolationModule,
+             &IsolationModule::resourcesChanged,
+             framework->id, executor->id, executor->resources);
 
+    foreach (const TaskDescription& task, tasks) {
       RunTaskMessage message;
       message.mutable_framework()->MergeFrom(framework->info);
       message.mutable_framework_id()->MergeFrom(framework->id);
@@ -457,27 +500,6 @@ void Slave::runTask(const FrameworkInfo& frameworkInfo,
       message.mutable_task()->MergeFrom(task);
       send(executor->pid, message);
     }
-  } else {
-    // Launch an executor for this task.
-    const string& directory = createUniqueWorkDirectory(framework->id,
-                                                        executorId);
-
-    LOG(INFO) << "Using '" << directory
-              << "' as work directory for executor '" << executorId
-              << "' of framework " << framework->id;
-
-    executor = framework->createExecutor(executorInfo, directory);
-
-    // Queue task until the executor starts up.
-    executor->queuedTasks[task.task_id()] = task;
-
-    // Tell the isolation module to launch the executor. (TODO(benh):
-    // Make the isolation module a process so that it can block while
-    // trying to launch the executor.)
-    dispatch(isolationModule,
-             &IsolationModule::launchExecutor,
-             framework->id, framework->info, executor->info,
-             directory, executor->resources);
   }
 }
 
@@ -648,6 +670,23 @@ void Slave::statusUpdateAcknowledgement(const SlaveID& slaveId,
 }
 
 
+void Slave::statusUpdateAcknowledgements(const SlaveID& slaveId,
+                                         const FrameworkID& frameworkId,
+                                         const vector<TaskID>& taskIds,
+                                         const vector<string>& uuids)
+{
+  if (taskIds.size() != uuids.size()) {
+    LOG(WARNING) << "Ignoring malformed status update acknowledgements"
+                 << " from framework " << frameworkId;
+    return;
+  }
+
+  for (size_t i = 0; i < taskIds.size(); i++) {
+    statusUpdateAcknowledgement(slaveId, frameworkId, taskIds[i], uuids[i]);
+  }
+}
+
+
 void Slave::registerExecutor(const FrameworkID& frameworkId,
                              const ExecutorID& executorId)
 {
@@ -749,11 +788,20 @@ void Slave::statusUpdate(const StatusUpdate& update)
                  framework->id, executor->id, executor->resources);
       }
 
-      // Send message and record the status for possible resending.
-      StatusUpdateMessage message;
-      message.mutable_update()->MergeFrom(update);
-      message.set_pid(self());
-      send(master, message);
+      // Send message (or add it to the next batch) and record the
+      // status for possible resending.
+      if (statusUpdateBatchInterval > 0) {
+        if (pendingUpdates.updates_size() == 0) {
+          delay(statusUpdateBatchInterval, self(), &Slave::flushStatusUpdates);
+        }
+        pendingUpdates.add_updates()->MergeFrom(update);
+        pendingUpdates.add_pids(self());
+      } else {
+        StatusUpdateMessage message;
+        message.mutable_update()->MergeFrom(update);
+        message.set_pid(self());
+        send(master, message);
+      }
 
       UUID uuid = UUID::fromBytes(update.uuid());
 
@@ -837,6 +885,17 @@ void Slave::statusUpdateTimeout(
 }
 
 
+void Slave::flushStatusUpdates()
+{
+  if (pendingUpdates.updates_size() > 0) {
+    LOG(INFO) << "Sending " << pendingUpdates.updates_size()
+              << " status updates to master";
+    send(master, pendingUpdates);
+    pendingUpdates.Clear();
+  }
+}
+
+
 void Slave::exited()
 {
   LOG(INFO) << "Process exited: " << from();
@@ -859,6 +918,77 @@ Framework* Slave::getFramework(const FrameworkID& frameworkId)
 }
 
 
+Executor* Slave::assignTask(Framework* framework,
+                            const TaskDescription& task)
+{
+  const ExecutorInfo& executorInfo = task.has_executor()
+    ? task.executor()
+    : framework->info.executor();
+
+  const ExecutorID& executorId = executorInfo.executor_id();
+
+  // Either send the task to an executor or start a new executor
+  // and queue the task until the executor has started.
+  Executor* executor = framework->getExecutor(executorId);
+
+  if (executor != NULL) {
+    if (executor->shutdown) {
+      LOG(WARNING) << "WARNING! Asked to run task '" << task.task_id()
+                   << "' for framework " << framework->id
+                   << " with executor '" << executorId
+                   << "' which is being shut down";
+
+      StatusUpdateMessage message;
+      StatusUpdate* update = message.mutable_update();
+      update->mutable_framework_id()->MergeFrom(framework->id);
+      update->mutable_slave_id()->MergeFrom(id);
+      TaskStatus* status = update->mutable_status();
+      status->mutable_task_id()->MergeFrom(task.task_id());
+      status->set_state(TASK_LOST);
+      update->set_timestamp(elapsedTime());
+      update->set_uuid(UUID::random().toBytes());
+      send(master, message);
+    } else if (!executor->pid) {
+      // Queue task until the executor starts up.
+      LOG(INFO) << "Queuing task '" << task.task_id()
+                << "' for executor " << executorId
+                << " of framework '" << framework->id;
+      executor->queuedTasks[task.task_id()] = task;
+    } else {
+      // Add the task, the caller sends it to the executor.
+      executor->addTask(task);
+
+      stats.tasks[TASK_STARTING]++;
+
+      return executor;
+    }
+  } else {
+    // Launch an executor for this task.
+    const string& directory = createUniqueWorkDirectory(framework->id,
+                                                        executorId);
+
+    LOG(INFO) << "Using '" << directory
+              << "' as work directory for executor '" << executorId
+              << "' of framework " << framework->id;
+
+    executor = framework->createExecutor(executorInfo, directory);
+
+    // Queue task until the executor starts up.
+    executor->queuedTasks[task.task_id()] = task;
+
+    // Tell the isolation module to launch the executor. (TODO(benh):
+    // Make the isolation module a process so that it can block while
+    // trying to launch the executor.)
+    dispatch(isolationModule,
+             &IsolationModule::launchExecutor,
+             framework->id, framework->info, executor->info,
+             directory, executor->resources);
+  }
+
+  return NULL;
+}
+
+
 // N.B. When the slave is running in "local" mode then the pid is
 // uninteresting (and possibly could cause bugs).
 void Slave::executorStarted(const FrameworkID& frameworkId,
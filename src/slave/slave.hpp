@@ -70,6 +70,10 @@ public:
                const FrameworkID& frameworkId,
                const std::string& pid,
                const TaskDescription& task);
+  void runTasks(const FrameworkInfo& frameworkInfo,
+                const FrameworkID& frameworkId,
+                const std::string& pid,
+                const std::vector<TaskDescription>& tasks);
   void killTask(const FrameworkID& frameworkId,
                 const TaskID& taskId);
   void shutdownFramework(const FrameworkID& frameworkId);
@@ -83,6 +87,10 @@ public:
                                    const FrameworkID& frameworkId,
                                    const TaskID& taskId,
                                    const std::string& uuid);
+  void statusUpdateAcknowledgements(const SlaveID& slaveId,
+                                    const FrameworkID& frameworkId,
+                                    const std::vector<TaskID>& taskIds,
+                                    const std::vector<std::string>& uuids);
   void registerExecutor(const FrameworkID& frameworkId,
                         const ExecutorID& executorId);
   void statusUpdate(const StatusUpdate& update);
@@ -95,6 +103,10 @@ public:
 
   void statusUpdateTimeout(const FrameworkID& frameworkId, const UUID& uuid);
 
+  // Sends any status updates that have been batched up (see
+  // --status_update_batch_interval) to the master.
+  void flushStatusUpdates();
+
   void executorStarted(const FrameworkID& frameworkId,
                        const ExecutorID& executorId,
                        pid_t pid);
@@ -111,6 +123,11 @@ protected:
   // Helper routine to lookup a framework.
   Framework* getFramework(const FrameworkID& frameworkId);
 
+  // Helper routine to hand a task to its executor (launching the
+  // executor, or queueing the task until it registers, if needed).
+  // Returns the executor if the task still needs to be sent to it.
+  Executor* assignTask(Framework* framework, const TaskDescription& task);
+
   // Shut down an executor. This is a two phase process. First, an
   // executor receives a shut down message (shut down phase), then
   // after a configurable timeout the slave actually forces a kill
@@ -179,6 +196,14 @@ private:
   double startTime;
 
   bool connected; // Flag to indicate if slave is registered.
+
+  // Amount of time (in seconds) to batch up status updates before
+  // sending them to the master (0 sends each one immediately).
+  double statusUpdateBatchInterval;
+
+  // Status updates waiting to be sent in the next batch.
+  StatusUpdatesMessage pendingUpdates;
+
 //   typedef std::pair<FrameworkID, TaskID> StatusUpdateStreamID;
 //   hashmap<std::pair<FrameworkID, TaskID>, StatusUpdateStream*> statusUpdateStreams;
 
@@ -0,0 +1,698 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <process/process.hpp>
+
+#include "common/resources.hpp"
+#include "common/utils.hpp"
+
+#include "configurator/configuration.hpp"
+
+#include "master/allocator.hpp"
+#include "master/drf_allocator.hpp"
+#include "master/master.hpp"
+#include "master/request_allocator.hpp"
+#include "master/simple_allocator.hpp"
+#include "master/slaves_manager.hpp"
+
+using namespace mesos;
+using namespace mesos::internal;
+
+using mesos::internal::master::Allocator;
+using mesos::internal::master::DRFAllocator;
+using mesos::internal::master::RequestAllocator;
+using mesos::internal::master::SimpleAllocator;
+
+using process::Clock;
+using process::UPID;
+
+using std::cout;
+using std::endl;
+using std::map;
+using std::string;
+using std::vector;
+
+
+namespace mesos { namespace internal { namespace master {
+
+// A master that never gets spawned, with its state exposed so that it
+// can be manipulated in place (see AllocatorBenchmark).
+class BenchmarkMaster : public Master
+{
+public:
+  BenchmarkMaster(Allocator* allocator, const Configuration& conf)
+    : Master(allocator, conf) {}
+
+  using Master::conf;
+  using Master::id;
+  using Master::slavesManager;
+  using Master::frameworks;
+  using Master::slaves;
+  using Master::offers;
+  using Master::stats;
+
+  using Master::newFrameworkId;
+  using Master::newSlaveId;
+};
+
+
+// Drives an allocator with a master that never gets spawned: the
+// frameworks and slaves get added to the master directly and every
+// offer the allocator makes gets turned into a task right away, which
+// keeps the cluster busy and lets us measure the time spent in the
+// allocator without any messaging. With 'requesting' set frameworks
+// instead only launch the tasks they requested resources for (see
+// AllocatorBenchmark::request) and decline everything else.
+class AllocatorBenchmark
+{
+public:
+  AllocatorBenchmark(Allocator* _allocator,
+                     bool _requesting = false,
+                     const Configuration& conf = Configuration())
+    : allocator(_allocator),
+      master(_allocator, conf),
+      time(0),
+      calls(0),
+      launched(0),
+      requesting(_requesting),
+      offered(0),
+      wasted(0)
+  {
+    master.id = "benchmark";
+    master.slavesManager = new SlavesManager(master.conf, master.self());
+    process::spawn(master.slavesManager);
+    allocator->initialize(&master);
+  }
+
+  ~AllocatorBenchmark()
+  {
+    // Clean up here since the master expects to have removed all of
+    // its frameworks and slaves while running.
+    foreachvalue (Offer* offer, master.offers) {
+      delete offer;
+    }
+
+    foreachvalue (Framework* framework, master.frameworks) {
+      foreachvalue (Task* task, framework->tasks) {
+        delete task;
+      }
+      delete framework;
+    }
+
+    foreachvalue (Slave* slave, master.slaves) {
+      delete slave;
+    }
+
+    master.offers.clear();
+    master.frameworks.clear();
+    master.slaves.clear();
+  }
+
+  // Returns the id of the new framework.
+  string addFramework()
+  {
+    FrameworkInfo info;
+    info.set_user("user");
+    info.set_name("framework");
+    info.mutable_executor()->mutable_executor_id()->set_value("default");
+    info.mutable_executor()->set_uri("noexecutor");
+
+    Framework* framework =
+      new Framework(info, master.newFrameworkId(), UPID(), 0);
+    master.frameworks[framework->id] = framework;
+
+    double start = Clock::now();
+    allocator->frameworkAdded(framework);
+    done(start);
+
+    return framework->id.value();
+  }
+
+  void addSlave(const Resources& resources)
+  {
+    SlaveInfo info;
+    info.set_hostname("localhost");
+    info.set_public_hostname("localhost");
+    info.mutable_resources()->MergeFrom(resources);
+
+    Slave* slave = new Slave(info, master.newSlaveId(), UPID(), 0);
+    master.slaves[slave->id] = slave;
+
+    double start = Clock::now();
+    allocator->slaveAdded(slave);
+    done(start);
+  }
+
+  // Finishes the task running on a slave and tells the allocator
+  // about its resources (every task uses all of the resources that
+  // were offered on a slave, so there is at most one per slave).
+  void finish(const string& slaveId)
+  {
+    SlaveID id;
+    id.set_value(slaveId);
+
+    Slave* slave = master.slaves[id];
+    CHECK(slave != NULL && slave->tasks.size() == 1);
+
+    finish(slave->tasks.begin()->second);
+  }
+
+  // Finishes a random task (if there are any).
+  void finish(unsigned int* seed)
+  {
+    vector<Task*> tasks;
+    foreachvalue (Framework* framework, master.frameworks) {
+      foreachvalue (Task* task, framework->tasks) {
+        tasks.push_back(task);
+      }
+    }
+
+    if (tasks.size() > 0) {
+      finish(tasks[rand_r(seed) % tasks.size()]);
+    }
+  }
+
+  // Requests resources for a single task on behalf of a framework.
+  void request(const string& frameworkId, const Resources& resources)
+  {
+    FrameworkID id;
+    id.set_value(frameworkId);
+
+    wanted[id].push_back(resources);
+
+    ResourceRequest request;
+    request.mutable_resources()->MergeFrom(resources);
+
+    double start = Clock::now();
+    allocator->resourcesRequested(id, vector<ResourceRequest>(1, request));
+    done(start);
+  }
+
+  void tick()
+  {
+    // Let any filters expire (the master does this on a tick too).
+    foreachvalue (Framework* framework, master.frameworks) {
+      framework->slaveFilter.clear();
+    }
+
+    double start = Clock::now();
+    allocator->timerTick();
+    done(start);
+  }
+
+  // Returns which framework is running a task on each slave.
+  map<string, string> assignments()
+  {
+    map<string, string> result;
+    foreachvalue (Framework* framework, master.frameworks) {
+      foreachvalue (Task* task, framework->tasks) {
+        result[task->slave_id().value()] = framework->id.value();
+      }
+    }
+    return result;
+  }
+
+  // Average time (in seconds) spent in the allocator per call.
+  double average() const
+  {
+    return calls > 0 ? time / calls : 0;
+  }
+
+  void reset()
+  {
+    time = 0;
+    calls = 0;
+    offered = 0;
+    wasted = 0;
+  }
+
+  // Number of offers made and how many of them got declined.
+  uint64_t offers() const { return offered; }
+  uint64_t declined() const { return wasted; }
+
+  // Allocation rounds (and slaves looked at in them) the allocator
+  // accounted for in the master's statistics.
+  uint64_t rounds() const { return master.stats.allocationRounds; }
+  uint64_t examined() const { return master.stats.allocationSlavesExamined; }
+
+private:
+  // Accounts for an allocator call and responds to each offer that
+  // the call made, either by launching a task with all the resources
+  // of the offer or (when requesting) by launching the requested
+  // tasks and declining the rest (which might cause more offers).
+  void done(double start)
+  {
+    time += Clock::now() - start;
+    calls++;
+
+    while (master.offers.size() > 0) {
+      foreachvalue (Offer* offer, utils::copy(master.offers)) {
+        offered++;
+
+        Framework* framework = master.frameworks[offer->framework_id()];
+        Slave* slave = master.slaves[offer->slave_id()];
+
+        Resources resources = offer->resources();
+
+        framework->removeOffer(offer);
+        slave->removeOffer(offer);
+        master.offers.erase(offer->id());
+        delete offer;
+
+        if (!requesting) {
+          launch(framework, slave, resources);
+          continue;
+        }
+
+        // Launch as many of the requested tasks as fit.
+        Resources unused = resources;
+        std::list<Resources>& pending = wanted[framework->id];
+        std::list<Resources>::iterator iterator = pending.begin();
+        while (iterator != pending.end()) {
+          if (*iterator <= unused) {
+            launch(framework, slave, *iterator);
+            unused -= *iterator;
+            pending.erase(iterator++);
+          } else {
+            ++iterator;
+          }
+        }
+
+        if (unused == resources) {
+          // Declined, filter the slave like the master does by default.
+          wasted++;
+          framework->slaveFilter[slave] = 0;
+        }
+
+        if (unused.allocatable().size() > 0) {
+          allocator->resourcesUnused(framework->id, slave->id, unused);
+        }
+      }
+    }
+  }
+
+  void launch(Framework* framework,
+              Slave* slave,
+              const Resources& resources)
+  {
+    Task* task = new Task();
+    task->set_name("");
+    task->mutable_task_id()->set_value(
+        "task-" + utils::stringify(launched++));
+    task->mutable_framework_id()->MergeFrom(framework->id);
+    task->mutable_executor_id()->set_value("default");
+    task->mutable_slave_id()->MergeFrom(slave->id);
+    task->set_state(TASK_RUNNING);
+    task->mutable_resources()->MergeFrom(resources);
+
+    framework->addTask(task);
+    slave->addTask(task);
+
+    allocator->taskAdded(task);
+  }
+
+  void finish(Task* task)
+  {
+    Framework* framework = master.frameworks[task->framework_id()];
+    Slave* slave = master.slaves[task->slave_id()];
+
+    framework->removeTask(task);
+    slave->removeTask(task);
+
+    double start = Clock::now();
+    allocator->taskRemoved(task);
+    allocator->resourcesRecovered(framework->id, slave->id, task->resources());
+    done(start);
+
+    delete task;
+  }
+
+  Allocator* allocator;
+  BenchmarkMaster master;
+  double time;
+  uint64_t calls;
+  uint64_t launched;
+
+  bool requesting;
+  hashmap<FrameworkID, std::list<Resources> > wanted;
+  uint64_t offered;
+  uint64_t wasted;
+};
+
+}}} // namespace mesos { namespace internal { namespace master {
+
+using mesos::internal::master::AllocatorBenchmark;
+
+
+// Returns slave resources between 4 and 16 cpus and 4 and 64 GB of
+// memory.
+static Resources resources(unsigned int* seed)
+{
+  int cpus = 4 + rand_r(seed) % 13;
+  int mem = 4096 * (1 + rand_r(seed) % 16);
+  return Resources::parse("cpus:" + utils::stringify(cpus) +
+                          ";mem:" + utils::stringify(mem));
+}
+
+
+// Sets up a cluster with the specified number of frameworks and
+// slaves and then finishes a (random) task the specified number of
+// times, recording the assignment of slaves to frameworks after
+// each step. Only the time spent finishing tasks gets accounted for.
+static vector<map<string, string> > simulate(
+    AllocatorBenchmark* benchmark,
+    int frameworks,
+    int slaves,
+    int rounds)
+{
+  vector<map<string, string> > assignments;
+
+  unsigned int seed = 42;
+
+  for (int i = 0; i < frameworks; i++) {
+    benchmark->addFramework();
+  }
+
+  for (int i = 0; i < slaves; i++) {
+    benchmark->addSlave(resources(&seed));
+  }
+
+  assignments.push_back(benchmark->assignments());
+
+  benchmark->reset();
+
+  for (int i = 0; i < rounds; i++) {
+    // Finish the task on a random (busy) slave.
+    const map<string, string>& busy = assignments.back();
+    map<string, string>::const_iterator iterator = busy.begin();
+    std::advance(iterator, rand_r(&seed) % busy.size());
+    benchmark->finish(iterator->first);
+    if (i % 10 == 0) {
+      benchmark->tick();
+    }
+    assignments.push_back(benchmark->assignments());
+  }
+
+  return assignments;
+}
+
+
+TEST(AllocatorTest, DRFAllocatorMatchesSimpleAllocator)
+{
+  vector<map<string, string> > expected;
+  vector<map<string, string> > actual;
+
+  {
+    SimpleAllocator allocator;
+    AllocatorBenchmark benchmark(&allocator);
+    expected = simulate(&benchmark, 10, 50, 200);
+  }
+
+  {
+    DRFAllocator allocator;
+    AllocatorBenchmark benchmark(&allocator);
+    actual = simulate(&benchmark, 10, 50, 200);
+  }
+
+  ASSERT_EQ(expected.size(), actual.size());
+
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(expected[i], actual[i]) << "step " << i;
+  }
+}
+
+
+TEST(AllocatorTest, DRFAllocatorOffersLowestShareFirst)
+{
+  DRFAllocator allocator;
+  AllocatorBenchmark benchmark(&allocator);
+
+  benchmark.addFramework();
+  benchmark.addFramework();
+
+  // Ties get broken by framework id.
+  benchmark.addSlave(Resources::parse("cpus:4;mem:4096"));
+
+  map<string, string> assignments = benchmark.assignments();
+  ASSERT_EQ(1, assignments.size());
+  EXPECT_EQ("benchmark-0000", assignments["benchmark-0"]);
+
+  benchmark.addSlave(Resources::parse("cpus:4;mem:4096"));
+
+  assignments = benchmark.assignments();
+  ASSERT_EQ(2, assignments.size());
+  EXPECT_EQ("benchmark-0001", assignments["benchmark-1"]);
+
+  // A slave with twice the resources should go to the framework with
+  // the lowest dominant share, which is either one (each has a third).
+  benchmark.addSlave(Resources::parse("cpus:8;mem:8192"));
+
+  assignments = benchmark.assignments();
+  ASSERT_EQ(3, assignments.size());
+  EXPECT_EQ("benchmark-0000", assignments["benchmark-2"]);
+
+  // Framework 0 now has three quarters of the cluster, so when its
+  // small task finishes the slave goes to framework 1.
+  benchmark.finish("benchmark-0");
+
+  assignments = benchmark.assignments();
+  ASSERT_EQ(3, assignments.size());
+  EXPECT_EQ("benchmark-0001", assignments["benchmark-0"]);
+}
+
+
+// Finishes every task in a busy cluster, with the simple allocator
+// batching up the slaves that got freed (the allocation interval is
+// long enough that only the dirty threshold triggers allocations).
+TEST(AllocatorTest, SimpleAllocatorCoalescesAllocations)
+{
+  const int slaves = 1000;
+
+  double immediate = 0;
+  double batched = 0;
+
+  {
+    SimpleAllocator allocator;
+    AllocatorBenchmark benchmark(&allocator);
+
+    for (int i = 0; i < 10; i++) {
+      benchmark.addFramework();
+    }
+
+    unsigned int seed = 42;
+    for (int i = 0; i < slaves; i++) {
+      benchmark.addSlave(resources(&seed));
+    }
+
+    ASSERT_EQ(slaves, benchmark.assignments().size());
+
+    benchmark.reset();
+    uint64_t rounds = benchmark.rounds();
+
+    for (int i = 0; i < slaves; i++) {
+      benchmark.finish(&seed);
+    }
+
+    // Every finished task caused an allocation right away (so each
+    // slave got its new task before the next one finished).
+    EXPECT_EQ(rounds + slaves, benchmark.rounds());
+    EXPECT_EQ(slaves, benchmark.assignments().size());
+
+    immediate = benchmark.average() * slaves;
+  }
+
+  {
+    Configuration conf;
+    conf.set("allocation_interval", 3600);
+    conf.set("allocation_dirty_threshold", 100);
+
+    SimpleAllocator allocator;
+    AllocatorBenchmark benchmark(&allocator, false, conf);
+
+    for (int i = 0; i < 10; i++) {
+      benchmark.addFramework();
+    }
+
+    unsigned int seed = 42;
+    for (int i = 0; i < slaves; i++) {
+      benchmark.addSlave(resources(&seed));
+    }
+
+    benchmark.tick();
+
+    ASSERT_EQ(slaves, benchmark.assignments().size());
+
+    benchmark.reset();
+    uint64_t rounds = benchmark.rounds();
+    uint64_t examined = benchmark.examined();
+
+    for (int i = 0; i < slaves; i++) {
+      benchmark.finish(&seed);
+    }
+
+    // A freed slave stays idle until 100 slaves are dirty, so each
+    // round looks at 100 different slaves.
+    EXPECT_EQ(rounds + slaves / 100, benchmark.rounds());
+    EXPECT_EQ(examined + slaves, benchmark.examined());
+    EXPECT_EQ(slaves, benchmark.assignments().size());
+
+    batched = benchmark.average() * slaves;
+  }
+
+  cout << slaves << " finished tasks: "
+       << immediate << " secs allocating on every change, "
+       << batched << " secs batching allocations" << endl;
+}
+
+
+// Measures the time spent in the allocator when tasks finish in a
+// large (busy) cluster.
+TEST(AllocatorTest, DISABLED_AllocatorBenchmark)
+{
+  const int frameworks = 500;
+  const int slaves = 5000;
+  const int rounds = 100;
+
+  double simple = 0;
+  double drf = 0;
+
+  {
+    SimpleAllocator allocator;
+    AllocatorBenchmark benchmark(&allocator);
+    simulate(&benchmark, frameworks, slaves, rounds);
+    simple = benchmark.average();
+  }
+
+  {
+    DRFAllocator allocator;
+    AllocatorBenchmark benchmark(&allocator);
+    simulate(&benchmark, frameworks, slaves, rounds);
+    drf = benchmark.average();
+  }
+
+  cout << frameworks << " frameworks, " << slaves << " slaves: "
+       << simple * 1000 << " ms per allocation (simple), "
+       << drf * 1000 << " ms per allocation (drf)" << endl;
+}
+
+
+TEST(AllocatorTest, RequestAllocatorOnlyOffersRequestedResources)
+{
+  RequestAllocator allocator;
+  AllocatorBenchmark benchmark(&allocator, true);
+
+  benchmark.addFramework();
+  benchmark.addFramework();
+  benchmark.addSlave(Resources::parse("cpus:4;mem:4096"));
+  benchmark.addSlave(Resources::parse("cpus:8;mem:8192"));
+
+  // Nobody asked for anything yet.
+  EXPECT_EQ(0, benchmark.offers());
+
+  // A request gets matched to the slave with the fewest cpus that
+  // still has enough of everything.
+  benchmark.request("benchmark-0000", Resources::parse("cpus:3;mem:1024"));
+
+  map<string, string> assignments = benchmark.assignments();
+  ASSERT_EQ(1, assignments.size());
+  EXPECT_EQ("benchmark-0000", assignments["benchmark-0"]);
+
+  benchmark.request("benchmark-0001", Resources::parse("cpus:3;mem:6000"));
+
+  assignments = benchmark.assignments();
+  ASSERT_EQ(2, assignments.size());
+  EXPECT_EQ("benchmark-0001", assignments["benchmark-1"]);
+
+  // Requests that don't fit anywhere wait for resources to free up.
+  benchmark.request("benchmark-0001", Resources::parse("cpus:6;mem:1024"));
+
+  EXPECT_EQ(2, benchmark.offers());
+
+  benchmark.finish("benchmark-1");
+
+  EXPECT_EQ(3, benchmark.offers());
+  EXPECT_EQ(0, benchmark.declined());
+}
+
+
+// Runs a cluster where only a few frameworks want resources at a time
+// and counts the offers made (and declined) when the allocator pushes
+// offers to every framework versus when frameworks request resources.
+static void simulateDemand(
+    AllocatorBenchmark* benchmark,
+    int frameworks,
+    int slaves,
+    int rounds)
+{
+  unsigned int seed = 42;
+
+  vector<string> frameworkIds;
+  for (int i = 0; i < frameworks; i++) {
+    frameworkIds.push_back(benchmark->addFramework());
+  }
+
+  for (int i = 0; i < slaves; i++) {
+    benchmark->addSlave(resources(&seed));
+  }
+
+  for (int i = 0; i < rounds; i++) {
+    for (int j = 0; j < 10; j++) {
+      benchmark->request(frameworkIds[rand_r(&seed) % frameworks],
+                         Resources::parse("cpus:2;mem:2048"));
+    }
+    benchmark->finish(&seed);
+    if (i % 10 == 0) {
+      benchmark->tick();
+    }
+  }
+}
+
+
+TEST(AllocatorTest, DISABLED_RequestAllocatorBenchmark)
+{
+  const int frameworks = 1000;
+  const int slaves = 50;
+  const int rounds = 50;
+
+  DRFAllocator drf;
+  AllocatorBenchmark push(&drf, true);
+  simulateDemand(&push, frameworks, slaves, rounds);
+
+  RequestAllocator request;
+  AllocatorBenchmark pull(&request, true);
+  simulateDemand(&pull, frameworks, slaves, rounds);
+
+  cout << frameworks << " frameworks, " << slaves << " slaves: "
+       << push.offers() << " offers (" << push.declined()
+       << " declined) pushing offers, "
+       << pull.offers() << " offers (" << pull.declined()
+       << " declined) with requests" << endl;
+
+  EXPECT_EQ(0, pull.declined());
+}
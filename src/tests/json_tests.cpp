@@ -0,0 +1,106 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gmock/gmock.h>
+
+#include <sstream>
+#include <string>
+
+#include "common/json.hpp"
+
+using std::string;
+
+
+TEST(JSONTest, Writer)
+{
+  string out;
+
+  JSON::Writer writer(&out);
+  writer.beginObject();
+  writer.field("id");
+  writer.value("framework");
+  writer.field("active");
+  writer.value(true);
+  writer.field("tasks");
+  writer.beginArray();
+  writer.beginObject();
+  writer.field("cpus");
+  writer.value(1.5);
+  writer.endObject();
+  writer.beginObject();
+  writer.endObject();
+  writer.endArray();
+  writer.field("offers");
+  writer.beginArray();
+  writer.endArray();
+  writer.endObject();
+
+  EXPECT_EQ("{\"id\":\"framework\",\"active\":1,"
+            "\"tasks\":[{\"cpus\":1.5},{}],\"offers\":[]}",
+            out);
+}
+
+
+TEST(JSONTest, WriterMatchesRenderer)
+{
+  JSON::Object object;
+  object.values["a"] = "string";
+  object.values["b"] = 1234567.891;
+  object.values["c"] = 42;
+
+  std::ostringstream rendered;
+  JSON::render(rendered, object);
+
+  string written;
+  JSON::Writer writer(&written);
+  writer.beginObject();
+  writer.field("a");
+  writer.value("string");
+  writer.field("b");
+  writer.value(1234567.891);
+  writer.field("c");
+  writer.value(42);
+  writer.endObject();
+
+  EXPECT_EQ(rendered.str(), written);
+}
+
+
+TEST(JSONTest, WriterIntegers)
+{
+  string out;
+
+  JSON::Writer writer(&out);
+  writer.beginArray();
+  writer.value((uint64_t) 12345678901ull);
+  writer.value((uint64_t) 18446744073709551615ull);
+  writer.endArray();
+
+  EXPECT_EQ("[12345678901,18446744073709551615]", out);
+}
+
+
+TEST(JSONTest, WriterEscapesStrings)
+{
+  string out;
+
+  JSON::Writer writer(&out);
+  writer.value("a \"quoted\" \\ string\n");
+
+  EXPECT_EQ("\"a \\\"quoted\\\" \\\\ string\\u000a\"", out);
+}
@@ -1,5 +1,7 @@
 #include <gmock/gmock.h>
 
+#include <leveldb/db.h>
+
 #include <set>
 #include <string>
 
@@ -285,6 +287,382 @@ TEST(ReplicaTest, Recover)
 }
 
 
+TEST(ReplicaTest, ReadRange)
+{
+  const std::string path = utils::os::getcwd() + "/.log";
+
+  utils::os::rmdir(path);
+
+  const int id = 1;
+
+  {
+    Replica replica1(path);
+
+    PromiseRequest request;
+    request.set_id(id);
+
+    Future<PromiseResponse> future =
+      protocol::promise(replica1.pid(), request);
+
+    future.await(2.0);
+    ASSERT_TRUE(future.isReady());
+    EXPECT_TRUE(future.get().okay());
+
+    // Leave holes at positions 6 and 7.
+    for (uint64_t position = 1; position <= 10; position++) {
+      if (position == 6 || position == 7) {
+        continue;
+      }
+
+      WriteRequest request;
+      request.set_id(id);
+      request.set_position(position);
+      request.set_type(Action::APPEND);
+      request.mutable_append()->set_bytes(utils::stringify(position));
+
+      Future<WriteResponse> future =
+        protocol::write(replica1.pid(), request);
+
+      future.await(2.0);
+      ASSERT_TRUE(future.isReady());
+      EXPECT_TRUE(future.get().okay());
+    }
+
+    // Served from the cache.
+    Future<std::list<Action> > actions = replica1.read(1, 10);
+    ASSERT_TRUE(actions.await(2.0));
+    ASSERT_TRUE(actions.isReady());
+    ASSERT_EQ(8, actions.get().size());
+    foreach (const Action& action, actions.get()) {
+      EXPECT_EQ(utils::stringify(action.position()), action.append().bytes());
+    }
+  }
+
+  // A recovered replica starts with an empty cache, so these get read
+  // from storage.
+  Replica replica2(path);
+
+  {
+    Future<std::list<Action> > actions = replica2.read(1, 10);
+    ASSERT_TRUE(actions.await(2.0));
+    ASSERT_TRUE(actions.isReady());
+    ASSERT_EQ(8, actions.get().size());
+    foreach (const Action& action, actions.get()) {
+      EXPECT_EQ(utils::stringify(action.position()), action.append().bytes());
+    }
+  }
+
+  {
+    Future<std::list<Action> > actions = replica2.read(3, 9);
+    ASSERT_TRUE(actions.await(2.0));
+    ASSERT_TRUE(actions.isReady());
+    ASSERT_EQ(5, actions.get().size());
+    EXPECT_EQ(3, actions.get().front().position());
+    EXPECT_EQ(9, actions.get().back().position());
+  }
+
+  utils::os::rmdir(path);
+}
+
+
+TEST(ReplicaTest, RecoverFromCheckpoint)
+{
+  const std::string path = utils::os::getcwd() + "/.log";
+
+  utils::os::rmdir(path);
+
+  const int id = 1;
+
+  {
+    Replica replica(path);
+
+    PromiseRequest request;
+    request.set_id(id);
+
+    Future<PromiseResponse> future =
+      protocol::promise(replica.pid(), request);
+
+    future.await(2.0);
+    ASSERT_TRUE(future.isReady());
+    EXPECT_TRUE(future.get().okay());
+  }
+
+  {
+    Replica replica(path);
+
+    // Write (and learn) enough positions to get a checkpoint, leaving
+    // a hole at position 5 and position 7 unlearned.
+    BatchWriteRequest request;
+    request.set_id(id);
+
+    for (uint64_t position = 1; position <= 1500; position++) {
+      if (position != 5) {
+        WriteRequest* write = request.add_writes();
+        write->set_id(id);
+        write->set_position(position);
+        write->set_learned(position != 7);
+        write->set_type(Action::APPEND);
+        write->mutable_append()->set_bytes(utils::stringify(position));
+      }
+    }
+
+    Future<BatchWriteResponse> future =
+      protocol::batch(replica.pid(), request);
+
+    future.await(5.0);
+    ASSERT_TRUE(future.isReady());
+    EXPECT_TRUE(future.get().okay());
+
+    // The checkpoint happens after the write has been acknowledged,
+    // so make sure it's done before shutting down the replica.
+    Future<uint64_t> end = replica.ending();
+    ASSERT_TRUE(end.await(2.0));
+  }
+
+  {
+    Replica replica(path);
+
+    // Now fill in the hole (before the checkpoint) and write past the
+    // end of the checkpoint, leaving holes at positions 1501 -> 1509.
+    uint64_t positions[] = { 5, 1510 };
+
+    for (int i = 0; i < 2; i++) {
+      WriteRequest request;
+      request.set_id(id);
+      request.set_position(positions[i]);
+      request.set_learned(true);
+      request.set_type(Action::APPEND);
+      request.mutable_append()->set_bytes(utils::stringify(positions[i]));
+
+      Future<WriteResponse> future =
+        protocol::write(replica.pid(), request);
+
+      future.await(2.0);
+      ASSERT_TRUE(future.isReady());
+      EXPECT_TRUE(future.get().okay());
+    }
+  }
+
+  // Corrupt a record covered by the checkpoint: recovering would fail
+  // if it read the entire log rather than start from the checkpoint.
+  {
+    leveldb::DB* db;
+    leveldb::Status status =
+      leveldb::DB::Open(leveldb::Options(), path, &db);
+    ASSERT_TRUE(status.ok());
+    status = db->Put(leveldb::WriteOptions(), "0000000101", "garbage");
+    ASSERT_TRUE(status.ok());
+    delete db;
+  }
+
+  Replica replica(path);
+
+  Future<uint64_t> end = replica.ending();
+  ASSERT_TRUE(end.await(2.0));
+  EXPECT_EQ(1510, end.get());
+
+  Future<uint64_t> promised = replica.promised();
+  ASSERT_TRUE(promised.await(2.0));
+  EXPECT_EQ(id, promised.get());
+
+  std::set<uint64_t> expected;
+  expected.insert(0);
+  expected.insert(7);
+  for (uint64_t position = 1501; position <= 1509; position++) {
+    expected.insert(position);
+  }
+
+  Future<std::set<uint64_t> > missing = replica.missing(0);
+  ASSERT_TRUE(missing.await(2.0));
+  EXPECT_EQ(expected, missing.get());
+
+  Future<std::list<Action> > actions = replica.read(5, 5);
+  ASSERT_TRUE(actions.await(2.0));
+  ASSERT_TRUE(actions.isReady());
+  ASSERT_EQ(1, actions.get().size());
+  EXPECT_TRUE(actions.get().front().learned());
+  EXPECT_EQ("5", actions.get().front().append().bytes());
+
+  utils::os::rmdir(path);
+}
+
+
+TEST(ReplicaTest, Truncate)
+{
+  const std::string path = utils::os::getcwd() + "/.log";
+
+  utils::os::rmdir(path);
+
+  const int id = 1;
+
+  {
+    Replica replica(path);
+
+    PromiseRequest request;
+    request.set_id(id);
+
+    Future<PromiseResponse> future =
+      protocol::promise(replica.pid(), request);
+
+    future.await(2.0);
+    ASSERT_TRUE(future.isReady());
+    EXPECT_TRUE(future.get().okay());
+
+    for (uint64_t position = 1; position <= 10; position++) {
+      WriteRequest request;
+      request.set_id(id);
+      request.set_position(position);
+      request.set_learned(true);
+      request.set_type(Action::APPEND);
+      request.mutable_append()->set_bytes(utils::stringify(position));
+
+      Future<WriteResponse> future =
+        protocol::write(replica.pid(), request);
+
+      future.await(2.0);
+      ASSERT_TRUE(future.isReady());
+      EXPECT_TRUE(future.get().okay());
+    }
+
+    // Truncate everything before position 6.
+    WriteRequest truncate;
+    truncate.set_id(id);
+    truncate.set_position(11);
+    truncate.set_learned(true);
+    truncate.set_type(Action::TRUNCATE);
+    truncate.mutable_truncate()->set_to(6);
+
+    Future<WriteResponse> response =
+      protocol::write(replica.pid(), truncate);
+
+    response.await(2.0);
+    ASSERT_TRUE(response.isReady());
+    EXPECT_TRUE(response.get().okay());
+
+    Future<std::list<Action> > actions = replica.read(1, 5);
+    ASSERT_TRUE(actions.await(2.0));
+    EXPECT_TRUE(actions.isFailed());
+
+    actions = replica.read(6, 10);
+    ASSERT_TRUE(actions.await(2.0));
+    ASSERT_TRUE(actions.isReady());
+    EXPECT_EQ(5, actions.get().size());
+  }
+
+  // The truncated positions get deleted in the background (in this
+  // case before the reads above got handled).
+  {
+    leveldb::DB* db;
+    leveldb::Status status =
+      leveldb::DB::Open(leveldb::Options(), path, &db);
+    ASSERT_TRUE(status.ok());
+
+    std::string value;
+    status = db->Get(leveldb::ReadOptions(), "0000000006", &value);
+    EXPECT_TRUE(status.IsNotFound());
+    status = db->Get(leveldb::ReadOptions(), "0000000007", &value);
+    EXPECT_TRUE(status.ok());
+    delete db;
+  }
+
+  Replica replica(path);
+
+  Future<uint64_t> begin = replica.beginning();
+  ASSERT_TRUE(begin.await(2.0));
+  EXPECT_EQ(6, begin.get());
+
+  Future<std::list<Action> > actions = replica.read(6, 11);
+  ASSERT_TRUE(actions.await(2.0));
+  ASSERT_TRUE(actions.isReady());
+  ASSERT_EQ(6, actions.get().size());
+  EXPECT_EQ("6", actions.get().front().append().bytes());
+  EXPECT_EQ(Action::TRUNCATE, actions.get().back().type());
+
+  utils::os::rmdir(path);
+}
+
+
+TEST(ReplicaTest, Catchup)
+{
+  const std::string path1 = utils::os::getcwd() + "/.log1";
+  const std::string path2 = utils::os::getcwd() + "/.log2";
+
+  utils::os::rmdir(path1);
+  utils::os::rmdir(path2);
+
+  Replica replica1(path1);
+  Replica replica2(path2);
+
+  const int id = 1;
+
+  PromiseRequest request;
+  request.set_id(id);
+
+  Future<PromiseResponse> future =
+    protocol::promise(replica1.pid(), request);
+
+  future.await(2.0);
+  ASSERT_TRUE(future.isReady());
+  EXPECT_TRUE(future.get().okay());
+
+  // Positions 1 -> 2500 get learned on the first replica, except for
+  // position 2000 which only gets written.
+  for (uint64_t position = 1; position <= 2500; position += 500) {
+    BatchWriteRequest request;
+    request.set_id(id);
+
+    for (uint64_t i = position; i < position + 500; i++) {
+      WriteRequest* write = request.add_writes();
+      write->set_id(id);
+      write->set_position(i);
+      write->set_learned(i != 2000);
+      write->set_type(Action::APPEND);
+      write->mutable_append()->set_bytes(utils::stringify(i));
+    }
+
+    Future<BatchWriteResponse> future =
+      protocol::batch(replica1.pid(), request);
+
+    future.await(5.0);
+    ASSERT_TRUE(future.isReady());
+    EXPECT_TRUE(future.get().okay());
+  }
+
+  std::set<uint64_t> positions;
+  for (uint64_t position = 1; position <= 2600; position++) {
+    positions.insert(position);
+  }
+
+  std::set<UPID> peers;
+  peers.insert(replica1.pid());
+
+  Future<std::set<uint64_t> > missing = replica2.catchup(positions, peers);
+  ASSERT_TRUE(missing.await(10.0));
+  ASSERT_TRUE(missing.isReady());
+
+  // Only the positions the first replica hasn't learned are missing.
+  std::set<uint64_t> expected;
+  expected.insert(2000);
+  for (uint64_t position = 2501; position <= 2600; position++) {
+    expected.insert(position);
+  }
+
+  EXPECT_EQ(expected, missing.get());
+
+  Future<std::list<Action> > actions = replica2.read(1, 2500);
+  ASSERT_TRUE(actions.await(5.0));
+  ASSERT_TRUE(actions.isReady());
+  EXPECT_EQ(2499, actions.get().size());
+  foreach (const Action& action, actions.get()) {
+    EXPECT_TRUE(action.learned());
+    EXPECT_EQ(utils::stringify(action.position()), action.append().bytes());
+  }
+
+  utils::os::rmdir(path1);
+  utils::os::rmdir(path2);
+}
+
+
 TEST(CoordinatorTest, Elect)
 {
   const std::string path1 = utils::os::getcwd() + "/.log1";
@@ -827,6 +1205,93 @@ TEST(CoordinatorTest, MultipleAppends)
 }
 
 
+TEST(CoordinatorTest, BatchAppends)
+{
+  const std::string path1 = utils::os::getcwd() + "/.log1";
+  const std::string path2 = utils::os::getcwd() + "/.log2";
+
+  utils::os::rmdir(path1);
+  utils::os::rmdir(path2);
+
+  Replica replica1(path1);
+  Replica replica2(path2);
+
+  Network network;
+
+  network.add(replica1.pid());
+  network.add(replica2.pid());
+
+  Coordinator coord(2, &replica1, &network);
+
+  {
+    Result<uint64_t> result = coord.elect();
+    ASSERT_TRUE(result.isSome());
+    EXPECT_EQ(0, result.get());
+  }
+
+  std::list<std::string> entries;
+  for (uint64_t position = 1; position <= 10; position++) {
+    entries.push_back(utils::stringify(position));
+  }
+
+  {
+    // Three batches (of 4, 4 and 2 positions).
+    Result<uint64_t> result = coord.append(entries, 4);
+    ASSERT_TRUE(result.isSome());
+    EXPECT_EQ(10, result.get());
+  }
+
+  {
+    // Every position is learned on the local replica ...
+    Future<std::list<Action> > actions = replica1.read(1, 10);
+    ASSERT_TRUE(actions.await(2.0));
+    ASSERT_TRUE(actions.isReady());
+    EXPECT_EQ(10, actions.get().size());
+    foreach (const Action& action, actions.get()) {
+      ASSERT_TRUE(action.has_type());
+      ASSERT_EQ(Action::APPEND, action.type());
+      EXPECT_EQ(utils::stringify(action.position()), action.append().bytes());
+      ASSERT_TRUE(action.has_learned());
+      EXPECT_TRUE(action.learned());
+    }
+  }
+
+  {
+    // ... and on the remote replica, including the positions of the
+    // last batch, which get sent without waiting for any responses
+    // (hence the retries).
+    bool learned = false;
+    for (int attempt = 0; attempt < 200 && !learned; attempt++) {
+      Future<std::list<Action> > actions = replica2.read(1, 10);
+      ASSERT_TRUE(actions.await(2.0));
+      ASSERT_TRUE(actions.isReady());
+      ASSERT_EQ(10, actions.get().size());
+      learned = true;
+      foreach (const Action& action, actions.get()) {
+        ASSERT_TRUE(action.has_type());
+        ASSERT_EQ(Action::APPEND, action.type());
+        EXPECT_EQ(utils::stringify(action.position()), action.append().bytes());
+        learned = learned && action.has_learned() && action.learned();
+      }
+      if (!learned) {
+        usleep(10000);
+      }
+    }
+    EXPECT_TRUE(learned);
+  }
+
+  {
+    // Appends continue after the batch.
+    Result<uint64_t> result = coord.append("hello world");
+    ASSERT_TRUE(result.isSome());
+    EXPECT_EQ(11, result.get());
+  }
+
+  utils::os::rmdir(path1);
+  utils::os::rmdir(path2);
+}
+
+
 TEST(CoordinatorTest, MultipleAppendsNotLearnedFill)
 {
   MockFilter filter;
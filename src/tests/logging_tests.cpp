@@ -0,0 +1,117 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+#include "common/async_logger.hpp"
+#include "common/foreach.hpp"
+#include "common/utils.hpp"
+
+using namespace mesos;
+using namespace mesos::internal;
+
+using std::string;
+using std::vector;
+
+
+// Remembers everything written to it.
+class RecordingLogger : public google::base::Logger
+{
+public:
+  RecordingLogger() : flushes(0) {}
+
+  virtual void Write(bool force_flush,
+                     time_t timestamp,
+                     const char* message,
+                     int length)
+  {
+    messages.push_back(string(message, length));
+  }
+
+  virtual void Flush() { flushes++; }
+
+  virtual google::uint32 LogSize() { return 0; }
+
+  vector<string> messages;
+  int flushes;
+};
+
+
+TEST(LoggingTest, AsyncLogger)
+{
+  RecordingLogger recording;
+
+  {
+    AsyncLogger logger(&recording, 1000);
+
+    for (int i = 0; i < 100; i++) {
+      string message = "message " + utils::stringify(i);
+      logger.Write(false, 0, message.data(), message.size());
+    }
+
+    logger.Flush();
+
+    EXPECT_EQ(0, logger.dropped());
+    EXPECT_EQ(1, recording.flushes);
+
+    ASSERT_EQ(100, recording.messages.size());
+    for (int i = 0; i < 100; i++) {
+      EXPECT_EQ("message " + utils::stringify(i), recording.messages[i]);
+    }
+
+    // The empty message glog writes before aborting on a FATAL
+    // message also writes everything out.
+    logger.Write(false, 0, "last", 4);
+    logger.Write(true, 0, "", 0);
+
+    ASSERT_EQ(101, recording.messages.size());
+    EXPECT_EQ("last", recording.messages.back());
+  }
+}
+
+
+TEST(LoggingTest, AsyncLoggerDropsWhenFull)
+{
+  RecordingLogger recording;
+
+  AsyncLogger logger(&recording, 10);
+
+  // The background thread might not keep up with this, in which case
+  // some of the messages get dropped.
+  for (int i = 0; i < 100; i++) {
+    logger.Write(false, 0, "message", 7);
+  }
+
+  logger.Flush();
+
+  // Either the background thread kept up or the messages it couldn't
+  // keep up with got dropped (and reported), but nothing got lost
+  // silently.
+  size_t reports = 0;
+  foreach (const string& message, recording.messages) {
+    if (message.find("Dropped") == 0) {
+      reports++;
+    }
+  }
+
+  EXPECT_EQ(100, recording.messages.size() - reports + logger.dropped());
+  EXPECT_EQ(logger.dropped() > 0 ? 1 : 0, reports > 0 ? 1 : 0);
+}
@@ -21,13 +21,17 @@
 #include <mesos/executor.hpp>
 #include <mesos/scheduler.hpp>
 
+#include "common/async_logger.hpp"
+
 #include "detector/detector.hpp"
 
 #include "local/local.hpp"
 
 #include "master/frameworks_manager.hpp"
+#include "master/http.hpp"
 #include "master/master.hpp"
 #include "master/simple_allocator.hpp"
+#include "master/slaves_manager.hpp"
 
 #include <process/dispatch.hpp>
 #include <process/future.hpp>
@@ -45,11 +49,13 @@ using mesos::internal::master::FrameworksStorage;
 
 using mesos::internal::master::Master;
 using mesos::internal::master::SimpleAllocator;
+using mesos::internal::master::SlavesManager;
 
 using mesos::internal::slave::Slave;
 
 using process::PID;
 using process::Future;
+using process::HttpRequest;
 using process::Promise;
 
 using std::string;
@@ -57,6 +63,7 @@ using std::map;
 using std::vector;
 
 using testing::_;
+using testing::AtLeast;
 using testing::AtMost;
 using testing::DoAll;
 using testing::Eq;
@@ -495,6 +502,680 @@ TEST(MasterTest, MultipleExecutors)
 }
 
 
+// Checks that the master's Slave and Framework objects keep their
+// tasks indexed by framework and by slave respectively.
+TEST(MasterTest, TaskIndexes)
+{
+  SlaveInfo slaveInfo;
+  slaveInfo.set_hostname("localhost");
+  SlaveID slaveId;
+  slaveId.set_value("slave");
+  master::Slave slave(slaveInfo, slaveId, process::UPID(), 0);
+
+  FrameworkInfo frameworkInfo;
+  FrameworkID frameworkId1;
+  frameworkId1.set_value("framework1");
+  FrameworkID frameworkId2;
+  frameworkId2.set_value("framework2");
+  master::Framework framework1(frameworkInfo, frameworkId1, process::UPID(), 0);
+  master::Framework framework2(frameworkInfo, frameworkId2, process::UPID(), 0);
+
+  vector<Task*> tasks;
+  for (int i = 0; i < 3; i++) {
+    Task* task = new Task();
+    task->set_name("");
+    task->mutable_task_id()->set_value("task");
+    task->mutable_framework_id()->MergeFrom(
+        i < 2 ? frameworkId1 : frameworkId2);
+    task->mutable_executor_id()->set_value("default");
+    task->mutable_slave_id()->MergeFrom(slaveId);
+    task->set_state(TASK_RUNNING);
+    if (i == 1) {
+      task->mutable_task_id()->set_value("other");
+    }
+    tasks.push_back(task);
+    slave.addTask(task);
+    (i < 2 ? framework1 : framework2).addTask(task);
+  }
+
+  TaskID taskId;
+  taskId.set_value("task");
+
+  EXPECT_EQ(tasks[0], slave.getTask(frameworkId1, taskId));
+  EXPECT_EQ(tasks[2], slave.getTask(frameworkId2, taskId));
+  EXPECT_EQ(tasks[0], framework1.getTask(taskId));
+
+  EXPECT_EQ(2, slave.getTasks(frameworkId1).size());
+  EXPECT_EQ(1, slave.getTasks(frameworkId2).size());
+  EXPECT_EQ(2, framework1.getTasks(slaveId).size());
+
+  slave.removeTask(tasks[0]);
+  framework1.removeTask(tasks[0]);
+
+  EXPECT_TRUE(slave.getTask(frameworkId1, taskId) == NULL);
+  EXPECT_TRUE(framework1.getTask(taskId) == NULL);
+  EXPECT_EQ(1, slave.getTasks(frameworkId1).size());
+  EXPECT_EQ(1, framework1.getTasks(slaveId).size());
+
+  slave.removeTask(tasks[1]);
+  framework1.removeTask(tasks[1]);
+
+  EXPECT_EQ(0, slave.getTasks(frameworkId1).size());
+  EXPECT_EQ(0, framework1.getTasks(slaveId).size());
+  EXPECT_FALSE(slave.frameworkTasks.contains(frameworkId1));
+  EXPECT_FALSE(framework1.slaveTasks.contains(slaveId));
+
+  foreach (Task* task, tasks) {
+    delete task;
+  }
+}
+
+
+// Sends the specified number of TASK_RUNNING status updates for the
+// launched task.
+ACTION_P(SendStatusUpdates, count)
+{
+  for (int i = 0; i < count; i++) {
+    TaskStatus status;
+    status.mutable_task_id()->MergeFrom(arg1.task_id());
+    status.set_state(TASK_RUNNING);
+    arg0->sendStatusUpdate(status);
+  }
+}
+
+
+// Counts the status updates and triggers once all of them arrived.
+ACTION_P3(CountStatusUpdates, count, total, trigger)
+{
+  if (++(*count) == total) {
+    trigger->value = true;
+  }
+}
+
+
+// Launches a task whose executor sends the specified number of status
+// updates and stores how many updates per second the scheduler got
+// (with the slave and the master batching the updates for the
+// specified amounts of time). Returns void so that WAIT_UNTIL can fail.
+static void statusUpdateThroughput(int updates,
+                                   double slaveBatchInterval,
+                                   double frameworkBatchInterval,
+                                   double* throughput)
+{
+  Configuration conf;
+  conf.set("resources", "cpus:2;mem:1024");
+  conf.set("status_update_batch_interval", slaveBatchInterval);
+  conf.set("framework_status_update_batch_interval", frameworkBatchInterval);
+
+  SimpleAllocator a;
+  Master m(&a, conf);
+  PID<Master> master = process::spawn(&m);
+
+  MockExecutor exec;
+
+  EXPECT_CALL(exec, init(_, _))
+    .Times(1);
+
+  EXPECT_CALL(exec, launchTask(_, _))
+    .WillOnce(SendStatusUpdates(updates));
+
+  EXPECT_CALL(exec, shutdown(_))
+    .Times(AtMost(1));
+
+  map<ExecutorID, Executor*> execs;
+  execs[DEFAULT_EXECUTOR_ID] = &exec;
+
+  TestingIsolationModule isolationModule(execs);
+
+  Slave s(conf, true, &isolationModule);
+  PID<Slave> slave = process::spawn(&s);
+
+  BasicMasterDetector detector(master, slave, true);
+
+  MockScheduler sched;
+  MesosSchedulerDriver driver(&sched, "", DEFAULT_EXECUTOR_INFO, master);
+
+  vector<Offer> offers;
+  int count = 0;
+
+  trigger resourceOffersCall, statusUpdatesCall;
+
+  EXPECT_CALL(sched, registered(&driver, _))
+    .Times(1);
+
+  EXPECT_CALL(sched, resourceOffers(&driver, _))
+    .WillOnce(DoAll(SaveArg<1>(&offers),
+                    Trigger(&resourceOffersCall)))
+    .WillRepeatedly(Return());
+
+  EXPECT_CALL(sched, statusUpdate(&driver, _))
+    .Times(updates)
+    .WillRepeatedly(CountStatusUpdates(&count, updates, &statusUpdatesCall));
+
+  driver.start();
+
+  WAIT_UNTIL(resourceOffersCall);
+
+  EXPECT_NE(0, offers.size());
+
+  TaskDescription task;
+  task.set_name("");
+  task.mutable_task_id()->set_value("1");
+  task.mutable_slave_id()->MergeFrom(offers[0].slave_id());
+  task.mutable_resources()->MergeFrom(offers[0].resources());
+
+  vector<TaskDescription> tasks;
+  tasks.push_back(task);
+
+  double start = process::Clock::now();
+
+  driver.launchTasks(offers[0].id(), tasks);
+
+  WAIT_UNTIL(statusUpdatesCall);
+
+  double elapsed = process::Clock::now() - start;
+
+  driver.stop();
+  driver.join();
+
+  process::post(slave, process::TERMINATE);
+  process::wait(slave);
+
+  process::post(master, process::TERMINATE);
+  process::wait(master);
+
+  *throughput = updates / elapsed;
+}
+
+
+// Checks that batched status updates all make it to the scheduler
+// and compares the throughput with and without batching.
+TEST(MasterTest, BatchedStatusUpdates)
+{
+  ASSERT_TRUE(GTEST_IS_THREADSAFE);
+
+  const int updates = 1000;
+
+  double unbatched = 0;
+  double batched = 0;
+
+  statusUpdateThroughput(updates, 0, 0, &unbatched);
+  statusUpdateThroughput(updates, 0.01, 0.01, &batched);
+
+  std::cout << updates << " status updates: "
+            << unbatched << " updates/sec (unbatched), "
+            << batched << " updates/sec (batched)" << std::endl;
+}
+
+
+// Clears the capabilities from a message as if it was sent by an
+// older scheduler driver or slave (for use with MockFilter).
+ACTION(ClearBatchedStatusUpdatesSupport)
+{
+  RegisterFrameworkMessage message;
+  CHECK(message.ParseFromString(arg0->body));
+  message.clear_supports_batched_status_updates();
+  CHECK(message.SerializeToString(&arg0->body));
+}
+
+
+ACTION(ClearStatusUpdateAcknowledgementsSupport)
+{
+  RegisterSlaveMessage message;
+  CHECK(message.ParseFromString(arg0->body));
+  message.clear_supports_status_update_acknowledgements();
+  CHECK(message.SerializeToString(&arg0->body));
+}
+
+
+// Checks that the master sends batches of status updates to a
+// scheduler driver that supports them (the slave doesn't batch here,
+// so every StatusUpdatesMessage comes from the master).
+TEST(MasterTest, StatusUpdatesSentInBatches)
+{
+  ASSERT_TRUE(GTEST_IS_THREADSAFE);
+
+  MockFilter filter;
+  process::filter(&filter);
+
+  EXPECT_MSG(filter, _, _, _)
+    .WillRepeatedly(Return(false));
+
+  EXPECT_MSG(filter, Eq(StatusUpdatesMessage().GetTypeName()), _, _)
+    .Times(AtLeast(1))
+    .WillRepeatedly(Return(false));
+
+  EXPECT_MSG(filter, Eq(StatusUpdateAcknowledgementsMessage().GetTypeName()),
+             _, _)
+    .Times(AtLeast(1))
+    .WillRepeatedly(Return(false));
+
+  double throughput = 0;
+  statusUpdateThroughput(100, 0, 0.01, &throughput);
+
+  process::filter(NULL);
+}
+
+
+// Checks that a scheduler driver that doesn't support batches of
+// status updates gets sent each status update individually.
+TEST(MasterTest, StatusUpdatesNotBatchedForOldDriver)
+{
+  ASSERT_TRUE(GTEST_IS_THREADSAFE);
+
+  MockFilter filter;
+  process::filter(&filter);
+
+  EXPECT_MSG(filter, _, _, _)
+    .WillRepeatedly(Return(false));
+
+  EXPECT_MSG(filter, Eq(RegisterFrameworkMessage().GetTypeName()), _, _)
+    .WillRepeatedly(DoAll(ClearBatchedStatusUpdatesSupport(),
+                          Return(false)));
+
+  EXPECT_MSG(filter, Eq(StatusUpdatesMessage().GetTypeName()), _, _)
+    .Times(0);
+
+  EXPECT_MSG(filter, Eq(StatusUpdateAcknowledgementsMessage().GetTypeName()),
+             _, _)
+    .Times(0);
+
+  EXPECT_MSG(filter, Eq(StatusUpdateAcknowledgementMessage().GetTypeName()),
+             _, _)
+    .Times(AtLeast(1))
+    .WillRepeatedly(Return(false));
+
+  double throughput = 0;
+  statusUpdateThroughput(100, 0, 0.01, &throughput);
+
+  process::filter(NULL);
+}
+
+
+// Checks that the status updates from a slave that doesn't support
+// acknowledgements of batches get sent to the scheduler driver
+// individually (so that it acknowledges each of them individually).
+TEST(MasterTest, StatusUpdatesNotBatchedFromOldSlave)
+{
+  ASSERT_TRUE(GTEST_IS_THREADSAFE);
+
+  MockFilter filter;
+  process::filter(&filter);
+
+  EXPECT_MSG(filter, _, _, _)
+    .WillRepeatedly(Return(false));
+
+  EXPECT_MSG(filter, Eq(RegisterSlaveMessage().GetTypeName()), _, _)
+    .WillRepeatedly(DoAll(ClearStatusUpdateAcknowledgementsSupport(),
+                          Return(false)));
+
+  EXPECT_MSG(filter, Eq(StatusUpdatesMessage().GetTypeName()), _, _)
+    .Times(0);
+
+  EXPECT_MSG(filter, Eq(StatusUpdateAcknowledgementsMessage().GetTypeName()),
+             _, _)
+    .Times(0);
+
+  EXPECT_MSG(filter, Eq(StatusUpdateAcknowledgementMessage().GetTypeName()),
+             _, _)
+    .Times(AtLeast(1))
+    .WillRepeatedly(Return(false));
+
+  double throughput = 0;
+  statusUpdateThroughput(100, 0, 0.01, &throughput);
+
+  process::filter(NULL);
+}
+
+
+// Compares the status update throughput (with every status update
+// getting logged by the slave and the master) when the log files get
+// written synchronously and when they get written by AsyncLoggers.
+TEST(MasterTest, DISABLED_StatusUpdateThroughputWithAsyncLogging)
+{
+  ASSERT_TRUE(GTEST_IS_THREADSAFE);
+
+  const int updates = 1000;
+
+  double sync = 0;
+  double async = 0;
+
+  statusUpdateThroughput(updates, 0, 0, &sync);
+
+  const google::LogSeverity severities[] =
+    { google::INFO, google::WARNING, google::ERROR };
+
+  google::base::Logger* loggers[3];
+  for (int i = 0; i < 3; i++) {
+    loggers[i] = google::base::GetLogger(severities[i]);
+  }
+
+  AsyncLogger::install(100000);
+
+  statusUpdateThroughput(updates, 0, 0, &async);
+
+  // Put back the original loggers.
+  for (int i = 0; i < 3; i++) {
+    google::base::Logger* logger = google::base::GetLogger(severities[i]);
+    google::base::SetLogger(severities[i], loggers[i]);
+    delete logger;
+  }
+
+  std::cout << updates << " status updates: "
+            << sync << " updates/sec (synchronous logging), "
+            << async << " updates/sec (asynchronous logging)" << std::endl;
+}
+
+
+// Launches many tasks from a single offer (which the master sends to
+// the slave as a single RunTasksMessage) and measures the time from
+// accepting the offer until every task is running.
+TEST(MasterTest, DISABLED_BatchedTaskLaunch)
+{
+  ASSERT_TRUE(GTEST_IS_THREADSAFE);
+
+  const int count = 50;
+
+  SimpleAllocator a;
+  Master m(&a);
+  PID<Master> master = process::spawn(&m);
+
+  MockExecutor exec;
+
+  EXPECT_CALL(exec, init(_, _))
+    .Times(1);
+
+  EXPECT_CALL(exec, launchTask(_, _))
+    .Times(count)
+    .WillRepeatedly(SendStatusUpdate(TASK_RUNNING));
+
+  EXPECT_CALL(exec, shutdown(_))
+    .Times(AtMost(1));
+
+  map<ExecutorID, Executor*> execs;
+  execs[DEFAULT_EXECUTOR_ID] = &exec;
+
+  TestingIsolationModule isolationModule(execs);
+
+  Resources resources = Resources::parse("cpus:50;mem:5000");
+
+  Slave s(resources, true, &isolationModule);
+  PID<Slave> slave = process::spawn(&s);
+
+  BasicMasterDetector detector(master, slave, true);
+
+  MockScheduler sched;
+  MesosSchedulerDriver driver(&sched, "", DEFAULT_EXECUTOR_INFO, master);
+
+  vector<Offer> offers;
+  int running = 0;
+
+  trigger resourceOffersCall, statusUpdatesCall;
+
+  EXPECT_CALL(sched, registered(&driver, _))
+    .Times(1);
+
+  EXPECT_CALL(sched, resourceOffers(&driver, _))
+    .WillOnce(DoAll(SaveArg<1>(&offers),
+                    Trigger(&resourceOffersCall)))
+    .WillRepeatedly(Return());
+
+  EXPECT_CALL(sched, statusUpdate(&driver, _))
+    .Times(count)
+    .WillRepeatedly(CountStatusUpdates(&running, count, &statusUpdatesCall));
+
+  driver.start();
+
+  WAIT_UNTIL(resourceOffersCall);
+
+  EXPECT_NE(0, offers.size());
+
+  vector<TaskDescription> tasks;
+
+  for (int i = 0; i < count; i++) {
+    TaskDescription task;
+    task.set_name("");
+    task.mutable_task_id()->set_value(utils::stringify(i));
+    task.mutable_slave_id()->MergeFrom(offers[0].slave_id());
+    task.mutable_resources()->MergeFrom(Resources::parse("cpus:1;mem:100"));
+    tasks.push_back(task);
+  }
+
+  double start = process::Clock::now();
+
+  driver.launchTasks(offers[0].id(), tasks);
+
+  WAIT_UNTIL(statusUpdatesCall);
+
+  std::cout << count << " tasks running after "
+            << (process::Clock::now() - start) * 1000 << " ms" << std::endl;
+
+  driver.stop();
+  driver.join();
+
+  process::post(slave, process::TERMINATE);
+  process::wait(slave);
+
+  process::post(master, process::TERMINATE);
+  process::wait(master);
+}
+
+
+// Checks that the tasks launched from a single offer reach a slave
+// that supports it in exactly one RunTasksMessage.
+TEST(MasterTest, TasksFromOneOfferSentInOneMessage)
+{
+  ASSERT_TRUE(GTEST_IS_THREADSAFE);
+
+  const int count = 5;
+
+  MockFilter filter;
+  process::filter(&filter);
+
+  EXPECT_MSG(filter, _, _, _)
+    .WillRepeatedly(Return(false));
+
+  trigger runTasksMsg;
+
+  EXPECT_MSG(filter, Eq(RunTasksMessage().GetTypeName()), _, _)
+    .WillOnce(DoAll(Trigger(&runTasksMsg),
+                    Return(false)));
+
+  EXPECT_MSG(filter, Eq(RunTaskMessage().GetTypeName()), _, _)
+    .Times(0);
+
+  SimpleAllocator a;
+  Master m(&a);
+  PID<Master> master = process::spawn(&m);
+
+  MockExecutor exec;
+
+  EXPECT_CALL(exec, init(_, _))
+    .Times(1);
+
+  EXPECT_CALL(exec, launchTask(_, _))
+    .Times(count)
+    .WillRepeatedly(SendStatusUpdate(TASK_RUNNING));
+
+  EXPECT_CALL(exec, shutdown(_))
+    .Times(AtMost(1));
+
+  map<ExecutorID, Executor*> execs;
+  execs[DEFAULT_EXECUTOR_ID] = &exec;
+
+  TestingIsolationModule isolationModule(execs);
+
+  Resources resources = Resources::parse("cpus:5;mem:500");
+
+  Slave s(resources, true, &isolationModule);
+  PID<Slave> slave = process::spawn(&s);
+
+  BasicMasterDetector detector(master, slave, true);
+
+  MockScheduler sched;
+  MesosSchedulerDriver driver(&sched, "", DEFAULT_EXECUTOR_INFO, master);
+
+  vector<Offer> offers;
+  int running = 0;
+
+  trigger resourceOffersCall, statusUpdatesCall;
+
+  EXPECT_CALL(sched, registered(&driver, _))
+    .Times(1);
+
+  EXPECT_CALL(sched, resourceOffers(&driver, _))
+    .WillOnce(DoAll(SaveArg<1>(&offers),
+                    Trigger(&resourceOffersCall)))
+    .WillRepeatedly(Return());
+
+  EXPECT_CALL(sched, statusUpdate(&driver, _))
+    .Times(count)
+    .WillRepeatedly(CountStatusUpdates(&running, count, &statusUpdatesCall));
+
+  driver.start();
+
+  WAIT_UNTIL(resourceOffersCall);
+
+  EXPECT_NE(0, offers.size());
+
+  vector<TaskDescription> tasks;
+
+  for (int i = 0; i < count; i++) {
+    TaskDescription task;
+    task.set_name("");
+    task.mutable_task_id()->set_value(utils::stringify(i));
+    task.mutable_slave_id()->MergeFrom(offers[0].slave_id());
+    task.mutable_resources()->MergeFrom(Resources::parse("cpus:1;mem:100"));
+    tasks.push_back(task);
+  }
+
+  driver.launchTasks(offers[0].id(), tasks);
+
+  WAIT_UNTIL(runTasksMsg);
+  WAIT_UNTIL(statusUpdatesCall);
+
+  EXPECT_EQ(count, running);
+
+  driver.stop();
+  driver.join();
+
+  process::post(slave, process::TERMINATE);
+  process::wait(slave);
+
+  process::post(master, process::TERMINATE);
+  process::wait(master);
+
+  process::filter(NULL);
+}
+
+
+// A master that never gets spawned, so that changes can be journaled
+// and state_delta.json rendered without any messaging.
+class DeltaMaster : public Master
+{
+public:
+  DeltaMaster(const Configuration& conf = Configuration())
+    : Master(NULL, conf)
+  {
+    id = "master";
+    slavesManager = new SlavesManager(conf, self());
+    process::spawn(slavesManager);
+  }
+
+  using Master::Change;
+  using Master::journal;
+};
+
+
+// Returns the body of the state_delta.json response to the query.
+static string delta(const Master& master, const string& query)
+{
+  HttpRequest request;
+  request.path = "/master/state_delta.json";
+  request.query = query;
+  return mesos::internal::master::http::json::delta(master, request)
+    .future().get().body;
+}
+
+
+TEST(MasterTest, StateDeltaSendsChangesSince)
+{
+  DeltaMaster master;
+
+  master.journal(DeltaMaster::Change::FRAMEWORK_REMOVED, "framework");
+  master.journal(DeltaMaster::Change::SLAVE_REMOVED, "slave");
+  master.journal(DeltaMaster::Change::TASK_REMOVED, "task", "framework");
+
+  EXPECT_EQ("{\"id\":\"master\",\"version\":3,\"changes\":["
+            "{\"version\":2,\"type\":\"slave_removed\",\"id\":\"slave\"},"
+            "{\"version\":3,\"type\":\"task_removed\",\"id\":\"task\","
+            "\"framework_id\":\"framework\"}]}",
+            delta(master, "since=1"));
+
+  EXPECT_EQ("{\"id\":\"master\",\"version\":3,\"changes\":[]}",
+            delta(master, "since=3"));
+}
+
+
+TEST(MasterTest, StateDeltaSendsStateOnceChangesAreTrimmed)
+{
+  Configuration conf;
+  conf.set("state_journal_size", 2);
+
+  DeltaMaster master(conf);
+
+  master.journal(DeltaMaster::Change::FRAMEWORK_REMOVED, "framework1");
+  master.journal(DeltaMaster::Change::FRAMEWORK_REMOVED, "framework2");
+  master.journal(DeltaMaster::Change::FRAMEWORK_REMOVED, "framework3");
+
+  // Only the last two changes are left, which still covers version 1.
+  EXPECT_NE(string::npos, delta(master, "since=1").find("\"changes\":"));
+
+  // The change after version 0 was trimmed, as was everything before.
+  EXPECT_NE(string::npos, delta(master, "since=0").find("\"state\":"));
+
+  // Without a version, or with one from the future, there's nothing
+  // to send the changes since.
+  EXPECT_NE(string::npos, delta(master, "").find("\"state\":"));
+  EXPECT_NE(string::npos, delta(master, "since=4").find("\"state\":"));
+  EXPECT_NE(string::npos, delta(master, "since=x").find("\"state\":"));
+}
+
+
+TEST(MasterTest, StateDeltaSendsStateForAnotherMaster)
+{
+  DeltaMaster master;
+
+  master.journal(DeltaMaster::Change::FRAMEWORK_REMOVED, "framework");
+
+  EXPECT_NE(string::npos,
+            delta(master, "since=0&id=master").find("\"changes\":"));
+
+  // The versions of another master (e.g., before a failover) have
+  // nothing to do with these versions.
+  EXPECT_NE(string::npos,
+            delta(master, "since=0&id=other").find("\"state\":"));
+}
+
+
+TEST(MasterTest, StateRenderingsDoNotEvictEachOther)
+{
+  DeltaMaster master;
+
+  using mesos::internal::master::http::json::render;
+
+  const string& state = render(master, "");
+  const string copy = state;
+
+  const string& filtered = render(master, "fields=id");
+  EXPECT_EQ("{\"id\":\"master\"}", filtered);
+
+  // The whole state (e.g., for state_delta.json) is still cached.
+  EXPECT_EQ(&state, &render(master, ""));
+  EXPECT_EQ(copy, state);
+}
+
+
 // FrameworksManager test cases.
 
 class MockFrameworksStorage : public FrameworksStorage
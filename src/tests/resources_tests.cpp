@@ -16,18 +16,34 @@
  * limitations under the License.
  */
 
+#include <stdlib.h>
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <set>
 #include <sstream>
 #include <string>
 
 #include <gtest/gtest.h>
 
+#include <process/process.hpp>
+
+#include "common/interval_set.hpp"
+#include "common/resource_vector.hpp"
+
 #include "master/master.hpp"
 
 using namespace mesos;
 using namespace mesos::internal;
 using namespace mesos::internal::master;
 
+using process::Clock;
+
+using std::cout;
+using std::endl;
 using std::ostringstream;
+using std::set;
 using std::string;
 
 
@@ -272,6 +288,126 @@ TEST(ResourcesTest, RangesSubtraction)
 }
 
 
+// Returns some random ranges within [0, 110] (possibly overlapping,
+// adjacent or inverted) along with the integers they contain.
+static Resource::Ranges random(unsigned int* seed, set<uint64_t>* points)
+{
+  Resource::Ranges ranges;
+
+  int count = rand_r(seed) % 8;
+  for (int i = 0; i < count; i++) {
+    uint64_t begin = 1 + rand_r(seed) % 100;
+    uint64_t end = rand_r(seed) % 10 == 0
+      ? begin - 1 // Inverted.
+      : begin + rand_r(seed) % 10;
+
+    Resource::Range* range = ranges.add_range();
+    range->set_begin(begin);
+    range->set_end(end);
+
+    for (uint64_t point = begin; point <= end; point++) {
+      points->insert(point);
+    }
+  }
+
+  return ranges;
+}
+
+
+// Returns the integers contained in some ranges, and checks that the
+// ranges are sorted and neither overlap nor are adjacent.
+static set<uint64_t> points(const Resource::Ranges& ranges)
+{
+  set<uint64_t> result;
+
+  for (int i = 0; i < ranges.range_size(); i++) {
+    const Resource::Range& range = ranges.range(i);
+    EXPECT_LE(range.begin(), range.end());
+    if (i > 0) {
+      EXPECT_LT(ranges.range(i - 1).end() + 1, range.begin());
+    }
+    for (uint64_t point = range.begin(); point <= range.end(); point++) {
+      result.insert(point);
+    }
+  }
+
+  return result;
+}
+
+
+// Checks the Resource::Ranges operators against doing the same
+// operations on the integers contained in the ranges.
+TEST(ResourcesTest, RangesRandomized)
+{
+  unsigned int seed = 42;
+
+  for (int i = 0; i < 1000; i++) {
+    set<uint64_t> left;
+    set<uint64_t> right;
+
+    Resource::Ranges ranges1 = random(&seed, &left);
+    Resource::Ranges ranges2 = random(&seed, &right);
+
+    set<uint64_t> sum = left;
+    sum.insert(right.begin(), right.end());
+
+    set<uint64_t> difference;
+    std::set_difference(left.begin(), left.end(),
+                        right.begin(), right.end(),
+                        std::inserter(difference, difference.begin()));
+
+    EXPECT_EQ(left, points(ranges1 + IntervalSet().ranges()));
+    EXPECT_EQ(sum, points(ranges1 + ranges2));
+    EXPECT_EQ(difference, points(ranges1 - ranges2));
+
+    Resource::Ranges temp = ranges1;
+    temp += ranges2;
+    EXPECT_EQ(sum, points(temp));
+
+    temp = ranges1;
+    temp -= ranges2;
+    EXPECT_EQ(difference, points(temp));
+
+    EXPECT_EQ(left == right, ranges1 == ranges2);
+
+    EXPECT_EQ(std::includes(right.begin(), right.end(),
+                            left.begin(), left.end()),
+              ranges1 <= ranges2);
+
+    EXPECT_TRUE((ranges1 - ranges2) <= ranges1);
+    EXPECT_TRUE(ranges1 <= (ranges1 + ranges2));
+  }
+}
+
+
+// Measures adding, checking and removing ports one at a time from a
+// slave that has many fragmented ranges of ports.
+TEST(ResourcesTest, DISABLED_RangesBenchmark)
+{
+  Resource::Ranges ports;
+  for (uint64_t port = 0; port < 100000; port += 2) {
+    Resource::Range* range = ports.add_range();
+    range->set_begin(port);
+    range->set_end(port);
+  }
+
+  ports = ports + Resource::Ranges();
+
+  double start = Clock::now();
+
+  IntervalSet intervals(ports);
+  for (uint64_t port = 0; port < 100000; port += 2) {
+    ASSERT_TRUE(intervals.contains(port, port));
+    intervals.remove(port, port);
+    intervals.add(port, port);
+  }
+
+  EXPECT_TRUE(IntervalSet(ports) == intervals);
+
+  cout << ports.range_size() << " ranges: "
+       << (Clock::now() - start) * 1000 << " ms" << endl;
+}
+
 TEST(ResourcesTest, SetEquals)
 {
   Resource disks = Resources::parse("disks", "{sda1}");
@@ -337,3 +473,109 @@ TEST(ResourcesTest, SetSubtraction)
   EXPECT_EQ(1, set.item_size());
   EXPECT_EQ("sda1", set.item(0));
 }
+
+
+TEST(ResourcesTest, ResourceVectorConversion)
+{
+  Resources r = Resources::parse("cpus:45.55;"
+                                 "mem:1024;"
+                                 "ports:[10000-20000, 30000-50000];"
+                                 "disks:{sda1, sda2}");
+
+  ResourceVector vector = r;
+
+  EXPECT_EQ(4, vector.size());
+  EXPECT_EQ(45.55, vector.scalar("cpus"));
+  EXPECT_EQ(1024, vector.scalar("mem"));
+  EXPECT_EQ(0, vector.scalar("disk"));
+
+  EXPECT_EQ(r, vector.resources());
+  EXPECT_EQ(vector, ResourceVector(vector.resources()));
+}
+
+
+TEST(ResourcesTest, ResourceVectorArithmetic)
+{
+  ResourceVector r1 = Resources::parse("cpus:4;"
+                                       "ports:[1-10, 20-30];"
+                                       "disks:{sda1, sda2}");
+
+  ResourceVector r2 = Resources::parse("cpus:1;"
+                                       "ports:[5-7, 11-19];"
+                                       "disks:{sda2}");
+
+  ResourceVector sum = r1 + r2;
+  EXPECT_EQ(5, sum.scalar("cpus"));
+  EXPECT_EQ(Resources::parse("cpus:5;ports:[1-30];disks:{sda1, sda2}"),
+            sum.resources());
+
+  ResourceVector difference = r1 - r2;
+  EXPECT_EQ(3, difference.scalar("cpus"));
+  EXPECT_EQ(Resources::parse("cpus:3;ports:[1-4, 8-10, 20-30];disks:{sda1}"),
+            difference.resources());
+
+  EXPECT_TRUE(difference <= r1);
+  EXPECT_FALSE(r1 <= difference);
+  EXPECT_FALSE(r2 <= r1);
+
+  // A resource that isn't present counts as zero/empty.
+  ResourceVector zero = r1 - r1;
+  EXPECT_EQ(3, zero.size());
+  EXPECT_TRUE(zero <= ResourceVector());
+  EXPECT_TRUE(zero <= r1);
+  EXPECT_FALSE(r1 <= zero);
+
+  // Subtracting a resource that isn't present is a no-op, but the
+  // resource stays present after subtracting all of it.
+  ResourceVector r3 = Resources::parse("cpus:1");
+  r3 -= Resources::parse("cpus:1;mem:1024");
+  EXPECT_EQ(1, r3.size());
+  EXPECT_EQ(0, r3.scalar("cpus"));
+  EXPECT_EQ(0, r3.allocatable().size());
+  EXPECT_EQ(0, r3.scalar("mem"));
+}
+
+
+// Compares the time it takes to do the accounting the master does
+// for a slave (adding and removing tasks and computing the free
+// resources) using Resources and ResourceVector.
+TEST(ResourcesTest, DISABLED_ResourceVectorBenchmark)
+{
+  const int iterations = 100000;
+
+  Resources total = Resources::parse("cpus:16;mem:65536;disk:1048576;"
+                                     "ports:[31000-32000]");
+  Resources task = Resources::parse("cpus:1;mem:1024;disk:1024;"
+                                    "ports:[31000-31000]");
+
+  double start = Clock::now();
+
+  Resources used;
+  for (int i = 0; i < iterations; i++) {
+    used += task;
+    Resources free = total - used;
+    used -= task;
+  }
+
+  double resources = Clock::now() - start;
+
+  ResourceVector totalVector = total;
+  ResourceVector taskVector = task;
+
+  start = Clock::now();
+
+  ResourceVector usedVector;
+  for (int i = 0; i < iterations; i++) {
+    usedVector += taskVector;
+    ResourceVector free = totalVector - usedVector;
+    usedVector -= taskVector;
+  }
+
+  double dense = Clock::now() - start;
+
+  EXPECT_EQ(used, usedVector.resources());
+
+  cout << iterations << " iterations: "
+       << resources * 1000 << " ms (Resources), "
+       << dense * 1000 << " ms (ResourceVector)" << endl;
+}
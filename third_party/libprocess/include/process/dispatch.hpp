@@ -972,8 +972,6 @@ void dispatcher(ProcessBase* process,
 }
 
 
-typedef std::tr1::function<void(ProcessBase*)> Dispatcher;
-
 // Dispatches a call on the specified process.
 void dispatch(const UPID& pid, Dispatcher* dispatcher);
 
@@ -55,7 +55,7 @@ public:
 
   // Return the value associated with this future, waits indefinitely
   // until a value gets associated or until the future is discarded.
-  T get() const;
+  const T& get() const;
 
   // Returns the failure message associated with this future.
   std::string failure() const;
@@ -414,7 +414,7 @@ bool Future<T>::await(double secs) const
 
 
 template <typename T>
-T Future<T>::get() const
+const T& Future<T>::get() const
 {
   if (!isReady()) {
     await();
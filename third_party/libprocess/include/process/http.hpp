@@ -16,6 +16,10 @@ struct HttpRequest
   std::string query;
   std::string body;
   bool keepAlive;
+
+  // Requests get allocated from a pool (see src/pool.hpp).
+  static void* operator new(size_t size);
+  static void operator delete(void* p, size_t size);
 };
 
 
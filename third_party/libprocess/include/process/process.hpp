@@ -32,6 +32,10 @@ struct Message {
   UPID from;
   UPID to;
   std::string body;
+
+  // Messages get allocated from a pool (see src/pool.hpp).
+  static void* operator new(size_t size);
+  static void operator delete(void* p, size_t size);
 };
 
 
@@ -44,6 +48,30 @@ public:
 };
 
 
+// Forward declaration (see src/mailbox.hpp).
+template <typename T>
+class Mailbox;
+
+
+class ProcessBase;
+
+
+namespace internal {
+
+// A function that gets invoked on (i.e., dispatched to) a process.
+// Dispatchers get allocated from a pool (see src/pool.hpp).
+struct Dispatcher : std::tr1::function<void(ProcessBase*)>
+{
+  template <typename F>
+  Dispatcher(const F& f) : std::tr1::function<void(ProcessBase*)>(f) {}
+
+  static void* operator new(size_t size);
+  static void operator delete(void* p, size_t size);
+};
+
+} // namespace internal {
+
+
 class Filter {
 public:
   // TODO(benh): Support filtering HTTP requests?
@@ -121,7 +149,11 @@ protected:
   // Delegate incoming message's with the specified name to pid.
   void delegate(const std::string& name, const UPID& pid)
   {
-    delegates[name] = pid;
+    pthread_mutex_lock(&delegatesMutex);
+    {
+      delegates[name] = pid;
+    }
+    pthread_mutex_unlock(&delegatesMutex);
   }
 
   typedef std::tr1::function<void()> MessageHandler;
@@ -190,24 +222,48 @@ private:
   void lock() { pthread_mutex_lock(&m); }
   void unlock() { pthread_mutex_unlock(&m); }
 
-  // Enqueue the specified message, request, or dispatcher.
+  // Enqueue the specified message, request, or dispatcher (safe to
+  // call from any thread without holding the lock).
   void enqueue(Message* message, bool inject = false);
   void enqueue(std::pair<HttpRequest*, Promise<HttpResponse>*>* request);
-  void enqueue(std::tr1::function<void(ProcessBase*)>* dispatcher);
+  void enqueue(internal::Dispatcher* dispatcher);
+
+  // Wakes up the process if it is blocked waiting for what was just
+  // enqueued (a message if 'message' is true).
+  void notify(bool message);
 
   // Dequeue a message, request, or dispatcher, or returns NULL.
   template <typename T> T* dequeue();
 
-  // Queue of received messages.
+  // Moves everything in the mailbox into the queues below (only
+  // invoked by the process itself).
+  void drain();
+
+  // Updates the handler statistics (below) for a handler that
+  // started running at 'start' (and just returned).
+  void handled(double start);
+
+  // Everything enqueued (messages, requests, and dispatchers) goes
+  // through a single lock-free mailbox in order to keep the relative
+  // ordering between them (and so that enqueueing does not need to
+  // acquire the lock).
+  struct Envelope;
+  Mailbox<Envelope>* mailbox;
+
+  // Queue of received messages (drained from the mailbox).
   std::deque<Message*> messages;
 
   // Queue of HTTP requests (with the promise used for responses).
   std::deque<std::pair<HttpRequest*, Promise<HttpResponse>*>*> requests;
 
   // Queue of dispatchers.
-  std::deque<std::tr1::function<void(ProcessBase*)>*> dispatchers;
+  std::deque<internal::Dispatcher*> dispatchers;
 
-  // Delegates for messages.
+  // Delegates for messages. These are looked up by whichever thread
+  // enqueues a message, so they get their own mutex (the process lock
+  // is held by the worker for as long as the process is running, and
+  // a process may enqueue messages to itself).
+  pthread_mutex_t delegatesMutex;
   std::map<std::string, UPID> delegates;
 
   // Handlers for messages.
@@ -225,6 +281,19 @@ private:
   // Current "blocking" generation.
   int generation;
 
+  // Index of the processing thread this process last ran on (-1 if
+  // it has never run), used to keep a process on the same thread.
+  int thread;
+
+  // Statistics (served at /__processes__). The number of things
+  // enqueued but not yet dequeued, the number of things dequeued, and
+  // the total and maximum number of seconds spent in handlers.
+  volatile int pending;
+  uint64_t dequeued;
+  uint64_t handlers;
+  double handlerTime;
+  double maxHandlerTime;
+
   // Process PID.
   UPID pid;
 
@@ -262,11 +331,19 @@ void initialize(bool initialize_google_logging = true);
 template <typename T>
 PID<T> spawn(T* t, bool manage = false)
 {
-  if (!ProcessBase::spawn(t, manage)) {
-    return PID<T>();
+  // Note that we can't construct the PID from 't' after spawning it
+  // since it might have already exited (and been garbage collected).
+  const UPID pid = ProcessBase::spawn(t, manage);
+
+  PID<T> result;
+
+  if (pid) {
+    result.id = pid.id;
+    result.ip = pid.ip;
+    result.port = pid.port;
   }
 
-  return PID<T>(t);
+  return result;
 }
 
 template <typename T>
@@ -225,6 +225,32 @@ protected:
     delete m;
   }
 
+  template <typename M,
+            typename P1, typename P1C,
+            typename P2, typename P2C,
+            typename P3, typename P3C,
+            typename P4, typename P4C,
+            typename P5, typename P5C,
+            typename P6, typename P6C>
+  void installProtobufHandler(
+      void (T::*method)(P1C, P2C, P3C, P4C, P5C, P6C),
+      P1 (M::*p1)() const,
+      P2 (M::*p2)() const,
+      P3 (M::*p3)() const,
+      P4 (M::*p4)() const,
+      P5 (M::*p5)() const,
+      P6 (M::*p6)() const)
+  {
+    google::protobuf::Message* m = new M();
+    T* t = static_cast<T*>(this);
+    protobufHandlers[m->GetTypeName()] =
+      std::tr1::bind(&handler6<M, P1, P1C, P2, P2C, P3, P3C,
+                               P4, P4C, P5, P5C, P6, P6C>,
+                     t, method, p1, p2, p3, p4, p5, p6,
+                     std::tr1::placeholders::_1);
+    delete m;
+  }
+
 private:
   template <typename M>
   static void handlerM(T* t, void (T::*method)(const M&),
@@ -356,6 +382,38 @@ private:
     }
   }
 
+  template <typename M,
+            typename P1, typename P1C,
+            typename P2, typename P2C,
+            typename P3, typename P3C,
+            typename P4, typename P4C,
+            typename P5, typename P5C,
+            typename P6, typename P6C>
+  static void handler6(T* t,
+                       void (T::*method)(P1C, P2C, P3C, P4C, P5C, P6C),
+                       P1 (M::*p1)() const,
+                       P2 (M::*p2)() const,
+                       P3 (M::*p3)() const,
+                       P4 (M::*p4)() const,
+                       P5 (M::*p5)() const,
+                       P6 (M::*p6)() const,
+                       const std::string& data)
+  {
+    M m;
+    m.ParseFromString(data);
+    if (m.IsInitialized()) {
+      (t->*method)(google::protobuf::convert((&m->*p1)()),
+                   google::protobuf::convert((&m->*p2)()),
+                   google::protobuf::convert((&m->*p3)()),
+                   google::protobuf::convert((&m->*p4)()),
+                   google::protobuf::convert((&m->*p5)()),
+                   google::protobuf::convert((&m->*p6)()));
+    } else {
+      LOG(WARNING) << "Initialization errors: "
+                   << m.InitializationErrorString();
+    }
+  }
+
   typedef std::tr1::function<void(const std::string&)> handler;
   std::tr1::unordered_map<std::string, handler> protobufHandlers;
 };
@@ -1,14 +1,25 @@
 #ifndef __PROCESS_TIMER_HPP__
 #define __PROCESS_TIMER_HPP__
 
+#include <tr1/memory>
+
 #include <process/dispatch.hpp>
 #include <process/process.hpp>
 
 
 namespace process {
 
-class TimerProcess;
+namespace internal {
+
+// Forward declaration (see process.cpp).
+struct TimerEntry;
+
+} // namespace internal {
+
 
+// A handle to a delayed dispatch. Timers don't get their own process,
+// they get put in a timing wheel that the I/O thread advances, so
+// creating and canceling a timer is cheap.
 class Timer
 {
 public:
@@ -16,10 +27,12 @@ public:
 
   virtual ~Timer();
 
+  // Cancels the dispatch if it has not yet been made (otherwise does
+  // nothing). Canceling is O(1).
   void cancel();
 
 private:
-  PID<TimerProcess> timer;
+  std::tr1::shared_ptr<internal::TimerEntry> entry;
 };
 
 
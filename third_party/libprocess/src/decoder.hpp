@@ -2,23 +2,31 @@
 #define __DECODER_HPP__
 
 #include <http_parser.h>
+#include <string.h>
+
+#include <arpa/inet.h>
 
 #include <deque>
 #include <string>
 #include <vector>
 
 #include <process/http.hpp>
+#include <process/process.hpp>
 
 #include "foreach.hpp"
+#include "framing.hpp"
 
 
 namespace process {
 
+// Decodes HTTP requests until the other side of the connection
+// switches to binary framing, after which it decodes messages straight
+// from the frames (see framing.hpp).
 class DataDecoder
 {
 public:
   DataDecoder()
-    : failure(false), request(NULL)
+    : failure(false), binary(false), request(NULL)
   {
     settings.on_message_begin = &DataDecoder::on_message_begin;
     settings.on_header_field = &DataDecoder::on_header_field;
@@ -38,10 +46,20 @@ public:
 
   std::deque<HttpRequest*> decode(const char* data, size_t length)
   {
-    size_t parsed = http_parser_execute(&parser, &settings, data, length);
-
-    if (parsed != length) {
-      failure = true;
+    if (binary) {
+      unframe(data, length);
+    } else {
+      size_t parsed = http_parser_execute(&parser, &settings, data, length);
+
+      if (binary) {
+        // Everything after the UPGRADE request is frames. Note that
+        // http_parser stops *on* the last byte of a request that
+        // upgrades the connection (rather than after it).
+        assert(parsed < length);
+        unframe(data + parsed + 1, length - parsed - 1);
+      } else if (parsed != length) {
+        failure = true;
+      }
     }
 
     if (!requests.empty()) {
@@ -53,11 +71,27 @@ public:
     return std::deque<HttpRequest*>();
   }
 
+  // Returns the messages decoded from frames so far (these always
+  // come after any requests returned from 'decode'). The messages are
+  // addressed using just the id of the receiver.
+  std::deque<Message*> messages()
+  {
+    std::deque<Message*> result;
+    result.swap(decoded);
+    return result;
+  }
+
   bool failed() const
   {
     return failure;
   }
 
+  // Whether or not the other side switched to binary framing.
+  bool upgraded() const
+  {
+    return binary;
+  }
+
 private:
   static int on_message_begin(http_parser* p)
   {
@@ -87,6 +121,14 @@ private:
     DataDecoder* decoder = (DataDecoder*) p->data;
     decoder->request->method = http_method_str((http_method) decoder->parser.method);
     decoder->request->keepAlive = http_should_keep_alive(&decoder->parser);
+
+    // Don't lose the last header.
+    if (!decoder->field.empty()) {
+      decoder->request->headers[decoder->field] = decoder->value;
+      decoder->field.clear();
+      decoder->value.clear();
+    }
+
     return 0;
   }
 
@@ -96,7 +138,14 @@ private:
 //     std::cout << "HttpRequest:" << std::endl;
 //     std::cout << "  method: " << decoder->request->method << std::endl;
 //     std::cout << "  path: " << decoder->request->path << std::endl;
-    decoder->requests.push_back(decoder->request);
+    if (decoder->parser.upgrade &&
+        decoder->request->headers["Upgrade"] == framing::PROTOCOL) {
+      // The other side switched to binary framing (see decode).
+      delete decoder->request;
+      decoder->binary = true;
+    } else {
+      decoder->requests.push_back(decoder->request);
+    }
     decoder->request = NULL;
     return 0;
   }
@@ -167,8 +216,122 @@ private:
     return 0;
   }
 
+  // Decodes as many frames as possible, buffering whatever is left of
+  // a frame that isn't complete yet.
+  void unframe(const char* data, size_t length)
+  {
+    if (failure) {
+      return;
+    }
+
+    // Only copy the data when a frame spans multiple reads.
+    const bool buffered = !buffer.empty();
+
+    if (buffered) {
+      buffer.append(data, length);
+      data = buffer.data();
+      length = buffer.size();
+    }
+
+    size_t offset = 0;
+
+    while (length - offset >= 4) {
+      uint32_t size;
+      memcpy(&size, data + offset, sizeof(size));
+      size = ntohl(size);
+
+      if (size > framing::MAX_FRAME) {
+        failure = true;
+        buffer.clear();
+        return;
+      }
+
+      if (length - offset - 4 < size) {
+        break;
+      }
+
+      const char* start = data + offset + 4;
+
+      Message* message = frame(start, start + size);
+
+      if (message == NULL) {
+        failure = true;
+        buffer.clear();
+        return;
+      }
+
+      decoded.push_back(message);
+      offset += 4 + size;
+    }
+
+    if (buffered) {
+      buffer.erase(0, offset);
+    } else {
+      buffer.assign(data + offset, length - offset);
+    }
+  }
+
+  // Decodes a single frame (without the length) or returns NULL.
+  Message* frame(const char* p, const char* end)
+  {
+    Message* message = new Message();
+
+    uint16_t port;
+
+    if (!atom(&p, end, &message->from.id) ||
+        end - p < (ptrdiff_t) (sizeof(message->from.ip) + sizeof(port))) {
+      delete message;
+      return NULL;
+    }
+
+    memcpy(&message->from.ip, p, sizeof(message->from.ip));
+    p += sizeof(message->from.ip);
+    memcpy(&port, p, sizeof(port));
+    p += sizeof(port);
+    message->from.port = ntohs(port);
+
+    if (!atom(&p, end, &message->to.id) ||
+        !atom(&p, end, &message->name)) {
+      delete message;
+      return NULL;
+    }
+
+    message->body.assign(p, end - p);
+
+    return message;
+  }
+
+  bool atom(const char** p, const char* end, std::string* s)
+  {
+    uint32_t value;
+    if (!framing::get(p, end, &value)) {
+      return false;
+    }
+
+    if ((value & 1) == 0) {
+      if ((value >> 1) >= atoms.size()) {
+        return false;
+      }
+      *s = atoms[value >> 1];
+    } else {
+      if ((uint32_t) (end - *p) < (value >> 1)) {
+        return false;
+      }
+      s->assign(*p, value >> 1);
+      *p += value >> 1;
+      if (atoms.size() < framing::MAX_ATOMS) {
+        atoms.push_back(*s);
+      }
+    }
+
+    return true;
+  }
+
   bool failure;
 
+  // Whether or not the other side switched to binary framing.
+  bool binary;
+
   http_parser parser;
   http_parser_settings settings;
 
@@ -183,6 +346,14 @@ private:
   HttpRequest* request;
 
   std::deque<HttpRequest*> requests;
+
+  // Atoms received so far (see framing.hpp).
+  std::vector<std::string> atoms;
+
+  // What's been received of a frame that isn't complete yet.
+  std::string buffer;
+
+  std::deque<Message*> decoded;
 };
 
 }  // namespace process {
@@ -1,52 +1,154 @@
 #ifndef __ENCODER_HPP__
 #define __ENCODER_HPP__
 
+#include <string.h>
+
+#include <arpa/inet.h>
+
+#include <glog/logging.h>
+
+#include <sys/uio.h>
+
+#include <algorithm>
 #include <sstream>
+#include <utility>
+#include <vector>
 
+#include <process/future.hpp>
+#include <process/http.hpp>
 #include <process/process.hpp>
 
+#include "framing.hpp"
+#include "pool.hpp"
+
 
 namespace process {
 
+// An encoder holds the data to be sent on a socket as a sequence of
+// buffers that get handed to the kernel as an iovec (see send_data),
+// so that a message body never needs to be copied into the same
+// string as its header.
 class DataEncoder
 {
 public:
   DataEncoder(const std::string& _data)
-    : data(_data), index(0) {}
+    : data(_data), index(0), offset(0), size(0)
+  {
+    append(data.data(), data.size());
+  }
 
   virtual ~DataEncoder() {}
 
-  const char* next(size_t* length)
+  // Encoders get allocated from a pool (see pool.hpp).
+  static void* operator new(size_t size)
   {
-    size_t temp = index;
-    index = data.size();
-    *length = data.size() - temp;
-    return data.data() + temp;
+    return pool()->allocate(size);
+  }
+
+  static void operator delete(void* p, size_t size)
+  {
+    pool()->deallocate(p, size);
+  }
+
+  // Fills in at most 'count' iovecs with the data that still needs to
+  // be sent and returns the number of iovecs filled in.
+  int next(struct iovec* iov, int count) const
+  {
+    int filled = 0;
+    size_t i = index;
+    size_t skip = offset;
+    while (filled < count && i < buffers.size()) {
+      iov[filled].iov_base = (void*) (buffers[i].first + skip);
+      iov[filled].iov_len = buffers[i].second - skip;
+      filled++;
+      i++;
+      skip = 0;
+    }
+    return filled;
   }
 
-  void backup(size_t length)
+  // Marks 'length' bytes of the remaining data as sent.
+  void advance(size_t length)
   {
-    if (index >= length) {
-      index -= length;
+    CHECK(length <= size);
+    size -= length;
+    while (length > 0) {
+      size_t available = buffers[index].second - offset;
+      if (length < available) {
+        offset += length;
+        break;
+      }
+      length -= available;
+      index++;
+      offset = 0;
     }
   }
 
   size_t remaining() const
   {
-    return data.size() - index;
+    return size;
+  }
+
+protected:
+  DataEncoder() : index(0), offset(0), size(0) {}
+
+  // Adds a buffer to be sent. The buffer must remain valid (and
+  // unchanged) for the lifetime of the encoder.
+  void append(const char* buffer, size_t length)
+  {
+    if (length > 0) {
+      buffers.push_back(std::make_pair(buffer, length));
+      size += length;
+    }
   }
 
 private:
+  static Pool* pool();
+
   const std::string data;
-  size_t index;
+  std::vector<std::pair<const char*, size_t> > buffers;
+  size_t index; // Buffer to send from next.
+  size_t offset; // Offset into that buffer.
+  size_t size; // Bytes remaining.
 };
 
 
 class MessageEncoder : public DataEncoder
 {
 public:
-  MessageEncoder(Message* _message)
-    : DataEncoder(encode(_message)), message(_message) {}
+  // Encodes the message as an HTTP request, including the headers that
+  // advertise binary framing and a persistent connection if
+  // 'advertise' is true (see framing.hpp).
+  MessageEncoder(Message* _message, bool advertise = false)
+    : message(_message)
+  {
+    CHECK(message != NULL);
+
+    header = encode(message, advertise);
+
+    // Send the body straight out of the message (no copying).
+    append(header.data(), header.size());
+    if (message->body.size() > 0) {
+      append(message->body.data(), message->body.size());
+
+      // End the (one and only) chunk and then the chunked body.
+      append("\r\n0\r\n\r\n", 7);
+    }
+  }
+
+  // Encodes the message as a binary frame using (and updating) the
+  // atoms of the connection it gets sent on (see framing.hpp).
+  MessageEncoder(Message* _message, framing::Atoms* atoms)
+    : message(_message)
+  {
+    CHECK(message != NULL);
+    CHECK(atoms != NULL);
+
+    header = frame(message, atoms);
+
+    append(header.data(), header.size());
+    append(message->body.data(), message->body.size());
+  }
 
   virtual ~MessageEncoder()
   {
@@ -55,42 +157,74 @@ public:
     }
   }
 
-  static std::string encode(Message* message)
+  // Returns the header (everything up until the body) of the HTTP
+  // request used to send the message.
+  static std::string encode(Message* message, bool advertise = false)
   {
-    if (message != NULL) {
-      std::ostringstream out;
-
-      out << "POST /" << message->to.id << "/" << message->name
-          << " HTTP/1.0\r\n"
-          << "User-Agent: libprocess/" << message->from << "\r\n"
-          << "Connection: Keep-Alive\r\n";
-
-      if (message->body.size() > 0) {
-        out << "Transfer-Encoding: chunked\r\n\r\n"
-            << std::hex << message->body.size() << "\r\n";
-        out.write(message->body.data(), message->body.size());
-        out << "\r\n"
-            << "0\r\n"
-            << "\r\n";
-      } else {
-        out << "\r\n";
-      }
+    std::ostringstream out;
 
-      return out.str();
+    out << "POST /" << message->to.id << "/" << message->name
+        << " HTTP/1.0\r\n"
+        << "User-Agent: libprocess/" << message->from << "\r\n"
+        << "Connection: Keep-Alive\r\n";
+
+    if (advertise) {
+      out << framing::HEADER << ": " << framing::PROTOCOL << "\r\n"
+          << framing::PERSISTENT << ": true\r\n";
+    }
+
+    if (message->body.size() > 0) {
+      out << "Transfer-Encoding: chunked\r\n\r\n"
+          << std::hex << message->body.size() << "\r\n";
+    } else {
+      out << "\r\n";
     }
+
+    return out.str();
+  }
+
+  // Returns the header (everything up until the body) of the binary
+  // frame used to send the message.
+  static std::string frame(Message* message, framing::Atoms* atoms)
+  {
+    std::string out(4, '\0');
+
+    atoms->encode(message->from.id, &out);
+
+    const uint32_t ip = message->from.ip; // Already in network order.
+    const uint16_t port = htons(message->from.port);
+    out.append((const char*) &ip, sizeof(ip));
+    out.append((const char*) &port, sizeof(port));
+
+    atoms->encode(message->to.id, &out);
+    atoms->encode(message->name, &out);
+
+    const uint32_t length = htonl(out.size() - 4 + message->body.size());
+    memcpy(&out[0], &length, sizeof(length));
+
+    return out;
   }
 
 private:
   Message* message;
+  std::string header;
 };
 
 
 class HttpResponseEncoder : public DataEncoder
 {
 public:
-  HttpResponseEncoder(const HttpResponse& response)
-    : DataEncoder(encode(response)) {}
+  // Keeps a reference to the (ready) future so that the body can be
+  // sent straight out of the response without copying it.
+  HttpResponseEncoder(const Future<HttpResponse>& _response)
+    : response(_response), header(encode(_response.get()))
+  {
+    append(header.data(), header.size());
+    append(response.get().body.data(), response.get().body.size());
+  }
 
+  // Returns the status line and headers of the response (everything
+  // up until the body).
   static std::string encode(const HttpResponse& response)
   {
     std::ostringstream out;
@@ -126,13 +260,23 @@ public:
 
     out << "\r\n";
 
-    out.write(response.body.data(), response.body.size());
-
     return out.str();
   }
+
+private:
+  const Future<HttpResponse> response;
+  const std::string header;
 };
 
 
+inline Pool* DataEncoder::pool()
+{
+  static Pool* pool = new Pool(
+      "encoders",
+      std::max(sizeof(MessageEncoder), sizeof(HttpResponseEncoder)));
+  return pool;
+}
+
 }  // namespace process {
 
 #endif // __ENCODER_HPP__
@@ -0,0 +1,117 @@
+#ifndef __FRAMING_HPP__
+#define __FRAMING_HPP__
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+
+
+namespace process {
+namespace framing {
+
+// Messages between two nodes start out as HTTP requests (see
+// MessageEncoder), but a connection switches to a more compact binary
+// framing when both nodes support it:
+//
+//   (1) The node that made the connection includes the HEADER in the
+//       first message it sends on it.
+//   (2) A node that sees the HEADER (or gets an UPGRADE request) on a
+//       connection sends an UPGRADE request of its own on it and
+//       sends every message after that as a frame.
+//   (3) A node that gets an UPGRADE request on a connection decodes
+//       everything after it as frames (see DataDecoder).
+//
+// Older nodes ignore the HEADER so connections to and from them keep
+// using HTTP in both directions.
+//
+// A frame is the length of the rest of the frame (4 bytes, network
+// order) followed by the id, ip (4 bytes) and port (2 bytes) of the
+// sender, the id of the receiver, the name of the message and then
+// the body. The ids and the name are "atoms": the first time a string
+// gets sent on a connection it is sent in full and assigned the next
+// index, after that just its index gets sent (the receiving side
+// assigns the same indexes as it decodes the frames). An atom is
+// encoded as a varint which is either (index << 1) or ((length << 1)
+// | 1) followed by the string.
+
+const char HEADER[] = "Libprocess-Framing";
+
+// Independently of the framing, the node that made a connection also
+// includes the PERSISTENT header in the first message it sends on it
+// to declare that it keeps the connection open, which lets the other
+// node use it for sending back (see SocketManager). Older nodes don't
+// include it since they might close a connection at any time.
+const char PERSISTENT[] = "Libprocess-Persistent";
+
+const char PROTOCOL[] = "libprocess/1";
+
+const char UPGRADE[] =
+  "GET /__framing__ HTTP/1.1\r\n"
+  "Upgrade: libprocess/1\r\n"
+  "Connection: Upgrade\r\n"
+  "\r\n";
+
+// Maximum length of a frame (a connection that gets sent a longer one
+// is closed rather than buffering it). Protocol buffers refuse to parse
+// messages this large anyway.
+const uint32_t MAX_FRAME = 64 * 1024 * 1024;
+
+// Maximum number of atoms per connection (strings sent after that
+// just don't get assigned an index).
+const size_t MAX_ATOMS = 4096;
+
+
+inline void put(uint32_t value, std::string* out)
+{
+  while (value >= 0x80) {
+    out->push_back((char) ((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back((char) value);
+}
+
+
+inline bool get(const char** p, const char* end, uint32_t* value)
+{
+  *value = 0;
+  for (int shift = 0; shift < 32 && *p < end; shift += 7) {
+    const uint8_t byte = (uint8_t) *(*p)++;
+    *value |= (uint32_t) (byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+// The atoms sent on a connection (sending side).
+class Atoms
+{
+public:
+  void encode(const std::string& s, std::string* out)
+  {
+    std::map<std::string, uint32_t>::const_iterator iterator =
+      indexes.find(s);
+
+    if (iterator != indexes.end()) {
+      put(iterator->second << 1, out);
+    } else {
+      put((s.size() << 1) | 1, out);
+      out->append(s);
+      if (indexes.size() < MAX_ATOMS) {
+        const uint32_t index = indexes.size();
+        indexes[s] = index;
+      }
+    }
+  }
+
+private:
+  std::map<std::string, uint32_t> indexes;
+};
+
+} // namespace framing {
+} // namespace process {
+
+#endif // __FRAMING_HPP__
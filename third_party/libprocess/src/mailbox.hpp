@@ -0,0 +1,113 @@
+#ifndef __MAILBOX_HPP__
+#define __MAILBOX_HPP__
+
+#include <stdlib.h>
+
+
+namespace process {
+
+// An intrusive, lock-free, multiple-producer/single-consumer queue
+// (based on the algorithm by Dmitry Vyukov). Any number of threads
+// may 'push' concurrently, but only a single thread at a time (the
+// consumer) may 'pop'. The type T must have a member 'T* volatile
+// next' which the mailbox uses to link elements together (and hence
+// an element can only be in one mailbox at a time).
+//
+// N.B. A 'pop' can return NULL while a concurrent 'push' is still in
+// progress even though the mailbox is not empty. A consumer that
+// needs to block when the mailbox is empty must therefore arrange
+// for producers to check for a blocked consumer *after* their push
+// completes (see ProcessBase::enqueue).
+template <typename T>
+class Mailbox
+{
+public:
+  Mailbox()
+  {
+    stub.next = NULL;
+    head = &stub;
+    tail = &stub;
+  }
+
+  // Pushes the element onto the back of the mailbox. Also acts as a
+  // full memory barrier *after* the element has been linked in (the
+  // compare-and-swap alone doesn't order the link with any loads that
+  // follow the push, e.g., of a blocked consumer's state).
+  void push(T* t)
+  {
+    t->next = NULL;
+    T* previous = exchange(t);
+    previous->next = t;
+    __sync_synchronize();
+  }
+
+  // Pops the element at the front of the mailbox or returns NULL.
+  T* pop()
+  {
+    T* t = tail;
+    T* next = t->next;
+
+    // Skip the stub (it is only in the mailbox to make sure the
+    // mailbox is never actually empty).
+    if (t == &stub) {
+      if (next == NULL) {
+        return NULL;
+      }
+      tail = next;
+      t = next;
+      next = next->next;
+    }
+
+    if (next != NULL) {
+      tail = next;
+      return t;
+    }
+
+    // Either 't' is the last element or a producer has "swung" the
+    // head but not yet linked its element, in which case we give up
+    // for now.
+    if (t != head) {
+      return NULL;
+    }
+
+    // Put the stub back so that we can remove the last element.
+    push(&stub);
+
+    next = t->next;
+
+    if (next != NULL) {
+      tail = next;
+      return t;
+    }
+
+    return NULL;
+  }
+
+private:
+  // Not copyable, not assignable.
+  Mailbox(const Mailbox&);
+  Mailbox& operator = (const Mailbox&);
+
+  // Atomically swaps 't' in as the new head and returns the old head.
+  T* exchange(T* t)
+  {
+    T* previous;
+    do {
+      previous = head;
+    } while (!__sync_bool_compare_and_swap(&head, previous, t));
+    return previous;
+  }
+
+  // Element most recently pushed (producers).
+  T* volatile head;
+
+  // Element to be popped next (consumer only).
+  T* tail;
+
+  // Placeholder that keeps the mailbox from ever becoming empty.
+  T stub;
+};
+
+} // namespace process {
+
+#endif // __MAILBOX_HPP__
@@ -0,0 +1,275 @@
+#ifndef __POOL_HPP__
+#define __POOL_HPP__
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace process {
+
+// A pool of fixed size blocks of memory for the objects that get
+// allocated (and freed) for every message, such as the messages
+// themselves, requests, dispatchers and watchers. Each thread keeps
+// its own list of free blocks so that allocating and freeing doesn't
+// require any synchronization. Objects often get allocated by one
+// thread (e.g., an I/O thread decoding messages) and freed by another
+// (e.g., the worker running the receiving process), so a thread that
+// accumulates too many free blocks gives a batch of them back to the
+// pool, and a thread that runs out takes a batch from the pool before
+// resorting to malloc. Blocks never get returned to the system.
+//
+// Allocating more than the block size just uses malloc.
+class Pool
+{
+public:
+  Pool(const std::string& _name, size_t _size)
+    : name(_name),
+      size(_size < sizeof(Block) ? sizeof(Block) : _size),
+      index(__sync_fetch_and_add(&count(), 1)),
+      allocations(0), mallocs(0)
+  {
+    if (index >= MAX_POOLS) {
+      abort();
+    }
+
+    pthread_mutex_init(&mutex, NULL);
+
+    pthread_mutex_lock(&registry());
+    {
+      pools().push_back(this);
+    }
+    pthread_mutex_unlock(&registry());
+  }
+
+  void* allocate(size_t length)
+  {
+    if (length > size) {
+      __sync_fetch_and_add(&mallocs, 1);
+      return ::operator new(length);
+    }
+
+    Cache* cache = &caches()[index];
+
+    if (++cache->allocations == FLUSH) {
+      __sync_fetch_and_add(&allocations, cache->allocations);
+      cache->allocations = 0;
+    }
+
+    if (cache->head == NULL) {
+      refill(cache);
+    }
+
+    if (cache->head == NULL) {
+      __sync_fetch_and_add(&mallocs, 1);
+      return ::operator new(size);
+    }
+
+    Block* block = cache->head;
+    cache->head = block->next;
+    cache->count--;
+    return block;
+  }
+
+  void deallocate(void* p, size_t length)
+  {
+    if (p == NULL) {
+      return;
+    } else if (length > size) {
+      ::operator delete(p);
+      return;
+    }
+
+    Cache* cache = &caches()[index];
+
+    Block* block = (Block*) p;
+    block->next = cache->head;
+    cache->head = block;
+
+    if (++cache->count >= 2 * BATCH) {
+      release(cache);
+    }
+  }
+
+  // Returns the counters of every pool as a JSON array. The number of
+  // allocations is only approximate since each thread only adds its
+  // allocations to the total every so often.
+  static std::string statistics()
+  {
+    std::ostringstream out;
+
+    out << "[";
+
+    pthread_mutex_lock(&registry());
+    {
+      for (size_t i = 0; i < pools().size(); i++) {
+        Pool* pool = pools()[i];
+
+        size_t free = 0;
+        pthread_mutex_lock(&pool->mutex);
+        {
+          free = pool->batches.size() * BATCH;
+        }
+        pthread_mutex_unlock(&pool->mutex);
+
+        out << (i > 0 ? "," : "")
+            << "{\"name\":\"" << pool->name << "\""
+            << ",\"size\":" << pool->size
+            << ",\"allocations\":" << pool->allocations
+            << ",\"mallocs\":" << pool->mallocs
+            << ",\"free\":" << free
+            << "}";
+      }
+    }
+    pthread_mutex_unlock(&registry());
+
+    out << "]";
+
+    return out.str();
+  }
+
+  // Returns the number of times blocks (or objects too big for them)
+  // had to be allocated with malloc.
+  uint64_t misses() const
+  {
+    return mallocs;
+  }
+
+  // Returns the pool with the specified name (or NULL).
+  static Pool* find(const std::string& name)
+  {
+    Pool* result = NULL;
+
+    pthread_mutex_lock(&registry());
+    {
+      for (size_t i = 0; i < pools().size(); i++) {
+        if (pools()[i]->name == name) {
+          result = pools()[i];
+          break;
+        }
+      }
+    }
+    pthread_mutex_unlock(&registry());
+
+    return result;
+  }
+
+private:
+  // Not copyable, not assignable.
+  Pool(const Pool&);
+  Pool& operator = (const Pool&);
+
+  static const size_t MAX_POOLS = 16;
+  static const size_t BATCH = 64;
+  static const uint64_t FLUSH = 64;
+
+  struct Block
+  {
+    Block* next;
+  };
+
+  // Free blocks of a pool for a thread.
+  struct Cache
+  {
+    Block* head;
+    size_t count;
+    uint64_t allocations;
+  };
+
+  // Takes a batch of blocks from the pool (if there are any).
+  void refill(Cache* cache)
+  {
+    pthread_mutex_lock(&mutex);
+    {
+      if (!batches.empty()) {
+        cache->head = batches.back();
+        cache->count = BATCH;
+        batches.pop_back();
+      }
+    }
+    pthread_mutex_unlock(&mutex);
+  }
+
+  // Gives a batch of blocks back to the pool.
+  void release(Cache* cache)
+  {
+    Block* head = cache->head;
+    Block* last = head;
+    for (size_t i = 1; i < BATCH; i++) {
+      last = last->next;
+    }
+
+    cache->head = last->next;
+    cache->count -= BATCH;
+    last->next = NULL;
+
+    pthread_mutex_lock(&mutex);
+    {
+      batches.push_back(head);
+    }
+    pthread_mutex_unlock(&mutex);
+  }
+
+  static Cache* caches()
+  {
+    static __thread Cache caches[MAX_POOLS];
+    return caches;
+  }
+
+  static size_t& count()
+  {
+    static size_t count = 0;
+    return count;
+  }
+
+  static std::vector<Pool*>& pools()
+  {
+    static std::vector<Pool*>* pools = new std::vector<Pool*>();
+    return *pools;
+  }
+
+  static pthread_mutex_t& registry()
+  {
+    static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    return mutex;
+  }
+
+  const std::string name;
+  const size_t size;
+  const size_t index;
+
+  uint64_t allocations;
+  uint64_t mallocs;
+
+  // Batches of BATCH free blocks (protected by 'mutex').
+  std::vector<Block*> batches;
+  pthread_mutex_t mutex;
+};
+
+
+// Allocates (copy constructs) an object from a pool.
+template <typename T>
+T* create(Pool* pool, const T& t)
+{
+  return new (pool->allocate(sizeof(T))) T(t);
+}
+
+
+// Destroys an object that was allocated from a pool.
+template <typename T>
+void destroy(Pool* pool, T* t)
+{
+  if (t != NULL) {
+    t->~T();
+    pool->deallocate(t, sizeof(T));
+  }
+}
+
+} // namespace process {
+
+#endif // __POOL_HPP__
@@ -42,6 +42,7 @@
 #include <process/dispatch.hpp>
 #include <process/gc.hpp>
 #include <process/process.hpp>
+#include <process/timer.hpp>
 
 #include <boost/tuple/tuple.hpp>
 
@@ -50,9 +51,13 @@
 #include "encoder.hpp"
 #include "fatal.hpp"
 #include "foreach.hpp"
+#include "framing.hpp"
 #include "gate.hpp"
+#include "mailbox.hpp"
+#include "pool.hpp"
 #include "synchronized.hpp"
 #include "tokenize.hpp"
+#include "wheel.hpp"
 
 
 using boost::tuple;
@@ -61,7 +66,9 @@ using std::deque;
 using std::find;
 using std::list;
 using std::map;
+using std::make_pair;
 using std::max;
+using std::min;
 using std::ostream;
 using std::pair;
 using std::queue;
@@ -80,6 +87,9 @@ using std::tr1::function;
 #define Gigabyte (1024*Megabyte)
 #define PROCESS_STACK_SIZE (64*Kilobyte)
 
+/* Maximum number of buffers to hand to a single sendmsg. */
+#define SEND_IOVECS (64)
+
 
 #define malloc(bytes)                                               \
   ({ void *tmp;                                                     \
@@ -144,6 +154,144 @@ bool operator == (const timeout &left, const timeout &right)
 
 namespace process {
 
+/*
+ * Pools for the objects that get allocated for every message, request
+ * or dispatch (see pool.hpp). Each pool gets created when first used
+ * since some of these objects might get allocated before initialize.
+ */
+static Pool* messages_pool()
+{
+  static Pool* pool = new Pool("messages", sizeof(Message));
+  return pool;
+}
+
+
+static Pool* requests_pool()
+{
+  static Pool* pool = new Pool("requests", sizeof(HttpRequest));
+  return pool;
+}
+
+
+static Pool* promises_pool()
+{
+  static Pool* pool =
+    new Pool("promises", sizeof(pair<HttpRequest*, Promise<HttpResponse>*>));
+  return pool;
+}
+
+
+static Pool* dispatchers_pool()
+{
+  static Pool* pool = new Pool("dispatchers", sizeof(internal::Dispatcher));
+  return pool;
+}
+
+
+static Pool* watchers_pool()
+{
+  static Pool* pool = new Pool("watchers", sizeof(ev_io));
+  return pool;
+}
+
+
+void* Message::operator new(size_t size)
+{
+  return messages_pool()->allocate(size);
+}
+
+
+void Message::operator delete(void* p, size_t size)
+{
+  messages_pool()->deallocate(p, size);
+}
+
+
+void* HttpRequest::operator new(size_t size)
+{
+  return requests_pool()->allocate(size);
+}
+
+
+void HttpRequest::operator delete(void* p, size_t size)
+{
+  requests_pool()->deallocate(p, size);
+}
+
+
+void* internal::Dispatcher::operator new(size_t size)
+{
+  return dispatchers_pool()->allocate(size);
+}
+
+
+void internal::Dispatcher::operator delete(void* p, size_t size)
+{
+  dispatchers_pool()->deallocate(p, size);
+}
+
+
+/*
+ * Something enqueued for a process (see ProcessBase::enqueue). The
+ * 'next' pointer is used by the mailbox to link envelopes together.
+ */
+struct ProcessBase::Envelope
+{
+  static Pool* pool()
+  {
+    static Pool* pool = new Pool("envelopes", sizeof(Envelope));
+    return pool;
+  }
+
+  static void* operator new(size_t size)
+  {
+    return pool()->allocate(size);
+  }
+
+  static void operator delete(void* p, size_t size)
+  {
+    pool()->deallocate(p, size);
+  }
+
+  enum { MESSAGE, REQUEST, DISPATCHER } type;
+
+  // Whether or not a message should go at the front of the queue.
+  bool inject;
+
+  union {
+    Message* message;
+    pair<HttpRequest*, Promise<HttpResponse>*>* request;
+    internal::Dispatcher* dispatcher;
+  };
+
+  Envelope* volatile next;
+};
+
+
+namespace internal {
+
+/*
+ * A pending delay (see Timer). The 'level', 'next' and 'pprev'
+ * members are used by the wheel to link entries together.
+ */
+struct TimerEntry
+{
+  ev_tstamp tstamp;
+  UPID pid;
+  internal::Dispatcher* dispatcher;
+
+  int level;
+  TimerEntry* next;
+  TimerEntry** pprev;
+
+  // Keeps the entry valid while it is in the wheel (a Timer handle
+  // does not need to be kept around if it will never be canceled).
+  std::tr1::shared_ptr<TimerEntry> self;
+};
+
+} // namespace internal {
+
+
 class ProcessReference
 {
 public:
@@ -294,6 +442,91 @@ private:
 };
 
 
+/*
+ * Serves the counters for the connections to other nodes (see
+ * SocketManager) at /__connections__.
+ */
+class ConnectionsProcess : public Process<ConnectionsProcess>
+{
+public:
+  ConnectionsProcess();
+
+  Promise<HttpResponse> connections(const HttpRequest& request);
+};
+
+
+/*
+ * Serves the counters for the pools of the objects that get allocated
+ * for every message (see pool.hpp) at /__allocations__.
+ */
+class AllocationsProcess : public Process<AllocationsProcess>
+{
+public:
+  AllocationsProcess();
+
+  Promise<HttpResponse> allocations(const HttpRequest& request);
+};
+
+
+/*
+ * Serves a snapshot of every process and of the runtime itself (see
+ * ProcessManager::statistics) at /__processes__.
+ */
+class ProcessesProcess : public Process<ProcessesProcess>
+{
+public:
+  ProcessesProcess();
+
+  Promise<HttpResponse> processes(const HttpRequest& request);
+};
+
+
+/*
+ * Counters for a connection to another node (see SocketManager).
+ */
+struct Connection
+{
+  Connection(bool _inbound = false)
+    : inbound(_inbound), binary(false),
+      messages_sent(0), bytes_sent(0),
+      messages_received(0), bytes_received(0) {}
+
+  /* Whether or not the other node made this connection. */
+  bool inbound;
+
+  /* Whether or not messages get sent as binary frames (see framing.hpp). */
+  bool binary;
+
+  /* Atoms sent on this connection (once binary). */
+  framing::Atoms atoms;
+
+  uint64_t messages_sent;
+  uint64_t bytes_sent;
+  uint64_t messages_received;
+  uint64_t bytes_received;
+};
+
+
+/*
+ * All messages to another node get sent on one of at most
+ * 'max_connections' long-lived connections to that node. A connection
+ * gets made the first time something needs to be sent (or linked) and
+ * stays open until it fails. A connection that another node made to us
+ * gets used for sending back to that node as well, but only if that
+ * node declared it persistent (see framing.hpp). The messages from one
+ * process to another always use the same connection, so they are never
+ * reordered.
+ *
+ * Linked processes only learn about a node exiting from connections
+ * that we made, so a link always makes its own connection if there
+ * isn't one already (the other node might close a connection that it
+ * made at any time).
+ *
+ * Every socket has exactly one "receiver" watcher (which reads from it
+ * until it gets closed) and at most one "sender" watcher at a time
+ * (which exists while 'outgoing' has an entry for the socket). The
+ * socket only gets closed once both are done with it.
+ */
 class SocketManager
 {
 public:
@@ -307,27 +540,49 @@ public:
   void send(DataEncoder* encoder, int s, bool persist);
   void send(Message* message);
 
-  DataEncoder* next(int s);
+  bool next(int s, deque<DataEncoder*>* encoders);
+
+  void received(int s, Message* message);
+
+  void adopt(int s, const Node& node);
+
+  void upgrade(int s);
 
   void closed(int s);
+  void failed(int s);
 
   void exited(const Node& node);
-  void exited(ProcessBase* process);
+  void exited(const UPID& pid);
+
+  void unlink(ProcessBase* process);
+
+  string statistics();
+
+  size_t count();
 
 private:
+  int connect(const Node& node);
+  bool connected(const Node& node);
+  void remove(int s);
+
   /* Map from UPID (local/remote) to process. */
   map<UPID, set<ProcessBase*> > links;
 
   /* Map from socket to node (ip, port). */
   map<int, Node> sockets;
 
-  /* Maps from node (ip, port) to socket. */
-  map<Node, int> temps;
-  map<Node, int> persists;
+  /* Map from node to connections (-1 if not connected, see send). */
+  map<Node, vector<int> > connections;
+
+  /* Counters for each connection. */
+  map<int, Connection> counters;
 
   /* Set of sockets that should be closed. */
   set<int> disposables;
 
+  /* Set of sockets that are done receiving but are still sending. */
+  set<int> closing;
+
   /* Map from socket to outgoing queue. */
   map<int, queue<DataEncoder*> > outgoing;
 
@@ -339,6 +594,103 @@ private:
 };
 
 
+/*
+ * State for a processing thread (a "worker"). Each worker has its own
+ * run queue that it pulls processes from, and steals from the run
+ * queues of other workers when its own is empty. An idle worker waits
+ * at its own gate until something gets enqueued.
+ */
+struct Worker
+{
+  Worker(int _index) : index(_index), process(NULL), recyclable(NULL)
+  {
+    pthread_mutex_init(&m, NULL);
+    gate = new Gate();
+    idle = false;
+  }
+
+  ~Worker()
+  {
+    delete gate;
+    pthread_mutex_destroy(&m);
+  }
+
+  // Lock/mutex protecting the run queue.
+  pthread_mutex_t m;
+  void lock() { pthread_mutex_lock(&m); }
+  void unlock() { pthread_mutex_unlock(&m); }
+
+  /* Index of this worker in 'workers' (used for process affinity). */
+  const int index;
+
+  /* Underlying thread. */
+  pthread_t thread;
+
+  /* Scheduling context for this thread. */
+  ucontext_t uctx_schedule;
+
+  /* Running context for this thread. */
+  ucontext_t uctx_running;
+
+  /* Current process running on this thread. */
+  ProcessBase* process;
+
+  /* Last exited process's stack to be recycled. */
+  void* recyclable;
+
+  /* Queue of runnable processes (implemented as deque). */
+  deque<ProcessBase*> runq;
+
+  /* Gate to wait at when there is nothing to run. */
+  Gate* gate;
+
+  /* Whether or not this worker is (about to be) waiting at its gate. */
+  volatile bool idle;
+};
+
+
+/*
+ * State for an I/O thread. Each I/O thread runs its own event loop
+ * and file descriptors are sharded across the I/O threads by number
+ * (see io), so all the watchers for a socket are always in the same
+ * loop. The first I/O thread runs the default loop which also handles
+ * the timeouts and accepts connections.
+ */
+struct IO
+{
+  IO(struct ev_loop* _loop) : loop(_loop), bytes_received(0), bytes_sent(0)
+  {
+    pthread_mutex_init(&m, NULL);
+  }
+
+  ~IO()
+  {
+    pthread_mutex_destroy(&m);
+  }
+
+  // Lock/mutex protecting the watchers.
+  pthread_mutex_t m;
+  void lock() { pthread_mutex_lock(&m); }
+  void unlock() { pthread_mutex_unlock(&m); }
+
+  /* Event loop. */
+  struct ev_loop* loop;
+
+  /* Asynchronous watcher for interrupting the loop. */
+  ev_async async_watcher;
+
+  /* Queue of I/O watchers to be started in the loop. */
+  queue<ev_io*> watchers;
+
+  /* Bytes received and sent by this thread (only written by it). */
+  uint64_t bytes_received;
+  uint64_t bytes_sent;
+
+  /* Underlying thread. */
+  pthread_t thread;
+};
+
+
 class ProcessManager
 {
 public:
@@ -349,7 +701,7 @@ public:
 
   bool deliver(Message* message, ProcessBase *sender = NULL);
   bool deliver(int c, HttpRequest* request, ProcessBase *sender = NULL);
-  bool deliver(const UPID& to, function<void(ProcessBase*)>* dispatcher, ProcessBase *sender = NULL);
+  bool deliver(const UPID& to, internal::Dispatcher* dispatcher, ProcessBase *sender = NULL);
 
   UPID spawn(ProcessBase *process, bool manage);
   void link(ProcessBase *process, const UPID &to);
@@ -362,7 +714,7 @@ public:
   bool poll(ProcessBase *process, int fd, int op, double secs, bool ignore);
 
   void enqueue(ProcessBase *process);
-  ProcessBase * dequeue();
+  ProcessBase * dequeue(Worker *worker);
 
   void timedout(const UPID &pid, int generation);
   void polled(const UPID &pid, int generation);
@@ -370,6 +722,8 @@ public:
   void run(ProcessBase *process);
   void cleanup(ProcessBase *process);
 
+  string statistics();
+
 private:
   timeout create_timeout(ProcessBase *process, double secs);
   void start_timeout(const timeout &timeout);
@@ -384,10 +738,6 @@ private:
 
   /* Gates for waiting threads (protected by synchronizable(processes)). */
   map<ProcessBase *, Gate *> gates;
-
-  /* Queue of runnable processes (implemented as deque). */
-  deque<ProcessBase *> runq;
-  synchronizable(runq);
 };
 
 
@@ -406,17 +756,23 @@ static uint32_t ip = 0;
 /* Local port. */
 static uint16_t port = 0;
 
+/* Maximum number of connections to make to another node. */
+static size_t max_connections = 1;
+
 /* Active SocketManager (eventually will probably be thread-local). */
 static SocketManager *socket_manager = NULL;
 
 /* Active ProcessManager (eventually will probably be thread-local). */
 static ProcessManager *process_manager = NULL;
 
-/* Event loop. */
+/* I/O threads (see IO). */
+static vector<IO *> *ios = new vector<IO *>();
+
+/* Default event loop (see IO). */
 static struct ev_loop *loop = NULL;
 
-/* Asynchronous watcher for interrupting loop. */
-static ev_async async_watcher;
+/* Asynchronous watcher for interrupting the default loop. */
+static ev_async *async_watcher = NULL;
 
 /* Timeouts watcher for process timeouts. */
 static ev_timer timeouts_watcher;
@@ -424,10 +780,6 @@ static ev_timer timeouts_watcher;
 /* Server watcher for accepting connections. */
 static ev_io server_watcher;
 
-/* Queue of I/O watchers. */
-static queue<ev_io *> *watchers = new queue<ev_io *>();
-static synchronizable(watchers) = SYNCHRONIZED_INITIALIZER;
-
 /**
  * We store the timeouts in a map of lists indexed by the time stamp
  * of the timeout so that we can have two timeouts that have the same
@@ -439,35 +791,34 @@ static map<ev_tstamp, list<timeout> > *timeouts =
   new map<ev_tstamp, list<timeout> >();
 static synchronizable(timeouts) = SYNCHRONIZED_INITIALIZER;
 
+/*
+ * Pending delays (see Timer), kept in a timing wheel that is advanced
+ * by the I/O thread running the default loop (protected by
+ * synchronizable(timeouts)).
+ */
+static Wheel<internal::TimerEntry> *timers = NULL;
+
 /* Flag to indicate whether or to update the timer on async interrupt. */
 static bool update_timer = false;
 
-/* I/O thread. */
-static pthread_t io_thread;
-
-/* Processing thread. */
-static pthread_t proc_thread;
-
-/* Scheduling context for processing thread. */
-static ucontext_t proc_uctx_schedule;
+/* Processing threads (workers). */
+static vector<Worker *> *workers = new vector<Worker *>();
 
-/* Running context for processing thread. */
-static ucontext_t proc_uctx_running;
+/* Number of workers currently waiting at their gate. */
+static volatile size_t idles = 0;
 
-/* Current process of processing thread. */
-//static __thread ProcessBase *proc_process = NULL;
-static ProcessBase *proc_process = NULL;
-
-/* Scheduler gate. */
-static Gate *gate = new Gate();
+/*
+ * Key for looking up the Worker of the calling thread (NULL if the
+ * calling thread is not a processing thread). N.B. A process that
+ * blocks might get resumed by a different worker, so never cache the
+ * result of 'worker()' across a context switch.
+ */
+static pthread_key_t worker_key;
 
 /* Stack of recycled stacks. */
 static stack<void *> *stacks = new stack<void *>();
 static synchronizable(stacks) = SYNCHRONIZED_INITIALIZER;
 
-/* Last exited process's stack to be recycled (global variable hack!). */
-static void *recyclable = NULL;
-
 /**
  * Filter. Synchronized support for using the filterer needs to be
  * recursive incase a filterer wants to do anything fancy (which is
@@ -489,6 +840,20 @@ static Gate* invoke_gate = new Gate();
 static pthread_t invoke_thread;
 
 
+static inline Worker* worker()
+{
+  return (Worker*) pthread_getspecific(worker_key);
+}
+
+
+/* Returns the process running on the calling thread (if any). */
+static inline ProcessBase* running()
+{
+  Worker* w = worker();
+  return w != NULL ? w->process : NULL;
+}
+
+
 int set_nbio(int fd)
 {
   int flags;
@@ -566,20 +931,75 @@ Message* parse(HttpRequest* request)
 }
 
 
-void handle_async(struct ev_loop *loop, ev_async *_, int revents)
+/*
+ * Returns the time stamp of the next timeout or delay to expire (or
+ * false if there are none). Must be called within
+ * synchronized(timeouts).
+ */
+static bool earliest(ev_tstamp *tstamp)
+{
+  bool found = timers->next(tstamp);
+
+  if (!timeouts->empty() && (!found || timeouts->begin()->first < *tstamp)) {
+    *tstamp = timeouts->begin()->first;
+    found = true;
+  }
+
+  return found;
+}
+
+
+/*
+ * Returns the I/O thread responsible for the file descriptor.
+ */
+static inline IO* io(int fd)
+{
+  return (*ios)[fd % ios->size()];
+}
+
+
+/*
+ * Starts the (initialized) watcher in the loop of the I/O thread
+ * responsible for its file descriptor.
+ */
+static void watch(ev_io *watcher)
+{
+  IO* target = io(watcher->fd);
+
+  target->lock();
+  {
+    target->watchers.push(watcher);
+  }
+  target->unlock();
+
+  /* Interrupt the loop. */
+  ev_async_send(target->loop, &target->async_watcher);
+}
+
+
+void handle_async(struct ev_loop *loop, ev_async *watcher, int revents)
 {
-  synchronized (watchers) {
+  IO* io = (IO*) watcher->data;
+
+  io->lock();
+  {
     /* Start all the new I/O watchers. */
-    while (!watchers->empty()) {
-      ev_io *watcher = watchers->front();
-      watchers->pop();
-      ev_io_start(loop, watcher);
+    while (!io->watchers.empty()) {
+      ev_io_start(loop, io->watchers.front());
+      io->watchers.pop();
     }
   }
+  io->unlock();
+
+  /* Only the default loop handles the timeouts. */
+  if (watcher != async_watcher) {
+    return;
+  }
 
   synchronized (timeouts) {
     if (update_timer) {
-      if (!timeouts->empty()) {
+      ev_tstamp tstamp;
+      if (earliest(&tstamp)) {
 	// Determine the current time.
 	ev_tstamp current_tstamp;
 	if (clk != NULL) {
@@ -589,7 +1009,7 @@ void handle_async(struct ev_loop *loop, ev_async *_, int revents)
 	  current_tstamp = ev_time();
 	}
 
-	timeouts_watcher.repeat = timeouts->begin()->first - current_tstamp;
+	timeouts_watcher.repeat = tstamp - current_tstamp;
 
 	// Check when the timer event should fire.
         if (timeouts_watcher.repeat <= 0) {
@@ -615,8 +1035,12 @@ void handle_async(struct ev_loop *loop, ev_async *_, int revents)
 void handle_timeout(struct ev_loop *loop, ev_timer *watcher, int revents)
 {
   list<timeout> timedout;
+  vector<std::tr1::shared_ptr<internal::TimerEntry> > expired;
+  bool manual = false;
 
   synchronized (timeouts) {
+    manual = clk != NULL;
+
     ev_tstamp current_tstamp;
 
     if (clk != NULL) {
@@ -652,10 +1076,28 @@ void handle_timeout(struct ev_loop *loop, ev_timer *watcher, int revents)
     // Okay, so the time stamp for the next timeout should not have fired.
     CHECK(timeouts->empty() || (timeouts->begin()->first > current_tstamp));
 
+    // Now collect the delays that have expired.
+    vector<internal::TimerEntry*> entries;
+    timers->advance(current_tstamp, &entries);
+
+    foreach (internal::TimerEntry* entry, entries) {
+      if (clk != NULL) {
+        // Like above, the receiver's current time needs to be at
+        // least the time the delay expired.
+        if (ProcessReference process = process_manager->use(entry->pid)) {
+          clk->setCurrent(process, max(clk->getCurrent(process),
+                                       entry->tstamp));
+        }
+      }
+      expired.push_back(entry->self);
+      entry->self.reset();
+    }
+
     // Update the timer as necessary.
     // TODO(benh): Make this code look like the code in handle_async.
-    if (!timeouts->empty() && clk == NULL) {
-      timeouts_watcher.repeat = timeouts->begin()->first - current_tstamp;
+    ev_tstamp tstamp;
+    if (earliest(&tstamp) && clk == NULL) {
+      timeouts_watcher.repeat = tstamp - current_tstamp;
       CHECK(timeouts_watcher.repeat > 0);
       ev_timer_again(loop, &timeouts_watcher);
     } else {
@@ -669,6 +1111,21 @@ void handle_timeout(struct ev_loop *loop, ev_timer *watcher, int revents)
   foreach (const timeout &timeout, timedout) {
     process_manager->timedout(timeout.pid, timeout.generation);
   }
+
+  foreach (const std::tr1::shared_ptr<internal::TimerEntry>& entry, expired) {
+    process_manager->deliver(entry->pid, entry->dispatcher);
+    entry->dispatcher = NULL;
+  }
+
+  // When using the manual clock only an idle processing thread moves
+  // the current time to the next timeout, so make sure one considers
+  // doing so even if the delays were for processes that have exited
+  // (and hence nothing new is runnable).
+  if (manual && !expired.empty()) {
+    foreach (Worker* worker, *workers) {
+      worker->gate->open();
+    }
+  }
 }
 
 
@@ -677,7 +1134,7 @@ void handle_poll(struct ev_loop *loop, ev_io *watcher, int revents)
   tuple<UPID, int> *t = (tuple<UPID, int> *) watcher->data;
   process_manager->polled(t->get<0>(), t->get<1>());
   ev_io_stop(loop, watcher);
-  delete watcher;
+  destroy(watchers_pool(), watcher);
   delete t;
 }
 
@@ -713,24 +1170,44 @@ void recv_data(struct ev_loop *loop, ev_io *watcher, int revents)
       socket_manager->closed(c);
       delete decoder;
       ev_io_stop(loop, watcher);
-      delete watcher;
+      destroy(watchers_pool(), watcher);
       break;
     } else {
       CHECK(length > 0);
 
-      // Decode as much of the data as possible into HTTP requests.
+      io(c)->bytes_received += length;
+
+      const bool upgraded = decoder->upgraded();
+
+      // Decode as much of the data as possible into HTTP requests
+      // (or messages once the other node switched to binary framing).
       const deque<HttpRequest*>& requests = decoder->decode(data, length);
+      const deque<Message*>& messages = decoder->messages();
 
-      if (!requests.empty()) {
-        foreach (HttpRequest* request, requests) {
-          process_manager->deliver(c, request);
-        }
-      } else if (requests.empty() && decoder->failed()) {
+      if (!upgraded && decoder->upgraded()) {
+        socket_manager->upgrade(c);
+      }
+
+      foreach (HttpRequest* request, requests) {
+        process_manager->deliver(c, request);
+      }
+
+      foreach (Message* message, messages) {
+        message->to.ip = ip;
+        message->to.port = port;
+        socket_manager->received(c, message);
+        process_manager->deliver(message);
+      }
+
+      // Close the socket as soon as the decoder fails (for example,
+      // because of a frame that is too long) rather than waiting for
+      // more data to arrive.
+      if (decoder->failed()) {
         VLOG(2) << "Decoder error while receiving";
         socket_manager->closed(c);
         delete decoder;
         ev_io_stop(loop, watcher);
-        delete watcher;
+        destroy(watchers_pool(), watcher);
         break;
       }
     }
@@ -740,26 +1217,48 @@ void recv_data(struct ev_loop *loop, ev_io *watcher, int revents)
 
 void send_data(struct ev_loop *loop, ev_io *watcher, int revents)
 {
-  DataEncoder* encoder = (DataEncoder*) watcher->data;
+  // Encoders being sent on this socket (only the first one might have
+  // been partially sent).
+  deque<DataEncoder*>* encoders = (deque<DataEncoder*>*) watcher->data;
 
   int c = watcher->fd;
 
   while (true) {
-    const void* data;
-    size_t size;
+    // Pick up anything else that got queued for this socket so that
+    // it all goes out with as few system calls as possible.
+    if (!socket_manager->next(c, encoders)) {
+      // Nothing more to send right now, clean up.
+      CHECK(encoders->empty());
+      delete encoders;
+      ev_io_stop(loop, watcher);
+      destroy(watchers_pool(), watcher);
+      break;
+    }
+
+    struct iovec iov[SEND_IOVECS];
+    int count = 0;
 
-    data = encoder->next(&size);
-    CHECK(size > 0);
+    foreach (DataEncoder* encoder, *encoders) {
+      if (count == SEND_IOVECS) {
+        break;
+      }
+      count += encoder->next(iov + count, SEND_IOVECS - count);
+    }
+
+    CHECK(count > 0);
 
-    ssize_t length = send(c, data, size, MSG_NOSIGNAL);
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count;
+
+    ssize_t length = sendmsg(c, &msg, MSG_NOSIGNAL);
 
     if (length < 0 && (errno == EINTR)) {
       // Interrupted, try again now.
-      encoder->backup(size);
       continue;
     } else if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
       // Might block, try again later.
-      encoder->backup(size);
       break;
     } else if (length <= 0) {
       // Socket error or closed.
@@ -769,30 +1268,31 @@ void send_data(struct ev_loop *loop, ev_io *watcher, int revents)
       } else {
         VLOG(2) << "Socket closed while sending";
       }
-      socket_manager->closed(c);
-      delete encoder;
+      socket_manager->failed(c);
+      foreach (DataEncoder* encoder, *encoders) {
+        delete encoder;
+      }
+      delete encoders;
       ev_io_stop(loop, watcher);
-      delete watcher;
+      destroy(watchers_pool(), watcher);
       break;
     } else {
       CHECK(length > 0);
 
-      // Update the encoder with the amount sent.
-      encoder->backup(size - length);
-
-      // See if there is any more of the message to send.
-      if (encoder->remaining() == 0) {
-        delete encoder;
-
-        // Check for more stuff to send on socket.
-        encoder = socket_manager->next(c);
-        if (encoder != NULL) {
-          watcher->data = encoder;
-        } else {
-          // Nothing more to send right now, clean up.
-          ev_io_stop(loop, watcher);
-          delete watcher;
-          break;
+      io(c)->bytes_sent += length;
+
+      // Update the encoders with the amount sent, deleting the ones
+      // that have been sent completely.
+      size_t sent = length;
+      while (sent > 0) {
+        CHECK(!encoders->empty());
+        DataEncoder* encoder = encoders->front();
+        size_t size = min(sent, encoder->remaining());
+        encoder->advance(size);
+        sent -= size;
+        if (encoder->remaining() == 0) {
+          encoders->pop_front();
+          delete encoder;
         }
       }
     }
@@ -800,7 +1300,7 @@ void send_data(struct ev_loop *loop, ev_io *watcher, int revents)
 }
 
 
-void sending_connect(struct ev_loop *loop, ev_io *watcher, int revents)
+void receiving_connect(struct ev_loop *loop, ev_io *watcher, int revents)
 {
   int c = watcher->fd;
 
@@ -812,35 +1312,10 @@ void sending_connect(struct ev_loop *loop, ev_io *watcher, int revents)
     // Connect failure.
     VLOG(1) << "Socket error while connecting";
     socket_manager->closed(c);
-    MessageEncoder* encoder = (MessageEncoder*) watcher->data;
-    delete encoder;
+    DataDecoder* decoder = (DataDecoder*) watcher->data;
+    delete decoder;
     ev_io_stop(loop, watcher);
-    delete watcher;
-  } else {
-    // We're connected! Now let's do some sending.
-    ev_io_stop(loop, watcher);
-    ev_io_init(watcher, send_data, c, EV_WRITE);
-    ev_io_start(loop, watcher);
-  }
-}
-
-
-void receiving_connect(struct ev_loop *loop, ev_io *watcher, int revents)
-{
-  int c = watcher->fd;
-
-  // Now check that a successful connection was made.
-  int opt;
-  socklen_t optlen = sizeof(opt);
-
-  if (getsockopt(c, SOL_SOCKET, SO_ERROR, &opt, &optlen) < 0 || opt != 0) {
-    // Connect failure.
-    VLOG(1) << "Socket error while connecting";
-    socket_manager->closed(c);
-    DataDecoder* decoder = (DataDecoder*) watcher->data;
-    delete decoder;
-    ev_io_stop(loop, watcher);
-    delete watcher;
+    destroy(watchers_pool(), watcher);
   } else {
     // We're connected! Now let's do some receiving.
     ev_io_stop(loop, watcher);
@@ -854,33 +1329,39 @@ void accept(struct ev_loop *loop, ev_io *watcher, int revents)
 {
   int s = watcher->fd;
 
-  sockaddr_in addr;
-  socklen_t addrlen = sizeof(addr);
+  // Accept everything that is pending and hand each connection to
+  // the I/O thread responsible for it (see IO).
+  while (true) {
+    sockaddr_in addr;
+    socklen_t addrlen = sizeof(addr);
 
-  int c = ::accept(s, (sockaddr *) &addr, &addrlen);
+    int c = ::accept(s, (sockaddr *) &addr, &addrlen);
 
-  if (c < 0) {
-    return;
-  }
+    if (c < 0 && errno == EINTR) {
+      continue;
+    } else if (c < 0) {
+      return;
+    }
 
-  if (set_nbio(c) < 0) {
-    close(c);
-    return;
-  }
+    if (set_nbio(c) < 0) {
+      close(c);
+      continue;
+    }
 
-  // Turn off Nagle (via TCP_NODELAY) so pipelined requests don't wait.
-  int on = 1;
-  if (setsockopt(c, SOL_TCP, TCP_NODELAY, &on, sizeof(on)) < 0) {
-    close(c);
-  } else {
-    // Allocate and initialize the decoder and watcher.
-    DataDecoder* decoder = new DataDecoder();
+    // Turn off Nagle (via TCP_NODELAY) so pipelined requests don't wait.
+    int on = 1;
+    if (setsockopt(c, SOL_TCP, TCP_NODELAY, &on, sizeof(on)) < 0) {
+      close(c);
+    } else {
+      // Allocate and initialize the decoder and watcher.
+      DataDecoder* decoder = new DataDecoder();
 
-    ev_io *watcher = new ev_io();
-    watcher->data = decoder;
+      ev_io *watcher = create(watchers_pool(), ev_io());
+      watcher->data = decoder;
 
-    ev_io_init(watcher, recv_data, c, EV_READ);
-    ev_io_start(loop, watcher);
+      ev_io_init(watcher, recv_data, c, EV_READ);
+      watch(watcher);
+    }
   }
 }
 
@@ -936,37 +1417,51 @@ void trampoline(int stack0, int stack1, int process0, int process1)
   /* Run the process. */
   process_manager->run(process);
 
-  /* Prepare to recycle this stack (global variable hack!). */
-  CHECK(recyclable == NULL);
-  recyclable = stack;
+  /* Prepare to recycle this stack. Note that we look up the worker
+     now since the process may have migrated to a different thread
+     than the one it started on. */
+  Worker* w = worker();
+  CHECK(w != NULL);
+  CHECK(w->recyclable == NULL);
+  w->recyclable = stack;
 
-  proc_process = NULL;
-  setcontext(&proc_uctx_schedule);
+  w->process = NULL;
+  setcontext(&w->uctx_schedule);
 }
 
 
 void * schedule(void *arg)
 {
+  Worker* worker = (Worker*) arg;
+
+  if (pthread_setspecific(worker_key, worker) != 0) {
+    fatal("pthread_setspecific failed (schedule)");
+  }
+
   // Context for the entry into the schedule routine, used when a
   // process exits, so that other processes can get scheduled!
-  if (getcontext(&proc_uctx_schedule) < 0)
+  if (getcontext(&worker->uctx_schedule) < 0)
     fatalerror("getcontext failed (schedule)");
 
   // Recycle the stack from an exited process.
-  if (recyclable != NULL) {
+  if (worker->recyclable != NULL) {
     synchronized (stacks) {
-      stacks->push(recyclable);
+      stacks->push(worker->recyclable);
     }
-    recyclable = NULL;
+    worker->recyclable = NULL;
   }
 
   do {
-    ProcessBase *process = process_manager->dequeue();
+    ProcessBase *process = process_manager->dequeue(worker);
 
     if (process == NULL) {
-      Gate::state_t old = gate->approach();
-      process = process_manager->dequeue();
+      worker->idle = true;
+      Gate::state_t old = worker->gate->approach();
+      process = process_manager->dequeue(worker);
       if (process == NULL) {
+        // Only the last worker to go idle considers the manual clock
+        // below, since only then are there no runnable processes.
+        bool last = __sync_add_and_fetch(&idles, 1) == workers->size();
 
         // When using the manual clock, we want to let all the
         // processes "run" up to the current time so that processes
@@ -974,53 +1469,58 @@ void * schedule(void *arg)
         // drastically advanced current time then it may try send
         // messages to another process that, due to the happens-before
         // relationship, will inherit it's drastically advanced
-        // current time. If the processing thread gets to this point
-        // (i.e., the point where no other processes are runnable)
-        // with the manual clock means that all of the processes have
-        // been run which could be run up to the current time. The
-        // only way another process could become runnable is if (1) it
-        // receives a message from another node, (2) a file descriptor
-        // it is polling has become ready, or (3) if it has a
-        // timeout. We can ignore processes that become runnable due
-        // to receiving a message from another node or getting an
-        // event on a file descriptor because that should not change
-        // the timing happens-before relationship of the local
-        // processes (unless of course the file descriptor was created
-        // from something like timerfd, in which case, since the
-        // programmer is not using the timing source provided in
-        // libprocess and all bets are off). Thus, we can check that
-        // there are no pending timeouts before the current time and
-        // move the current time to the next timeout value, and tell
-        // the timer to update itself.
-
-        synchronized (timeouts) {
-          if (clk != NULL) {
-            if (!timeouts->empty()) {
-              // Adjust the current time to the next timeout, provided
-              // it is not past the elapsed time.
-              ev_tstamp tstamp = timeouts->begin()->first;
-              if (tstamp <= clk->getElapsed()) {
-                clk->setCurrent(tstamp);
+        // current time. If all of the processing threads get to this
+        // point (i.e., the point where no other processes are
+        // runnable) with the manual clock means that all of the
+        // processes have been run which could be run up to the
+        // current time. The only way another process could become
+        // runnable is if (1) it receives a message from another node,
+        // (2) a file descriptor it is polling has become ready, or
+        // (3) if it has a timeout. We can ignore processes that
+        // become runnable due to receiving a message from another
+        // node or getting an event on a file descriptor because that
+        // should not change the timing happens-before relationship of
+        // the local processes (unless of course the file descriptor
+        // was created from something like timerfd, in which case,
+        // since the programmer is not using the timing source
+        // provided in libprocess and all bets are off). Thus, we can
+        // check that there are no pending timeouts before the current
+        // time and move the current time to the next timeout value,
+        // and tell the timer to update itself.
+
+        if (last) {
+          synchronized (timeouts) {
+            if (clk != NULL) {
+              ev_tstamp tstamp;
+              if (earliest(&tstamp)) {
+                // Adjust the current time to the next timeout, provided
+                // it is not past the elapsed time.
+                if (tstamp <= clk->getElapsed()) {
+                  clk->setCurrent(tstamp);
+                }
+
+                update_timer = true;
+                ev_async_send(loop, async_watcher);
+              } else {
+                // Woah! This comment is the only thing in this else
+                // branch because this is a pretty serious state ... the
+                // only way to make progress is for another node to send
+                // a message or for an event to occur on a file
+                // descriptor that a process is polling. We may want to
+                // consider doing (or printing) something here.
               }
-
-              update_timer = true;
-              ev_async_send(loop, &async_watcher);
-            } else {
-              // Woah! This comment is the only thing in this else
-              // branch because this is a pretty serious state ... the
-              // only way to make progress is for another node to send
-              // a message or for an event to occur on a file
-              // descriptor that a process is polling. We may want to
-              // consider doing (or printing) something here.
             }
           }
         }
 
-	/* Wait at gate if idle. */
-	gate->arrive(old);
-	continue;
+        /* Wait at gate if idle. */
+        worker->gate->arrive(old);
+        __sync_sub_and_fetch(&idles, 1);
+        worker->idle = false;
+        continue;
       } else {
-	gate->leave();
+        worker->gate->leave();
+        worker->idle = false;
       }
     }
 
@@ -1034,11 +1534,12 @@ void * schedule(void *arg)
 	    process->state == ProcessBase::TIMEDOUT);
 
       /* Continue process. */
-      CHECK(proc_process == NULL);
-      proc_process = process;
-      swapcontext(&proc_uctx_running, &process->uctx);
-      CHECK(proc_process != NULL);
-      proc_process = NULL;
+      CHECK(worker->process == NULL);
+      worker->process = process;
+      process->thread = worker->index;
+      swapcontext(&worker->uctx_running, &process->uctx);
+      CHECK(worker->process != NULL);
+      worker->process = NULL;
     }
     process->unlock();
   } while (true);
@@ -1119,16 +1620,54 @@ void initialize(bool initialize_google_logging)
   process_manager = new ProcessManager();
   socket_manager = new SocketManager();
 
-  // Setup processing thread.
-  if (pthread_create (&proc_thread, NULL, schedule, NULL) != 0) {
-    PLOG(FATAL) << "Failed to initialize, pthread_create";
+  char *value;
+
+  // Check environment for the number of processing threads (defaults
+  // to the number of online processors).
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+  value = getenv("LIBPROCESS_NUM_WORKER_THREADS");
+  if (value != NULL) {
+    threads = atoi(value);
+    if (threads <= 0) {
+      fatal("LIBPROCESS_NUM_WORKER_THREADS=%s is not a valid number", value);
+    }
+  }
+
+  if (threads <= 0) {
+    threads = 1;
+  }
+
+  // Setup processing threads. All workers need to exist before any of
+  // them start running since they steal from one another.
+  if (pthread_key_create(&worker_key, NULL) != 0) {
+    fatal("failed to initialize (pthread_key_create)");
+  }
+
+  for (long i = 0; i < threads; i++) {
+    workers->push_back(new Worker(i));
+  }
+
+  foreach (Worker* worker, *workers) {
+    if (pthread_create(&worker->thread, NULL, schedule, worker) != 0) {
+      PLOG(FATAL) << "Failed to initialize, pthread_create";
+    }
+  }
+
+  // Check environment for the maximum number of connections to make
+  // to another node.
+  value = getenv("LIBPROCESS_MAX_CONNECTIONS");
+  if (value != NULL) {
+    int result = atoi(value);
+    if (result <= 0) {
+      fatal("LIBPROCESS_MAX_CONNECTIONS=%s is not a valid number", value);
+    }
+    max_connections = result;
   }
 
   ip = 0;
   port = 0;
 
-  char *value;
-
   // Check environment for ip.
   value = getenv("LIBPROCESS_IP");
   if (value != NULL) {
@@ -1211,15 +1750,44 @@ void initialize(bool initialize_google_logging)
     PLOG(FATAL) << "Failed to initialize, listen";
   }
 
-  // Setup event loop.
+  // Check environment for the number of I/O threads.
+  long io_threads = 1;
+
+  value = getenv("LIBPROCESS_NUM_IO_THREADS");
+  if (value != NULL) {
+    io_threads = atoi(value);
+    if (io_threads <= 0) {
+      fatal("LIBPROCESS_NUM_IO_THREADS=%s is not a valid number", value);
+    }
+  }
+
+  // Setup event loops. Use epoll when we can (every watcher reads,
+  // writes or accepts until it would block, so all we need from the
+  // backend is to hear about sockets becoming ready).
 #ifdef __sun__
-  loop = ev_default_loop(EVBACKEND_POLL | EVBACKEND_SELECT);
+  const unsigned int backend = EVBACKEND_POLL | EVBACKEND_SELECT;
 #else
-  loop = ev_default_loop(EVFLAG_AUTO);
+  const unsigned int backend =
+    (ev_supported_backends() & EVBACKEND_EPOLL) ? EVBACKEND_EPOLL : EVFLAG_AUTO;
 #endif // __sun__
 
-  ev_async_init(&async_watcher, handle_async);
-  ev_async_start(loop, &async_watcher);
+  for (long i = 0; i < io_threads; i++) {
+    struct ev_loop* temp = i == 0 ? ev_default_loop(backend) : ev_loop_new(backend);
+    if (temp == NULL) {
+      fatal("failed to initialize (could not create an event loop)");
+    }
+
+    IO* io = new IO(temp);
+    ev_async_init(&io->async_watcher, handle_async);
+    io->async_watcher.data = io;
+    ev_async_start(io->loop, &io->async_watcher);
+    ios->push_back(io);
+  }
+
+  loop = ios->front()->loop;
+  async_watcher = &ios->front()->async_watcher;
+
+  timers = new Wheel<internal::TimerEntry>(ev_time());
 
   ev_timer_init(&timeouts_watcher, handle_timeout, 0., 2100000.0);
   ev_timer_again(loop, &timeouts_watcher);
@@ -1242,8 +1810,10 @@ void initialize(bool initialize_google_logging)
 //   sigaddset (&sa.sa_mask, w->signum);
 //   sigprocmask (SIG_UNBLOCK, &sa.sa_mask, 0);
 
-  if (pthread_create(&io_thread, NULL, serve, loop) != 0) {
-    PLOG(FATAL) << "Failed to initialize, pthread_create";
+  foreach (IO* io, *ios) {
+    if (pthread_create(&io->thread, NULL, serve, io->loop) != 0) {
+      PLOG(FATAL) << "Failed to initialize, pthread_create";
+    }
   }
 
   if (pthread_create(&invoke_thread, NULL, invoker, NULL) != 0) {
@@ -1257,6 +1827,15 @@ void initialize(bool initialize_google_logging)
   // Create global garbage collector.
   gc = spawn(new GarbageCollector());
 
+  // Serve the connection counters.
+  spawn(new ConnectionsProcess(), true);
+
+  // Serve the allocation counters.
+  spawn(new AllocationsProcess(), true);
+
+  // Serve the process (and runtime) statistics.
+  spawn(new ProcessesProcess(), true);
+
   char temp[INET_ADDRSTRLEN];
   if (inet_ntop(AF_INET, (in_addr *) &ip, temp, INET_ADDRSTRLEN) == NULL) {
     PLOG(FATAL) << "Failed to initialize, inet_ntop";
@@ -1322,19 +1901,70 @@ void HttpProxy::ready(const Future<HttpResponse>& future, bool persist)
   // See the semantics of SocketManager::send for details about how
   // the socket will get closed (it might actually already be closed
   // before we issue this send).
-  socket_manager->send(new HttpResponseEncoder(response), c, persist);
+  socket_manager->send(new HttpResponseEncoder(future), c, persist);
 }
 
 
 void HttpProxy::unavailable(bool persist)
 {
-  HttpResponse response = HttpServiceUnavailableResponse();
+  Future<HttpResponse> response = HttpServiceUnavailableResponse();
 
   // As above, the socket might all ready be closed when we do a send.
   socket_manager->send(new HttpResponseEncoder(response), c, persist);
 }
 
 
+ConnectionsProcess::ConnectionsProcess()
+  : ProcessBase("__connections__")
+{
+  installHttpHandler("", &ConnectionsProcess::connections);
+}
+
+
+Promise<HttpResponse> ConnectionsProcess::connections(
+    const HttpRequest& request)
+{
+  HttpOKResponse response;
+  response.headers["Content-Type"] = "text/x-json";
+  response.body = socket_manager->statistics();
+  return response;
+}
+
+
+AllocationsProcess::AllocationsProcess()
+  : ProcessBase("__allocations__")
+{
+  installHttpHandler("", &AllocationsProcess::allocations);
+}
+
+
+Promise<HttpResponse> AllocationsProcess::allocations(
+    const HttpRequest& request)
+{
+  HttpOKResponse response;
+  response.headers["Content-Type"] = "text/x-json";
+  response.body = Pool::statistics();
+  return response;
+}
+
+
+ProcessesProcess::ProcessesProcess()
+  : ProcessBase("__processes__")
+{
+  installHttpHandler("", &ProcessesProcess::processes);
+}
+
+
+Promise<HttpResponse> ProcessesProcess::processes(
+    const HttpRequest& request)
+{
+  HttpOKResponse response;
+  response.headers["Content-Type"] = "text/x-json";
+  response.body = process_manager->statistics();
+  return response;
+}
+
+
 SocketManager::SocketManager()
 {
   synchronizer(this) = SYNCHRONIZED_INITIALIZER_RECURSIVE;
@@ -1359,54 +1989,22 @@ void SocketManager::link(ProcessBase *process, const UPID &to)
   Node node(to.ip, to.port);
 
   synchronized (this) {
-    // Check if node is remote and there isn't a persistant link.
-    if ((node.ip != ip || node.port != port) && persists.count(node) == 0) {
-      // Okay, no link, lets create a socket.
-      int s;
-
-      if ((s = socket(AF_INET, SOCK_STREAM, IPPROTO_IP)) < 0) {
-        fatalerror("failed to link (socket)");
+    // Check if node is remote and we haven't made a connection to it
+    // already (any connection that we made will do since we learn
+    // about the node exiting when the last one fails).
+    if ((node.ip != ip || node.port != port) && !connected(node)) {
+      int s = connect(node);
+
+      // Also use the connection for sending unless an adopted
+      // connection is already being used in its place.
+      if (connections.count(node) == 0) {
+        connections[node].resize(max_connections, -1);
       }
 
-      if (set_nbio(s) < 0) {
-        fatalerror("failed to link (set_nbio)");
+      int& t = connections[node][hash_value(to) % max_connections];
+      if (t < 0) {
+        t = s;
       }
-
-      sockets[s] = node;
-
-      persists[node] = s;
-
-      sockaddr_in addr;
-      memset(&addr, 0, sizeof(addr));
-      addr.sin_family = PF_INET;
-      addr.sin_port = htons(to.port);
-      addr.sin_addr.s_addr = to.ip;
-
-      // Allocate and initialize the decoder and watcher.
-      DataDecoder* decoder = new DataDecoder();
-
-      ev_io *watcher = new ev_io();
-      watcher->data = decoder;
-
-      // Try and connect to the node using this socket.
-      if (connect(s, (sockaddr *) &addr, sizeof(addr)) < 0) {
-        if (errno != EINPROGRESS) {
-          fatalerror("failed to link (connect)");
-        }
-
-        // Wait for socket to be connected.
-        ev_io_init(watcher, receiving_connect, s, EV_WRITE);
-      } else {
-        ev_io_init(watcher, recv_data, s, EV_READ);
-      }
-
-      // Enqueue the watcher.
-      synchronized (watchers) {
-        watchers->push(watcher);
-      }
-
-      // Interrupt the loop.
-      ev_async_send(loop, &async_watcher);
     }
 
     links[to].insert(process);
@@ -1417,16 +2015,15 @@ void SocketManager::link(ProcessBase *process, const UPID &to)
 PID<HttpProxy> SocketManager::proxy(int s)
 {
   synchronized (this) {
-    if (sockets.count(s) > 0) {
-      CHECK(proxies.count(s) > 0);
+    if (proxies.count(s) > 0) {
       return proxies[s]->self();
     } else {
-      // Register the socket with the manager for sending purposes. The
-      // current design doesn't let us create a valid "node" for this
-      // socket, so we use a "default" one for now.
-      sockets[s] = Node();
-
-      CHECK(proxies.count(s) == 0);
+      // Register the socket with the manager for sending purposes (if
+      // it isn't already). The current design doesn't let us create a
+      // valid "node" for this socket, so we use a "default" one for now.
+      if (sockets.count(s) == 0) {
+        sockets[s] = Node();
+      }
 
       HttpProxy* proxy = new HttpProxy(s);
       spawn(proxy, true);
@@ -1450,16 +2047,12 @@ void SocketManager::send(DataEncoder* encoder, int s, bool persist)
         outgoing[s];
 
         // Allocate and initialize the watcher.
-        ev_io *watcher = new ev_io();
-        watcher->data = encoder;
+        ev_io *watcher = create(watchers_pool(), ev_io());
+        watcher->data = new deque<DataEncoder*>(1, encoder);
 
         ev_io_init(watcher, send_data, s, EV_WRITE);
 
-        synchronized (watchers) {
-          watchers->push(watcher);
-        }
-
-        ev_async_send(loop, &async_watcher);
+        watch(watcher);
       }
 
       // Set the socket to get closed if not persistant.
@@ -1468,6 +2061,7 @@ void SocketManager::send(DataEncoder* encoder, int s, bool persist)
       }
     } else {
       VLOG(1) << "Attempting to send on a no longer valid socket!";
+      delete encoder;
     }
   }
 }
@@ -1477,140 +2071,371 @@ void SocketManager::send(Message* message)
 {
   CHECK(message != NULL);
 
-  DataEncoder* encoder = new MessageEncoder(message);
+  Node node(message->to.ip, message->to.port);
+
+  // Always use the same connection for messages from one process to
+  // another so that they don't get reordered.
+  size_t index =
+    (hash_value(message->from) * 31 + hash_value(message->to)) %
+    max_connections;
+
+  size_t size = message->body.size();
+
+  synchronized (this) {
+    int s = -1;
+
+    if (connections.count(node) > 0) {
+      s = connections[node][index];
+    }
+
+    if (s < 0) {
+      s = connect(node);
+
+      if (connections.count(node) == 0) {
+        connections[node].resize(max_connections, -1);
+      }
+
+      connections[node][index] = s;
+    }
+
+    Connection& connection = counters[s];
+
+    // The encoding depends on what has been sent on the connection so
+    // far (see framing.hpp), so it must be done here.
+    DataEncoder* encoder = NULL;
+
+    if (connection.binary) {
+      encoder = new MessageEncoder(message, &connection.atoms);
+    } else {
+      // Advertise binary framing with the first message on a
+      // connection that we made.
+      bool advertise = !connection.inbound && connection.messages_sent == 0;
+      encoder = new MessageEncoder(message, advertise);
+    }
+
+    connection.messages_sent++;
+    connection.bytes_sent += size;
+
+    send(encoder, s, true);
+  }
+}
+
+
+bool SocketManager::next(int s, deque<DataEncoder*>* encoders)
+{
+  synchronized (this) {
+    CHECK(outgoing.count(s) > 0);
+
+    if (!outgoing[s].empty()) {
+      // More messages!
+      while (!outgoing[s].empty()) {
+        encoders->push_back(outgoing[s].front());
+        outgoing[s].pop();
+      }
+    } else if (encoders->empty()) {
+      // No more messages ... erase the outgoing queue.
+      outgoing.erase(s);
+
+      if (closing.count(s) > 0) {
+        // Nobody is receiving on the socket anymore either.
+        closing.erase(s);
+        close(s);
+      } else if (disposables.count(s) > 0) {
+        // The socket was set for disposal, so shut it down (the
+        // receiver will close it once it notices).
+        if (proxies.count(s) > 0) {
+          HttpProxy* proxy = proxies[s];
+          proxies.erase(s);
+          post(proxy->self(), TERMINATE);
+        }
+
+        disposables.erase(s);
+        sockets.erase(s);
+        shutdown(s, SHUT_RDWR);
+      }
+
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+void SocketManager::received(int s, Message* message)
+{
+  CHECK(message != NULL);
+
+  synchronized (this) {
+    if (sockets.count(s) == 0) {
+      // Another node made this connection. Register it (without using
+      // it for sending messages, see adopt) so that binary framing can
+      // still be negotiated on it.
+      sockets[s] = Node(message->from.ip, message->from.port);
+      counters[s] = Connection(true);
+    }
+
+    if (counters.count(s) > 0) {
+      counters[s].messages_received++;
+      counters[s].bytes_received += message->body.size();
+    }
+  }
+}
+
+
+void SocketManager::adopt(int s, const Node& node)
+{
+  synchronized (this) {
+    // Another node made this connection (and keeps it open), we can
+    // use it for sending back to that node too (as long as we have
+    // room for it).
+    if (sockets.count(s) == 0 ||
+        (counters.count(s) > 0 && counters[s].inbound)) {
+      if (connections.count(node) == 0) {
+        connections[node].resize(max_connections, -1);
+      }
+
+      vector<int>& pool = connections[node];
+      if (find(pool.begin(), pool.end(), s) == pool.end()) {
+        for (size_t i = 0; i < pool.size(); i++) {
+          if (pool[i] < 0) {
+            pool[i] = s;
+            sockets[s] = node;
+            if (counters.count(s) == 0) {
+              counters[s] = Connection(true);
+            }
+            break;
+          }
+        }
+      }
+    }
+  }
+}
+
+
+void SocketManager::upgrade(int s)
+{
+  synchronized (this) {
+    // Only connections to other nodes (i.e., not HTTP clients) get
+    // upgraded, and only once (see framing.hpp). This doesn't depend
+    // on whether or not we use the connection for sending messages.
+    if (sockets.count(s) > 0 &&
+        counters.count(s) > 0 &&
+        !counters[s].binary) {
+      VLOG(2) << "Switching to binary framing on socket " << s;
+      counters[s].binary = true;
+      send(new DataEncoder(framing::UPGRADE), s, true);
+    }
+  }
+}
+
+
+void SocketManager::closed(int s)
+{
+  synchronized (this) {
+    remove(s);
+
+    if (outgoing.count(s) > 0) {
+      // Let the sender close the socket once it is done, which should
+      // be soon (if it isn't failing already) since we shut it down.
+      while (!outgoing[s].empty()) {
+        delete outgoing[s].front();
+        outgoing[s].pop();
+      }
+
+      closing.insert(s);
+      shutdown(s, SHUT_RDWR);
+      return;
+    }
+  }
+
+  // This might have just been a receiving socket (only sending
+  // sockets and the receiving side of connections we use for sending
+  // get added to 'sockets'), so we want to make sure to call close so
+  // that the file descriptor can get reused.
+  close(s);
+}
+
+
+void SocketManager::failed(int s)
+{
+  synchronized (this) {
+    CHECK(outgoing.count(s) > 0);
+
+    remove(s);
+
+    while (!outgoing[s].empty()) {
+      delete outgoing[s].front();
+      outgoing[s].pop();
+    }
+
+    outgoing.erase(s);
+
+    if (closing.count(s) > 0) {
+      // Nobody is receiving on the socket anymore either.
+      closing.erase(s);
+      close(s);
+    } else {
+      // Make sure the receiver notices (it will close the socket).
+      shutdown(s, SHUT_RDWR);
+    }
+  }
+}
+
+
+string SocketManager::statistics()
+{
+  std::ostringstream out;
+
+  out << "[";
+
+  synchronized (this) {
+    bool first = true;
+    foreachpair (int s, const Connection& connection, counters) {
+      const Node& node = sockets[s];
+
+      char temp[INET_ADDRSTRLEN];
+      if (inet_ntop(AF_INET, (in_addr *) &node.ip, temp, INET_ADDRSTRLEN) == NULL) {
+        temp[0] = '\0';
+      }
+
+      out << (first ? "" : ",")
+          << "{\"socket\":" << s
+          << ",\"ip\":\"" << temp << "\""
+          << ",\"port\":" << node.port
+          << ",\"inbound\":" << (connection.inbound ? "true" : "false")
+          << ",\"binary\":" << (connection.binary ? "true" : "false")
+          << ",\"messages_sent\":" << connection.messages_sent
+          << ",\"bytes_sent\":" << connection.bytes_sent
+          << ",\"messages_received\":" << connection.messages_received
+          << ",\"bytes_received\":" << connection.bytes_received
+          << "}";
+
+      first = false;
+    }
+  }
+
+  out << "]";
+
+  return out.str();
+}
+
+
+size_t SocketManager::count()
+{
+  synchronized (this) {
+    return sockets.size();
+  }
+}
+
+
+int SocketManager::connect(const Node& node)
+{
+  int s;
+
+  if ((s = socket(AF_INET, SOCK_STREAM, IPPROTO_IP)) < 0) {
+    fatalerror("failed to connect (socket)");
+  }
+
+  if (set_nbio(s) < 0) {
+    fatalerror("failed to connect (set_nbio)");
+  }
 
-  Node node(message->to.ip, message->to.port);
+  // Turn off Nagle (via TCP_NODELAY) since the connection gets used
+  // for small requests and replies.
+  int on = 1;
+  if (setsockopt(s, SOL_TCP, TCP_NODELAY, &on, sizeof(on)) < 0) {
+    fatalerror("failed to connect (setsockopt)");
+  }
 
-  synchronized (this) {
-    // Check if there is already a socket.
-    bool persistant = persists.count(node) > 0;
-    bool temporary = temps.count(node) > 0;
-    if (persistant || temporary) {
-      int s = persistant ? persists[node] : temps[node];
-      send(encoder, s, persistant);
-    } else {
-      // No peristant or temporary socket to the node currently
-      // exists, so we create a temporary one.
-      int s;
+  sockets[s] = node;
 
-      if ((s = socket(AF_INET, SOCK_STREAM, IPPROTO_IP)) < 0) {
-        fatalerror("failed to send (socket)");
-      }
+  counters[s] = Connection(false);
 
-      if (set_nbio(s) < 0) {
-        fatalerror("failed to send (set_nbio)");
-      }
+  sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = PF_INET;
+  addr.sin_port = htons(node.port);
+  addr.sin_addr.s_addr = node.ip;
 
-      sockets[s] = node;
+  // Allocate and initialize the decoder and watcher (for receiving).
+  DataDecoder* decoder = new DataDecoder();
 
-      temps[node] = s;
-      disposables.insert(s);
+  ev_io *watcher = create(watchers_pool(), ev_io());
+  watcher->data = decoder;
 
-      // Initialize the outgoing queue.
-      outgoing[s];
+  // Try and connect to the node using this socket (anything sent in
+  // the mean time will just wait for the socket to become writable).
+  if (::connect(s, (sockaddr *) &addr, sizeof(addr)) < 0) {
+    if (errno != EINPROGRESS) {
+      fatalerror("failed to connect (connect)");
+    }
 
-      // Try and connect to the node using this socket.
-      sockaddr_in addr;
-      memset(&addr, 0, sizeof(addr));
-      addr.sin_family = PF_INET;
-      addr.sin_port = htons(message->to.port);
-      addr.sin_addr.s_addr = message->to.ip;
+    // Wait for socket to be connected.
+    ev_io_init(watcher, receiving_connect, s, EV_WRITE);
+  } else {
+    ev_io_init(watcher, recv_data, s, EV_READ);
+  }
 
-      // Allocate and initialize the watcher.
-      ev_io *watcher = new ev_io();
-      watcher->data = encoder;
-    
-      if (connect(s, (sockaddr *) &addr, sizeof(addr)) < 0) {
-        if (errno != EINPROGRESS) {
-          fatalerror("failed to send (connect)");
-        }
+  watch(watcher);
 
-        // Initialize watcher for connecting.
-        ev_io_init(watcher, sending_connect, s, EV_WRITE);
-      } else {
-        // Initialize watcher for sending.
-        ev_io_init(watcher, send_data, s, EV_WRITE);
-      }
+  return s;
+}
 
-      // Enqueue the watcher.
-      synchronized (watchers) {
-        watchers->push(watcher);
-      }
 
-      ev_async_send(loop, &async_watcher);
+bool SocketManager::connected(const Node& node)
+{
+  foreachpair (int s, const Connection& connection, counters) {
+    if (!connection.inbound &&
+        sockets[s].ip == node.ip &&
+        sockets[s].port == node.port) {
+      return true;
     }
   }
+
+  return false;
 }
 
 
-DataEncoder* SocketManager::next(int s)
+void SocketManager::remove(int s)
 {
-  DataEncoder* encoder = NULL;
+  if (sockets.count(s) > 0) {
+    const Node node = sockets[s];
 
-  synchronized (this) {
-    CHECK(sockets.count(s) > 0);
-    CHECK(outgoing.count(s) > 0);
+    const bool outbound = counters.count(s) > 0 && !counters[s].inbound;
 
-    if (!outgoing[s].empty()) {
-      // More messages!
-      encoder = outgoing[s].front();
-      outgoing[s].pop();
-    } else {
-      // No more messages ... erase the outgoing queue.
-      outgoing.erase(s);
+    if (proxies.count(s) > 0) {
+      HttpProxy* proxy = proxies[s];
+      proxies.erase(s);
+      post(proxy->self(), TERMINATE);
+    }
 
-      // Close the socket if it was set for disposal.
-      if (disposables.count(s) > 0) {
-        // Also try and remove from temps.
-        const Node& node = sockets[s];
-        if (temps.count(node) > 0 && temps[node] == s) {
-          temps.erase(node);
-        } else if (proxies.count(s) > 0) {
-          HttpProxy* proxy = proxies[s];
-          proxies.erase(s);
-          post(proxy->self(), TERMINATE);
+    if (connections.count(node) > 0) {
+      // Stop sending on the connection.
+      bool pooled = false;
+      foreach (int& t, connections[node]) {
+        if (t == s) {
+          t = -1;
         }
+        pooled = pooled || t >= 0;
+      }
 
-        disposables.erase(s);
-        sockets.erase(s);
-        close(s);
+      if (!pooled) {
+        connections.erase(node);
       }
     }
-  }
-
-  return encoder;
-}
-
-
-void SocketManager::closed(int s)
-{
-  synchronized (this) {
-    if (sockets.count(s) > 0) {
-      const Node& node = sockets[s];
 
-      // Don't bother invoking exited unless socket was persistant.
-      if (persists.count(node) > 0 && persists[node] == s) {
-	persists.erase(node);
-        exited(node);
-      } else if (temps.count(node) > 0 && temps[node] == s) {
-        temps.erase(node);
-      } else if (proxies.count(s) > 0) {
-        HttpProxy* proxy = proxies[s];
-        proxies.erase(s);
-        post(proxy->self(), TERMINATE);
-      }
+    counters.erase(s);
+    disposables.erase(s);
+    sockets.erase(s);
 
-      outgoing.erase(s);
-      disposables.erase(s);
-      sockets.erase(s);
+    // If that was the last connection that we made to the node then
+    // let linked processes know that it has exited (connections that
+    // the node made to us don't say anything about it).
+    if (outbound && !connected(node)) {
+      exited(node);
     }
   }
-
-  // This might have just been a receiving socket (only sending
-  // sockets, with the exception of the receiving side of a persistant
-  // socket, get added to 'sockets'), so we want to make sure to call
-  // close so that the file descriptor can get reused.
-  close(s);
 }
 
 
@@ -1641,26 +2466,31 @@ void SocketManager::exited(const Node &node)
 }
 
 
-void SocketManager::exited(ProcessBase *process)
+void SocketManager::exited(const UPID &pid)
 {
   synchronized (this) {
-    /* Remove any links this process might have had. */
-    foreachpair (_, set<ProcessBase *> &processes, links) {
-      processes.erase(process);
-    }
-
     /* Look up all linked processes. */
-    map<UPID, set<ProcessBase *> >::iterator it = links.find(process->pid);
+    map<UPID, set<ProcessBase *> >::iterator it = links.find(pid);
 
     if (it != links.end()) {
       set<ProcessBase *> &processes = it->second;
       foreach (ProcessBase *p, processes) {
-        CHECK(process != p);
-        Message *message = encode(process->pid, p->pid, EXITED);
+        Message *message = encode(pid, p->pid, EXITED);
         // TODO(benh): Preserve happens-before when using clock.
         p->enqueue(message);
       }
-      links.erase(process->pid);
+      links.erase(pid);
+    }
+  }
+}
+
+
+void SocketManager::unlink(ProcessBase *process)
+{
+  synchronized (this) {
+    /* Remove any links this process might have had. */
+    foreachpair (_, set<ProcessBase *> &processes, links) {
+      processes.erase(process);
     }
   }
 }
@@ -1669,7 +2499,6 @@ void SocketManager::exited(ProcessBase *process)
 ProcessManager::ProcessManager()
 {
   synchronizer(processes) = SYNCHRONIZED_INITIALIZER;
-  synchronizer(runq) = SYNCHRONIZED_INITIALIZER;
 }
 
 
@@ -1735,6 +2564,19 @@ bool ProcessManager::deliver(int c, HttpRequest *request, ProcessBase *sender)
   Message* message = parse(request);
 
   if (message != NULL) {
+    // Use the connection for sending back to the other node too if
+    // it declared that it keeps the connection open.
+    if (request->headers.count(framing::PERSISTENT) > 0) {
+      socket_manager->adopt(c, Node(message->from.ip, message->from.port));
+    }
+
+    socket_manager->received(c, message);
+
+    // Switch to binary framing if the other node supports it.
+    if (request->headers.count(framing::HEADER) > 0) {
+      socket_manager->upgrade(c);
+    }
+
     delete request;
     return deliver(message, sender);
   }
@@ -1774,7 +2616,7 @@ bool ProcessManager::deliver(int c, HttpRequest *request, ProcessBase *sender)
             << "' to " << to;
 
     // Enqueue request and promise for receiver.
-    receiver->enqueue(new pair<HttpRequest*, Promise<HttpResponse>*>(request, promise));
+    receiver->enqueue(create(promises_pool(), make_pair(request, promise)));
   } else {
     // This has no receiver, send error response.
     VLOG(1) << "Returning '404 Not Found' for HTTP request for '"
@@ -1799,7 +2641,7 @@ bool ProcessManager::deliver(int c, HttpRequest *request, ProcessBase *sender)
 
 
 // TODO(benh): Refactor and share code with above!
-bool ProcessManager::deliver(const UPID& to, function<void(ProcessBase*)>* dispatcher, ProcessBase *sender)
+bool ProcessManager::deliver(const UPID& to, internal::Dispatcher* dispatcher, ProcessBase *sender)
 {
   CHECK(dispatcher != NULL);
 
@@ -1896,6 +2738,10 @@ UPID ProcessManager::spawn(ProcessBase *process, bool manage)
   makecontext(&process->uctx, (void (*)()) trampoline,
               4, stack0, stack1, process0, process1);
 
+  // Save the pid since once the process gets enqueued it might run
+  // (and exit) on another processing thread.
+  const UPID pid = process->self();
+
   /* Add process to the run queue. */
   enqueue(process);
 
@@ -1904,7 +2750,7 @@ UPID ProcessManager::spawn(ProcessBase *process, bool manage)
     dispatch(gc, &GarbageCollector::manage<ProcessBase>, process);
   }
 
-  return process->self();
+  return pid;
 }
 
 
@@ -1938,6 +2784,13 @@ bool ProcessManager::receive(ProcessBase *process, double secs)
 
   process->lock();
   {
+    /* Announce we are blocking before checking the mailbox one last
+       time, so that a racing enqueue either gets seen here or sees
+       the new state and wakes us up (see ProcessBase::notify). */
+    process->state = ProcessBase::RECEIVING;
+    __sync_synchronize();
+    process->drain();
+
     /* Ensure nothing enqueued since check in ProcessBase::receive. */
     if (process->messages.empty()) {
       if (secs > 0) {
@@ -1948,8 +2801,7 @@ bool ProcessManager::receive(ProcessBase *process, double secs)
         start_timeout(timeout);
 
         /* Context switch. */
-        process->state = ProcessBase::RECEIVING;
-        swapcontext(&process->uctx, &proc_uctx_running);
+        swapcontext(&process->uctx, &worker()->uctx_running);
 
         CHECK(process->state == ProcessBase::READY ||
 	      process->state == ProcessBase::TIMEDOUT);
@@ -1969,11 +2821,12 @@ bool ProcessManager::receive(ProcessBase *process, double secs)
         process->generation++;
       } else {
         /* Context switch. */
-        process->state = ProcessBase::RECEIVING;
-        swapcontext(&process->uctx, &proc_uctx_running);
+        swapcontext(&process->uctx, &worker()->uctx_running);
         CHECK(process->state == ProcessBase::READY);
         process->state = ProcessBase::RUNNING;
       }
+    } else {
+      process->state = ProcessBase::RUNNING;
     }
   }
   process->unlock();
@@ -1990,6 +2843,11 @@ bool ProcessManager::serve(ProcessBase *process, double secs)
 
   process->lock();
   {
+    /* Announce we are blocking (see ProcessManager::receive). */
+    process->state = ProcessBase::SERVING;
+    __sync_synchronize();
+    process->drain();
+
     /* Ensure nothing enqueued since check in ProcessBase::serve. */
     if (process->messages.empty() &&
         process->requests.empty() &&
@@ -2002,8 +2860,7 @@ bool ProcessManager::serve(ProcessBase *process, double secs)
         start_timeout(timeout);
 
         /* Context switch. */
-        process->state = ProcessBase::SERVING;
-        swapcontext(&process->uctx, &proc_uctx_running);
+        swapcontext(&process->uctx, &worker()->uctx_running);
 
         CHECK(process->state == ProcessBase::READY ||
 	      process->state == ProcessBase::TIMEDOUT);
@@ -2023,11 +2880,12 @@ bool ProcessManager::serve(ProcessBase *process, double secs)
         process->generation++;
       } else {
         /* Context switch. */
-        process->state = ProcessBase::SERVING;
-        swapcontext(&process->uctx, &proc_uctx_running);
+        swapcontext(&process->uctx, &worker()->uctx_running);
         CHECK(process->state == ProcessBase::READY);
         process->state = ProcessBase::RUNNING;
       }
+    } else {
+      process->state = ProcessBase::RUNNING;
     }
   }
   process->unlock();
@@ -2048,14 +2906,14 @@ void ProcessManager::pause(ProcessBase *process, double secs)
 
       /* Context switch. */
       process->state = ProcessBase::PAUSED;
-      swapcontext(&process->uctx, &proc_uctx_running);
+      swapcontext(&process->uctx, &worker()->uctx_running);
       CHECK(process->state == ProcessBase::TIMEDOUT);
       process->state = ProcessBase::RUNNING;
     } else {
       /* Modified context switch (basically a yield). */
       process->state = ProcessBase::READY;
       enqueue(process);
-      swapcontext(&process->uctx, &proc_uctx_running);
+      swapcontext(&process->uctx, &worker()->uctx_running);
       CHECK(process->state == ProcessBase::READY);
       process->state = ProcessBase::RUNNING;
     }
@@ -2104,7 +2962,7 @@ bool ProcessManager::wait(ProcessBase *process, const UPID &pid)
       if (process->state == ProcessBase::RUNNING) {
         /* Context switch. */
         process->state = ProcessBase::WAITING;
-        swapcontext(&process->uctx, &proc_uctx_running);
+        swapcontext(&process->uctx, &worker()->uctx_running);
         CHECK(process->state == ProcessBase::READY);
         process->state = ProcessBase::RUNNING;
       } else {
@@ -2173,16 +3031,24 @@ bool ProcessManager::poll(ProcessBase *process, int fd, int op, double secs, boo
 
   process->lock();
   {
+    /* Announce we are blocking (see ProcessManager::receive). */
+    process->state = ProcessBase::POLLING;
+    __sync_synchronize();
+
     /* Consider a non-empty message queue as an immediate interrupt. */
-    if (!ignore && !process->messages.empty()) {
-      process->unlock();
-      return false;
+    if (!ignore) {
+      process->drain();
+      if (!process->messages.empty()) {
+        process->state = ProcessBase::RUNNING;
+        process->unlock();
+        return false;
+      }
     }
 
     // Treat an poll with a bad fd as an interruptible pause!
     if (fd >= 0) {
       /* Allocate/Initialize the watcher. */
-      ev_io *watcher = new ev_io();
+      ev_io *watcher = create(watchers_pool(), ev_io());
 
       if ((op & ProcessBase::RDWR) == ProcessBase::RDWR) {
         ev_io_init(watcher, handle_poll, fd, EV_READ | EV_WRITE);
@@ -2198,13 +3064,7 @@ bool ProcessManager::poll(ProcessBase *process, int fd, int op, double secs, boo
       // watcher runs).
       watcher->data = new tuple<UPID, int>(process->pid, process->generation);
 
-      /* Enqueue the watcher. */
-      synchronized (watchers) {
-        watchers->push(watcher);
-      }
-    
-      /* Interrupt the loop. */
-      ev_async_send(loop, &async_watcher);
+      watch(watcher);
     }
 
     CHECK(secs >= 0);
@@ -2217,8 +3077,7 @@ bool ProcessManager::poll(ProcessBase *process, int fd, int op, double secs, boo
     }
 
     /* Context switch. */
-    process->state = ProcessBase::POLLING;
-    swapcontext(&process->uctx, &proc_uctx_running);
+    swapcontext(&process->uctx, &worker()->uctx_running);
     CHECK(process->state == ProcessBase::READY ||
 	  process->state == ProcessBase::TIMEDOUT ||
 	  process->state == ProcessBase::INTERRUPTED);
@@ -2249,34 +3108,79 @@ void ProcessManager::enqueue(ProcessBase *process)
 {
   CHECK(process != NULL);
 
-  // TODO(benh): Check and see if this process has it's own thread. If
-  // it does, push it on that threads runq, and wake up that thread if
-  // it's not running. Otherwise, check and see which thread this
-  // process was last running on, and put it on that threads runq.
+  // Put the process on the run queue of the thread it was last running
+  // on (for cache affinity). A process that has never run gets put on
+  // the run queue of the calling thread if it's a processing thread,
+  // since it was most likely just spawned or dispatched to from there.
+  Worker* target = NULL;
+
+  if (process->thread >= 0) {
+    target = (*workers)[process->thread];
+  } else if ((target = worker()) == NULL) {
+    // Spread processes enqueued from "outside" threads.
+    static volatile unsigned int next = 0;
+    target = (*workers)[__sync_fetch_and_add(&next, 1) % workers->size()];
+  }
 
-  synchronized (runq) {
-    CHECK(find(runq.begin(), runq.end(), process) == runq.end());
-    runq.push_back(process);
+  target->lock();
+  {
+    CHECK(find(target->runq.begin(), target->runq.end(), process) ==
+          target->runq.end());
+    target->runq.push_back(process);
+  }
+  target->unlock();
+
+  /* Wake up the worker if necessary. */
+  if (target->idle) {
+    target->gate->open();
+  } else {
+    // The worker is busy, so wake up an idle worker to steal this
+    // process (we start looking after the target to spread the load).
+    const size_t size = workers->size();
+    for (size_t i = 1; i < size; i++) {
+      Worker* thief = (*workers)[(target->index + i) % size];
+      if (thief->idle) {
+        thief->gate->open();
+        break;
+      }
+    }
   }
-    
-  /* Wake up the processing thread if necessary. */
-  gate->open();
 }
 
 
-ProcessBase * ProcessManager::dequeue()
+ProcessBase * ProcessManager::dequeue(Worker *worker)
 {
-  // TODO(benh): Remove a process from this thread's runq. If there
-  // are no processes to run, and this is not a dedicated thread, then
-  // steal one from another threads runq.
+  CHECK(worker != NULL);
 
   ProcessBase *process = NULL;
 
-  synchronized (runq) {
-    if (!runq.empty()) {
-      process = runq.front();
-      runq.pop_front();
+  // Take the oldest process from our own run queue.
+  worker->lock();
+  {
+    if (!worker->runq.empty()) {
+      process = worker->runq.front();
+      worker->runq.pop_front();
+    }
+  }
+  worker->unlock();
+
+  if (process != NULL) {
+    return process;
+  }
+
+  // Nothing to run, try and steal the youngest process from another
+  // worker (the owner keeps taking its oldest processes).
+  const size_t size = workers->size();
+  for (size_t i = 1; i < size && process == NULL; i++) {
+    Worker* victim = (*workers)[(worker->index + i) % size];
+    victim->lock();
+    {
+      if (!victim->runq.empty()) {
+        process = victim->runq.back();
+        victim->runq.pop_back();
+      }
     }
+    victim->unlock();
   }
 
   return process;
@@ -2375,8 +3279,16 @@ void ProcessManager::cleanup(ProcessBase *process)
   // Possible gate non-libprocess threads are waiting at.
   Gate *gate = NULL;
 
+  // Once the process is no longer in 'processes' a waiter on another
+  // processing thread might clean it up, so we copy its pid.
+  const UPID pid = process->pid;
+
   // Stop new process references from being created.
   process->state = ProcessBase::FINISHING;
+
+  // Stop getting notified about linked processes exiting (this must
+  // happen while the process is still valid, see below).
+  socket_manager->unlink(process);
  
   /* Remove process. */
   synchronized (processes) {
@@ -2394,6 +3306,9 @@ void ProcessManager::cleanup(ProcessBase *process)
 
     process->lock();
     {
+      // Move anything still in the mailbox into the queues.
+      process->drain();
+
       // Free any pending messages.
       while (!process->messages.empty()) {
         Message *message = process->messages.front();
@@ -2405,12 +3320,12 @@ void ProcessManager::cleanup(ProcessBase *process)
       while (!process->requests.empty()) {
         pair<HttpRequest*, Promise<HttpResponse>*>* request = process->requests.front();
         process->requests.pop_front();
-        delete request;
+        destroy(promises_pool(), request);
       }
 
       // Free any pending dispatchers.
       while (!process->dispatchers.empty()) {
-        function<void(ProcessBase*)>* dispatcher = process->dispatchers.front();
+        internal::Dispatcher* dispatcher = process->dispatchers.front();
         process->dispatchers.pop_front();
         delete dispatcher;
       }
@@ -2427,9 +3342,14 @@ void ProcessManager::cleanup(ProcessBase *process)
         CHECK(waiting.find(process) == waiting.end());
       }
  
-      // Confirm process not in runq.
-      synchronized (runq) {
-        CHECK(find(runq.begin(), runq.end(), process) == runq.end());
+      // Confirm process not in any runq.
+      foreach (Worker* worker, *workers) {
+        worker->lock();
+        {
+          CHECK(find(worker->runq.begin(), worker->runq.end(), process) ==
+                worker->runq.end());
+        }
+        worker->unlock();
       }
  
       // Grab all the waiting processes that are now resumable.
@@ -2454,7 +3374,7 @@ void ProcessManager::cleanup(ProcessBase *process)
   }
 
   // Inform socket manager.
-  socket_manager->exited(process);
+  socket_manager->exited(pid);
 
   // N.B. After opening the gate we can no longer dereference
   // 'process' since it might already be cleaned up by user code (a
@@ -2468,13 +3388,11 @@ void ProcessManager::cleanup(ProcessBase *process)
   foreach (ProcessBase *p, resumable) {
     p->lock();
     {
-      // Process 'p' might be RUNNING because it is racing to become
-      // WAITING while we are actually trying to get it to become
-      // running again.
-      // TODO(benh): Once we actually run multiple processes at a
-      // time (using multiple threads) this logic will need to get
-      // made thread safe (in particular, a process may be
-      // FINISHING).
+      // Process 'p' might be RUNNING (possibly on another processing
+      // thread) because it is racing to become WAITING while we are
+      // actually trying to get it to become running again. Holding
+      // the lock on 'p' makes this safe since 'p' only becomes
+      // WAITING while holding its lock (see ProcessManager::wait).
       CHECK(p->state == ProcessBase::RUNNING ||
 	    p->state == ProcessBase::WAITING);
       if (p->state == ProcessBase::RUNNING) {
@@ -2489,6 +3407,80 @@ void ProcessManager::cleanup(ProcessBase *process)
 }
 
 
+string ProcessManager::statistics()
+{
+  static const char* states[] = {
+    "INIT", "READY", "RUNNING", "RECEIVING", "SERVING", "PAUSED",
+    "POLLING", "WAITING", "INTERRUPTED", "TIMEDOUT", "FINISHING",
+    "FINISHED"
+  };
+
+  std::ostringstream out;
+
+  out << "{\"processes\":[";
+
+  // N.B. The statistics of a process get read without holding its
+  // lock, so they might be a little out of date.
+  synchronized (processes) {
+    bool first = true;
+    foreachpair (_, ProcessBase* process, processes) {
+      out << (first ? "" : ",")
+          << "{\"id\":\"" << process->pid.id << "\""
+          << ",\"state\":\"" << states[process->state] << "\""
+          << ",\"pending\":" << max((int) process->pending, 0)
+          << ",\"dequeued\":" << process->dequeued
+          << ",\"handlers\":" << process->handlers
+          << ",\"handler_time\":" << process->handlerTime
+          << ",\"max_handler_time\":" << process->maxHandlerTime
+          << "}";
+      first = false;
+    }
+  }
+
+  out << "]";
+
+  size_t runq = 0;
+  foreach (Worker* worker, *workers) {
+    worker->lock();
+    {
+      runq += worker->runq.size();
+    }
+    worker->unlock();
+  }
+
+  out << ",\"workers\":" << workers->size()
+      << ",\"idle_workers\":" << idles
+      << ",\"runq\":" << runq;
+
+  uint64_t bytes_received = 0;
+  uint64_t bytes_sent = 0;
+  foreach (IO* io, *ios) {
+    bytes_received += io->bytes_received;
+    bytes_sent += io->bytes_sent;
+  }
+
+  out << ",\"io_threads\":" << ios->size()
+      << ",\"sockets\":" << socket_manager->count()
+      << ",\"bytes_received\":" << bytes_received
+      << ",\"bytes_sent\":" << bytes_sent;
+
+  size_t count = 0;
+  size_t delays = 0;
+  synchronized (timeouts) {
+    foreachpair (_, const list<timeout>& timedout, *timeouts) {
+      count += timedout.size();
+    }
+    delays = timers->size();
+  }
+
+  out << ",\"timeouts\":" << count
+      << ",\"delays\":" << delays
+      << "}";
+
+  return out.str();
+}
+
+
 timeout ProcessManager::create_timeout(ProcessBase *process, double secs)
 {
   CHECK(process != NULL);
@@ -2521,7 +3513,7 @@ void ProcessManager::start_timeout(const timeout &timeout)
       // Need to interrupt the loop to update/set timer repeat.
       (*timeouts)[timeout.tstamp].push_back(timeout);
       update_timer = true;
-      ev_async_send(loop, &async_watcher);
+      ev_async_send(loop, async_watcher);
     } else {
       // Timer repeat is adequate, just add the timeout.
       CHECK(timeouts->size() >= 1);
@@ -2590,7 +3582,7 @@ void Clock::resume()
     }
 
     update_timer = true;
-    ev_async_send(loop, &async_watcher);
+    ev_async_send(loop, async_watcher);
   }
 }
 
@@ -2601,8 +3593,70 @@ void Clock::advance(double secs)
     if (clk != NULL) {
       clk->setElapsed(clk->getElapsed() + secs);
 
-      // Might need to wakeup the processing thread.
-      gate->open();
+      // Might need to wakeup the processing threads.
+      foreach (Worker* worker, *workers) {
+        worker->gate->open();
+      }
+    }
+  }
+}
+
+
+Timer::Timer(double secs,
+             const UPID& pid,
+             internal::Dispatcher* dispatcher)
+  : entry(new internal::TimerEntry())
+{
+  initialize();
+
+  entry->pid = pid;
+  entry->dispatcher = dispatcher;
+  entry->next = NULL;
+  entry->pprev = NULL;
+  entry->self = entry;
+
+  synchronized (timeouts) {
+    if (clk != NULL) {
+      // Like a process that gets spawned, the delay starts from the
+      // current time of the running process (if any).
+      ProcessBase* process = running();
+      entry->tstamp = process != NULL
+        ? clk->getCurrent(process) + secs
+        : clk->getCurrent() + secs;
+    } else {
+      // TODO(benh): Unclear if want ev_now(...) or ev_time().
+      entry->tstamp = ev_time() + secs;
+    }
+
+    // Need to interrupt the loop to update the timer if this is now
+    // the first thing to expire.
+    ev_tstamp tstamp;
+    if (!earliest(&tstamp) || entry->tstamp < tstamp) {
+      update_timer = true;
+      ev_async_send(loop, async_watcher);
+    }
+
+    timers->add(entry.get());
+  }
+}
+
+
+Timer::~Timer()
+{
+  // NOTE: Do not cancel the timer! Some users will simply ignore
+  // saving the timer because they never want to cancel, thus
+  // we can not cancel it here!
+}
+
+
+void Timer::cancel()
+{
+  synchronized (timeouts) {
+    if (entry->pprev != NULL) {
+      timers->remove(entry.get());
+      delete entry->dispatcher;
+      entry->dispatcher = NULL;
+      entry->self.reset();
     }
   }
 }
@@ -2613,10 +3667,20 @@ ProcessBase::ProcessBase(const std::string& _id)
   initialize();
 
   pthread_mutex_init(&m, NULL);
+  pthread_mutex_init(&delegatesMutex, NULL);
+
+  mailbox = new Mailbox<Envelope>();
 
   refs = 0;
   current = NULL;
   generation = 0;
+  thread = -1;
+
+  pending = 0;
+  dequeued = 0;
+  handlers = 0;
+  handlerTime = 0;
+  maxHandlerTime = 0;
 
   // Generate string representation of unique id for process.
   if (_id != "") {
@@ -2634,9 +3698,8 @@ ProcessBase::ProcessBase(const std::string& _id)
   // using happens before relationship between creator and createe!
   synchronized (timeouts) {
     if (clk != NULL) {
-      if (pthread_self() == proc_thread) {
-        CHECK(proc_process != NULL);
-        clk->setCurrent(this, clk->getCurrent(proc_process));
+      if (running() != NULL) {
+        clk->setCurrent(this, clk->getCurrent(running()));
       } else {
         clk->setCurrent(this, clk->getCurrent());
       }
@@ -2645,16 +3708,19 @@ ProcessBase::ProcessBase(const std::string& _id)
 }
 
 
-ProcessBase::~ProcessBase() {}
+ProcessBase::~ProcessBase()
+{
+  delete mailbox;
+}
 
 
 void ProcessBase::enqueue(Message* message, bool inject)
 {
   CHECK(message != NULL);
 
-  // TODO(benh): Put filter inside lock statement below so that we can
-  // guarantee the order of the messages seen by a filter are the same
-  // as the order of messages seen by the process.
+  // TODO(benh): Check the filter when draining the mailbox so that we
+  // can guarantee the order of the messages seen by a filter are the
+  // same as the order of messages seen by the process.
   synchronized (filterer) {
     if (filterer != NULL) {
       if (filterer->filter(message)) {
@@ -2664,48 +3730,38 @@ void ProcessBase::enqueue(Message* message, bool inject)
     }
   }
 
+  CHECK(state != FINISHED);
+
+  // Check and see if we should delegate this message.
   UPID delegate;
 
-  lock();
+  pthread_mutex_lock(&delegatesMutex);
   {
-    CHECK(state != FINISHED);
-
-    // Check and see if we should delegate this message.
-    if (delegates.count(message->name) > 0) {
-      delegate = delegates[message->name];
-    } else {
-      if (!inject) {
-        messages.push_back(message);
-      } else {
-        messages.push_front(message);
-      }
-
-      if (state == RECEIVING || state == SERVING) {
-        state = READY;
-        process_manager->enqueue(this);
-      } else if (state == POLLING) {
-        state = INTERRUPTED;
-        process_manager->enqueue(this);
-      }
-
-      CHECK(state == INIT ||
-            state == READY ||
-            state == RUNNING ||
-            state == PAUSED ||
-            state == WAITING ||
-            state == INTERRUPTED ||
-            state == TIMEDOUT ||
-            state == FINISHING);
+    map<string, UPID>::const_iterator iterator =
+      delegates.find(message->name);
+    if (iterator != delegates.end()) {
+      delegate = iterator->second;
     }
   }
-  unlock();
+  pthread_mutex_unlock(&delegatesMutex);
 
-  // Delegate this message if necessary.
-  if (delegate != UPID()) {
+  if (delegate) {
     VLOG(1) << "Delegating message '" << message->name << "' to " << delegate;
     message->to = delegate;
     transport(message, this);
+    return;
   }
+
+  Envelope* envelope = new Envelope();
+  envelope->type = Envelope::MESSAGE;
+  envelope->inject = inject;
+  envelope->message = message;
+
+  __sync_fetch_and_add(&pending, 1);
+
+  mailbox->push(envelope);
+
+  notify(true);
 }
 
 
@@ -2715,82 +3771,110 @@ void ProcessBase::enqueue(pair<HttpRequest*, Promise<HttpResponse>*>* request)
 
   // TODO(benh): Support filtering HTTP requests.
 
-  lock();
-  {
-    CHECK(state != FINISHED);
+  CHECK(state != FINISHED);
 
-    requests.push_back(request);
+  Envelope* envelope = new Envelope();
+  envelope->type = Envelope::REQUEST;
+  envelope->inject = false;
+  envelope->request = request;
 
-    if (state == SERVING) {
-      state = READY;
-      process_manager->enqueue(this);
-    } else if (state == POLLING) {
-      state = INTERRUPTED;
-      process_manager->enqueue(this);
-    }
+  __sync_fetch_and_add(&pending, 1);
 
-    CHECK(state == INIT ||
-	  state == READY ||
-	  state == RUNNING ||
-	  state == RECEIVING ||
-	  state == PAUSED ||
-	  state == WAITING ||
-	  state == INTERRUPTED ||
-	  state == TIMEDOUT ||
-	  state == FINISHING);
-  }
-  unlock();
+  mailbox->push(envelope);
+
+  notify(false);
 }
 
 
-void ProcessBase::enqueue(function<void(ProcessBase*)>* dispatcher)
+void ProcessBase::enqueue(internal::Dispatcher* dispatcher)
 {
   CHECK(dispatcher != NULL);
 
   // TODO(benh): Support filtering dispatches.
 
-  lock();
-  {
-    CHECK(state != FINISHED);
+  CHECK(state != FINISHED);
+
+  Envelope* envelope = new Envelope();
+  envelope->type = Envelope::DISPATCHER;
+  envelope->inject = false;
+  envelope->dispatcher = dispatcher;
+
+  __sync_fetch_and_add(&pending, 1);
+
+  mailbox->push(envelope);
+
+  notify(false);
+}
 
-    dispatchers.push_back(dispatcher);
 
-    if (state == SERVING) {
+void ProcessBase::notify(bool message)
+{
+  // Pushing onto the mailbox ends with a full memory barrier (after
+  // the element has been linked in), and a process changes its state
+  // (followed by a barrier) before it checks its mailbox one last
+  // time (see ProcessManager::receive), so either the process will
+  // see what we just enqueued or we will see that it is blocked. This
+  // also covers an element linked in behind one whose producer has
+  // yet to link it: that producer will see the process is blocked
+  // once it has. Only when blocked do we need to acquire the lock.
+  if (state != RECEIVING && state != SERVING && state != POLLING) {
+    return;
+  }
+
+  lock();
+  {
+    if ((message && state == RECEIVING) || state == SERVING) {
       state = READY;
       process_manager->enqueue(this);
     } else if (state == POLLING) {
       state = INTERRUPTED;
       process_manager->enqueue(this);
     }
-
-    CHECK(state == INIT ||
-	  state == READY ||
-	  state == RUNNING ||
-	  state == RECEIVING ||
-	  state == PAUSED ||
-	  state == WAITING ||
-	  state == INTERRUPTED ||
-	  state == TIMEDOUT ||
-	  state == FINISHING);
   }
   unlock();
 }
 
 
+void ProcessBase::drain()
+{
+  Envelope* envelope = NULL;
+
+  while ((envelope = mailbox->pop()) != NULL) {
+    switch (envelope->type) {
+      case Envelope::MESSAGE:
+        if (!envelope->inject) {
+          messages.push_back(envelope->message);
+        } else {
+          messages.push_front(envelope->message);
+        }
+        break;
+      case Envelope::REQUEST:
+        requests.push_back(envelope->request);
+        break;
+      case Envelope::DISPATCHER:
+        dispatchers.push_back(envelope->dispatcher);
+        break;
+    }
+    delete envelope;
+  }
+}
+
+
 template <>
 Message * ProcessBase::dequeue()
 {
+  CHECK(state == RUNNING);
+
+  drain();
+
   Message *message = NULL;
 
-  lock();
-  {
-    CHECK(state == RUNNING);
-    if (!messages.empty()) {
-      message = messages.front();
-      messages.pop_front();
-    }
+  if (!messages.empty()) {
+    message = messages.front();
+    messages.pop_front();
+    __sync_fetch_and_sub(&pending, 1);
+    dequeued++;
   }
-  unlock();
 
   return message;
 }
@@ -2799,36 +3883,38 @@ Message * ProcessBase::dequeue()
 template <>
 pair<HttpRequest*, Promise<HttpResponse>*>* ProcessBase::dequeue()
 {
+  CHECK(state == RUNNING);
+
+  drain();
+
   pair<HttpRequest*, Promise<HttpResponse>*>* request = NULL;
 
-  lock();
-  {
-    CHECK(state == RUNNING);
-    if (!requests.empty()) {
-      request = requests.front();
-      requests.pop_front();
-    }
+  if (!requests.empty()) {
+    request = requests.front();
+    requests.pop_front();
+    __sync_fetch_and_sub(&pending, 1);
+    dequeued++;
   }
-  unlock();
 
   return request;
 }
 
 
 template <>
-function<void(ProcessBase*)> * ProcessBase::dequeue()
+internal::Dispatcher* ProcessBase::dequeue()
 {
-  function<void(ProcessBase*)> *dispatcher = NULL;
+  CHECK(state == RUNNING);
 
-  lock();
-  {
-    CHECK(state == RUNNING);
-    if (!dispatchers.empty()) {
-      dispatcher = dispatchers.front();
-      dispatchers.pop_front();
-    }
+  drain();
+
+  internal::Dispatcher* dispatcher = NULL;
+
+  if (!dispatchers.empty()) {
+    dispatcher = dispatchers.front();
+    dispatchers.pop_front();
+    __sync_fetch_and_sub(&pending, 1);
+    dequeued++;
   }
-  unlock();
 
   return dispatcher;
 }
@@ -2868,17 +3954,14 @@ string ProcessBase::receive(double secs)
     return name();
   }
 
-  if (pthread_self() == proc_thread) {
+  if (worker() != NULL) {
     // Avoid blocking if negative seconds.
     if (secs >= 0) {
       if (!process_manager->receive(this, secs)) {
         goto timeout;
       } else {
-        lock();
-        {
-          CHECK(!messages.empty());
-        }
-        unlock();
+        // N.B. A message is not guaranteed to be in the mailbox yet
+        // (see Mailbox::pop) but we'll block again if it isn't.
         goto check;
       }
     } else {
@@ -2913,6 +3996,7 @@ string ProcessBase::serve(double secs, bool once)
       dequeue<pair<HttpRequest*, Promise<HttpResponse>*> >();
 
     if (request != NULL) {
+      const double start = ev_time();
       size_t index = request->first->path.find('/', 1);
       index = index != string::npos ? index + 1 : request->first->path.size();
       const string& name = request->first->path.substr(index);
@@ -2926,16 +4010,19 @@ string ProcessBase::serve(double secs, bool once)
       }
       delete request->first;
       delete request->second;
-      delete request;
+      destroy(promises_pool(), request);
+      handled(start);
       continue;
     }
 
-    function<void(ProcessBase*)>* dispatcher =
-      dequeue<function<void(ProcessBase*)> >();
+    internal::Dispatcher* dispatcher =
+      dequeue<internal::Dispatcher>();
 
     if (dispatcher != NULL) {
+      const double start = ev_time();
       (*dispatcher)(this);
       delete dispatcher;
+      handled(start);
       continue;
     }
 
@@ -2971,7 +4058,9 @@ string ProcessBase::serve(double secs, bool once)
 
     if ((current = dequeue<Message>()) != NULL) {
       if (messageHandlers.count(name()) > 0) {
+        const double start = ev_time();
         messageHandlers[name()]();
+        handled(start);
 	continue;
       } else {
         return name();
@@ -2979,7 +4068,7 @@ string ProcessBase::serve(double secs, bool once)
     }
 
     // Okay, nothing found, possibly block in ProcessManager::serve.
-    if (pthread_self() == proc_thread) {
+    if (worker() != NULL) {
       // Avoid blocking if seconds has elapsed.
       if (secs > 0) {
         secs = secs - (elapsedTime() - startTime);
@@ -2993,14 +4082,7 @@ string ProcessBase::serve(double secs, bool once)
         if (!process_manager->serve(this, secs)) {
           goto timeout;
         } else {
-          // Okay, something should be ready.
-          lock();
-          {
-            CHECK(!messages.empty() ||
-		  !requests.empty() ||
-		  !dispatchers.empty());
-          }
-          unlock();
+          // Okay, something should be ready (see ProcessBase::receive).
           goto check;
         }
       } else {
@@ -3021,6 +4103,15 @@ string ProcessBase::serve(double secs, bool once)
 }
 
 
+void ProcessBase::handled(double start)
+{
+  const double secs = ev_time() - start;
+  handlers++;
+  handlerTime += secs;
+  maxHandlerTime = max(maxHandlerTime, secs);
+}
+
+
 UPID ProcessBase::from() const
 {
   if (current != NULL) {
@@ -3055,7 +4146,7 @@ const std::string& ProcessBase::body() const
 
 void ProcessBase::pause(double secs)
 {
-  if (pthread_self() == proc_thread) {
+  if (worker() != NULL) {
     process_manager->pause(this, secs);
   } else {
     sleep(secs);
@@ -3082,7 +4173,7 @@ bool ProcessBase::poll(int fd, int op, double secs, bool ignore)
   }
 
   /* TODO(benh): Handle invoking poll from "outside" thread. */
-  if (pthread_self() != proc_thread) {
+  if (worker() == NULL) {
     fatal("unimplemented");
   }
 
@@ -3146,9 +4237,8 @@ UPID ProcessBase::spawn(ProcessBase* process, bool manage)
     // using happens before relationship between spawner and spawnee!
     synchronized (timeouts) {
       if (clk != NULL) {
-        if (pthread_self() == proc_thread) {
-          CHECK(proc_process != NULL);
-          clk->setCurrent(process, clk->getCurrent(proc_process));
+        if (running() != NULL) {
+          clk->setCurrent(process, clk->getCurrent(running()));
         } else {
           clk->setCurrent(process, clk->getCurrent());
         }
@@ -3166,11 +4256,7 @@ UPID ProcessBase::spawn(ProcessBase* process, bool manage)
 
 void terminate(const UPID& pid, bool inject)
 {
-  if (pthread_self() != proc_thread) {
-    process_manager->terminate(pid, inject);
-  } else {
-    process_manager->terminate(pid, inject, proc_process);
-  }
+  process_manager->terminate(pid, inject, running());
 }
 
 
@@ -3211,7 +4297,7 @@ bool wait(const UPID& pid, double secs)
     // N.B. This could result in a deadlock! We could check if such
     // was the case by doing:
     //
-    //   if (proc_process && proc_process->pid == pid) {
+    //   if (running() && running()->pid == pid) {
     //     handle deadlock here;
     //   }
     //
@@ -3220,11 +4306,11 @@ bool wait(const UPID& pid, double secs)
     // thinks it has waited on a process and it is now finished (and
     // can be cleaned up).
 
-    if (pthread_self() != proc_thread) {
+    if (worker() == NULL) {
       return process_manager->external_wait(pid);
     }
 
-    return process_manager->wait(proc_process, pid);
+    return process_manager->wait(running(), pid);
   }
 
   bool waited = false;
@@ -3273,15 +4359,11 @@ void post(const UPID& to, const string& name, const char* data, size_t length)
 
 namespace internal {
 
-void dispatch(const UPID& pid, function<void(ProcessBase*)>* dispatcher)
+void dispatch(const UPID& pid, internal::Dispatcher* dispatcher)
 {
   initialize();
 
-  if (pthread_self() != proc_thread) {
-    process_manager->deliver(pid, dispatcher);
-  } else {
-    process_manager->deliver(pid, dispatcher, proc_process);
-  }
+  process_manager->deliver(pid, dispatcher, running());
 }
 
 }}  // namespace process { namespace internal {
@@ -0,0 +1,291 @@
+#ifndef __WHEEL_HPP__
+#define __WHEEL_HPP__
+
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+
+namespace process {
+
+// A hierarchical timing wheel (see Varghese and Lauck, "Hashed and
+// Hierarchical Timing Wheels"). Elements are put in one of LEVELS
+// wheels of SLOTS slots depending on how far in the future they
+// expire, so adding and removing an element is O(1) and advancing
+// time only touches the slots that have come due (elements in the
+// coarser wheels get "cascaded" into the finer wheels as time
+// passes). Time stamps are bucketed into millisecond ticks, but an
+// element is only ever expired once its exact time stamp has passed.
+//
+// The type T must have the members 'double tstamp', 'int level', 'T*
+// next' and 'T** pprev' which the wheel uses to link elements
+// together (and hence an element can only be in one wheel at a
+// time). An element is in a wheel if and only if 'pprev' is not NULL.
+//
+// N.B. A wheel is not synchronized.
+template <typename T>
+class Wheel
+{
+public:
+  explicit Wheel(double now)
+    : current(ticks(now)), count(0), cached(false)
+  {
+    memset(slots, 0, sizeof(slots));
+    memset(counts, 0, sizeof(counts));
+  }
+
+  size_t size() const
+  {
+    return count;
+  }
+
+  void add(T* t)
+  {
+    place(t);
+    count++;
+
+    if (cached && t->tstamp < first) {
+      first = t->tstamp;
+    }
+  }
+
+  void remove(T* t)
+  {
+    unlink(t);
+    count--;
+
+    if (cached && t->tstamp <= first) {
+      cached = false;
+    }
+  }
+
+  // Advances the wheel to 'now', removing every element that expires
+  // at or before 'now' and appending it to 'expired'.
+  void advance(double now, std::vector<T*>* expired)
+  {
+    const uint64_t target = ticks(now);
+
+    cached = false;
+
+    if (target < current) {
+      // Time went backwards (e.g., the manual clock was resumed after
+      // having been advanced), so start over from 'target'.
+      rewind(target);
+    }
+
+    collect(now, expired);
+
+    while (current < target) {
+      // Skip ahead to the next tick at which the first non-empty
+      // wheel turns, nothing can come due before then.
+      int level = 0;
+      while (level < LEVELS && counts[level] == 0) {
+        level++;
+      }
+
+      if (level == LEVELS) {
+        current = target;
+        break;
+      }
+
+      const uint64_t next =
+        ((current >> (BITS * level)) + 1) << (BITS * level);
+
+      if (next > target) {
+        current = target;
+        break;
+      }
+
+      current = next;
+      cascade();
+      collect(now, expired);
+    }
+  }
+
+  // Returns true and the time stamp of the element that expires first
+  // or false if the wheel is empty. The answer is cached until the
+  // wheel advances or the first element gets removed, so that adding
+  // lots of elements does not require looking through the slots.
+  bool next(double* tstamp)
+  {
+    if (count == 0) {
+      return false;
+    } else if (cached) {
+      *tstamp = first;
+      return true;
+    }
+
+    bool found = false;
+
+    for (int level = 0; level < LEVELS; level++) {
+      if (counts[level] == 0) {
+        continue;
+      }
+
+      // All the elements in a slot at level 0 have the same tick, but
+      // the elements in a slot at a higher level span multiple ticks
+      // and never share the slot of the current tick (see 'place').
+      const int start = (current >> (BITS * level)) & (SLOTS - 1);
+      const int begin = level == 0 ? 0 : 1;
+
+      for (int offset = begin; offset < begin + SLOTS; offset++) {
+        T* t = slots[level][(start + offset) & (SLOTS - 1)];
+        if (t != NULL) {
+          for (; t != NULL; t = t->next) {
+            if (!found || t->tstamp < *tstamp) {
+              *tstamp = t->tstamp;
+              found = true;
+            }
+          }
+          break;
+        }
+      }
+    }
+
+    if (found) {
+      cached = true;
+      first = *tstamp;
+    }
+
+    return found;
+  }
+
+private:
+  // Not copyable, not assignable.
+  Wheel(const Wheel&);
+  Wheel& operator = (const Wheel&);
+
+  static const int BITS = 6;
+  static const int SLOTS = 1 << BITS;
+  static const int LEVELS = 5;
+  static const uint64_t TICKS_PER_SECOND = 1000;
+
+  static uint64_t ticks(double tstamp)
+  {
+    return tstamp > 0 ? (uint64_t) (tstamp * TICKS_PER_SECOND) : 0;
+  }
+
+  // Links the element into the slot of its tick at the lowest level
+  // that spans it. Elements that are past due go in the slot of the
+  // current tick and elements that are beyond the top level get
+  // parked in its last slot (and get placed again when it turns).
+  void place(T* t)
+  {
+    uint64_t tick = ticks(t->tstamp);
+
+    if (tick < current) {
+      tick = current;
+    }
+
+    const uint64_t delta = tick - current;
+
+    if (delta >= (uint64_t(1) << (BITS * LEVELS))) {
+      tick = current + (uint64_t(1) << (BITS * LEVELS)) - 1;
+    }
+
+    int level = 0;
+    while (level < LEVELS - 1 &&
+           delta >= (uint64_t(1) << (BITS * (level + 1)))) {
+      level++;
+    }
+
+    const int index = (tick >> (BITS * level)) & (SLOTS - 1);
+
+    T** head = &slots[level][index];
+    t->next = *head;
+    if (t->next != NULL) {
+      t->next->pprev = &t->next;
+    }
+    *head = t;
+    t->pprev = head;
+    t->level = level;
+    counts[level]++;
+  }
+
+  void unlink(T* t)
+  {
+    *t->pprev = t->next;
+    if (t->next != NULL) {
+      t->next->pprev = t->pprev;
+    }
+    t->next = NULL;
+    t->pprev = NULL;
+    counts[t->level]--;
+  }
+
+  // Moves the elements of every wheel that just turned into the
+  // finer wheels (must be called each time 'current' crosses a
+  // multiple of SLOTS).
+  void cascade()
+  {
+    for (int level = 1; level < LEVELS; level++) {
+      if ((current & ((uint64_t(1) << (BITS * level)) - 1)) != 0) {
+        break;
+      }
+
+      const int index = (current >> (BITS * level)) & (SLOTS - 1);
+
+      T* t;
+      while ((t = slots[level][index]) != NULL) {
+        unlink(t);
+        place(t);
+      }
+    }
+  }
+
+  // Removes the expired elements from the slot of the current tick.
+  void collect(double now, std::vector<T*>* expired)
+  {
+    T* t = slots[0][current & (SLOTS - 1)];
+    while (t != NULL) {
+      T* next = t->next;
+      if (t->tstamp <= now) {
+        remove(t);
+        expired->push_back(t);
+      }
+      t = next;
+    }
+  }
+
+  void rewind(uint64_t target)
+  {
+    std::vector<T*> elements;
+
+    for (int level = 0; level < LEVELS; level++) {
+      for (int index = 0; index < SLOTS; index++) {
+        T* t;
+        while ((t = slots[level][index]) != NULL) {
+          unlink(t);
+          elements.push_back(t);
+        }
+      }
+    }
+
+    current = target;
+
+    for (size_t i = 0; i < elements.size(); i++) {
+      place(elements[i]);
+    }
+  }
+
+  // Tick the wheel is at, i.e., everything before it has expired.
+  uint64_t current;
+
+  // Total number of elements in the wheel.
+  size_t count;
+
+  // Heads of the lists of elements in each slot, and the number of
+  // elements at each level (so that empty wheels can be skipped).
+  T* slots[LEVELS][SLOTS];
+  size_t counts[LEVELS];
+
+  // Whether or not 'first' is the time stamp of the element that
+  // expires first (see 'next').
+  bool cached;
+  double first;
+};
+
+} // namespace process {
+
+#endif // __WHEEL_HPP__